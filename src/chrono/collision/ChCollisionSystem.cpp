@@ -22,7 +22,7 @@
 
 namespace chrono {
 
-ChCollisionSystem::ChCollisionSystem() : m_system(nullptr), m_initialized(false) {}
+ChCollisionSystem::ChCollisionSystem() : m_system(nullptr), m_initialized(false), m_num_threads(1) {}
 
 ChCollisionSystem::~ChCollisionSystem() {}
 
@@ -51,6 +51,55 @@ void ChCollisionSystem::UnbindItem(std::shared_ptr<ChPhysicsItem> item) {
     item->RemoveCollisionModelsFromSystem(this);
 }
 
+void ChCollisionSystem::ChRayhitResults::Resize(size_t num_rays) {
+    hit.resize(num_rays);
+    abs_hitPoint.resize(num_rays);
+    abs_hitNormal.resize(num_rays);
+    dist_factor.resize(num_rays);
+    hitModel.resize(num_rays);
+}
+
+void ChCollisionSystem::ChRayhitResults::Set(size_t i, const ChRayhitResult& result) {
+    hit[i] = result.hit;
+    if (result.hit) {
+        abs_hitPoint[i] = result.abs_hitPoint;
+        abs_hitNormal[i] = result.abs_hitNormal;
+        dist_factor[i] = result.dist_factor;
+        hitModel[i] = result.hitModel;
+    } else {
+        dist_factor[i] = 1;
+        hitModel[i] = nullptr;
+    }
+}
+
+int ChCollisionSystem::RayHitBatch(const std::vector<ChVector3d>& from,
+                                   const std::vector<ChVector3d>& to,
+                                   ChRayhitResults& results) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    results.Resize(num_rays);
+
+    int num_hits = 0;
+#pragma omp parallel for num_threads(m_num_threads) reduction(+ : num_hits)
+    for (int i = 0; i < num_rays; i++) {
+        ChRayhitResult result;
+        RayHit(from[i], to[i], result);
+        results.Set(i, result);
+        num_hits += result.hit ? 1 : 0;
+    }
+
+    return num_hits;
+}
+
+int ChCollisionSystem::RayHitBatch(const std::vector<ChVector3d>& from,
+                                   const ChVector3d& ray,
+                                   ChRayhitResults& results) const {
+    std::vector<ChVector3d> to(from.size());
+    for (size_t i = 0; i < from.size(); i++)
+        to[i] = from[i] + ray;
+    return RayHitBatch(from, to, results);
+}
+
 void ChCollisionSystem::ArchiveOut(ChArchiveOut& archive_out) {
     // version number
     archive_out.VersionWrite<ChCollisionSystem>();
@@ -15,6 +15,8 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
@@ -100,8 +102,9 @@ class ChApi ChCollisionSystem {
     virtual void ResetTimers() {}
 
     /// Set the number of OpenMP threads for collision detection.
-    /// The default implementation does nothing. Derived classes implement this function as applicable.
-    virtual void SetNumThreads(int nthreads) {}
+    /// The default implementation only caches the number of threads (used for batched ray-hit tests). Derived classes
+    /// implement this function as applicable.
+    virtual void SetNumThreads(int nthreads) { m_num_threads = nthreads; }
 
     /// After the Run() has completed, you can call this function to
     /// fill a 'contact container', that is an object inherited from class
@@ -186,6 +189,36 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Recover results from RayHitBatch() raycasting, in structure-of-arrays layout (one entry per ray).
+    struct ChApi ChRayhitResults {
+        std::vector<char> hit;                     ///< if nonzero, there was an hit
+        std::vector<ChVector3d> abs_hitPoint;      ///< hit points in absolute space coordinates
+        std::vector<ChVector3d> abs_hitNormal;     ///< normals to surface in absolute space coordinates
+        std::vector<double> dist_factor;           ///< from 0 .. 1, the distances of hit points along the segments
+        std::vector<ChCollisionModel*> hitModel;   ///< pointers to intersected models
+
+        /// Resize all arrays for the given number of rays.
+        void Resize(size_t num_rays);
+
+        /// Set the results for the specified ray.
+        void Set(size_t i, const ChRayhitResult& result);
+    };
+
+    /// Perform ray-hit tests with the collision models for a batch of rays, from from[i] to to[i].
+    /// The rays are distributed over the number of threads set for collision detection (see SetNumThreads).
+    /// Returns the number of rays that hit a collision model.
+    /// The default implementation performs a separate ray-hit test for each ray.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const std::vector<ChVector3d>& to,
+                            ChRayhitResults& results) const;
+
+    /// Perform ray-hit tests with the collision models for a coherent packet of parallel rays, from from[i] to
+    /// from[i] + ray (for example, vertical rays cast into a terrain).
+    /// The rays are distributed over the number of threads set for collision detection (see SetNumThreads).
+    /// Returns the number of rays that hit a collision model.
+    /// The default implementation defers to the general batched version.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from, const ChVector3d& ray, ChRayhitResults& results) const;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -233,6 +266,7 @@ class ChApi ChCollisionSystem {
     bool m_initialized;
 
     ChSystem* m_system;  ///< associated Chrono system
+    int m_num_threads;   ///< number of threads for collision detection
 
     std::shared_ptr<BroadphaseCallback> broad_callback;    ///< user callback for each near-enough pair of shapes
     std::shared_ptr<NarrowphaseCallback> narrow_callback;  ///< user callback for each collision pair
@@ -30,6 +30,36 @@ cbtCollisionDispatcherMt::cbtCollisionDispatcherMt(cbtCollisionConfiguration* co
 {
 	m_batchUpdating = false;
 	m_grainSize = grainSize;  // iterations per task
+	m_threadManifoldPools.resize(BT_MAX_THREAD_COUNT, NULL);
+}
+
+cbtCollisionDispatcherMt::~cbtCollisionDispatcherMt()
+{
+	for (int i = 0; i < m_threadManifoldPools.size(); ++i)
+	{
+		if (m_threadManifoldPools[i])
+		{
+			m_threadManifoldPools[i]->~cbtPoolAllocator();
+			cbtAlignedFree(m_threadManifoldPools[i]);
+		}
+	}
+}
+
+// ***CHRONO*** return the manifold pool of the calling thread, creating it on first use.
+// Only the calling thread ever accesses its own slot, so no locking is needed here.
+cbtPoolAllocator* cbtCollisionDispatcherMt::getThreadManifoldPool()
+{
+	unsigned int threadIndex = cbtGetCurrentThreadIndex();
+	if (threadIndex >= (unsigned int)m_threadManifoldPools.size())
+		return NULL;
+
+	cbtPoolAllocator*& pool = m_threadManifoldPools[threadIndex];
+	if (!pool)
+	{
+		void* mem = cbtAlignedAlloc(sizeof(cbtPoolAllocator), 16);
+		pool = new (mem) cbtPoolAllocator(sizeof(cbtPersistentManifold), m_persistentManifoldPoolAllocator->getMaxCount());
+	}
+	return pool;
 }
 
 cbtPersistentManifold* cbtCollisionDispatcherMt::getNewManifold(const cbtCollisionObject* body0, const cbtCollisionObject* body1)
@@ -41,7 +71,15 @@ cbtPersistentManifold* cbtCollisionDispatcherMt::getNewManifold(const cbtCollisi
 
 	cbtScalar contactProcessingThreshold = cbtMin(body0->getContactProcessingThreshold(), body1->getContactProcessingThreshold());
 
-	void* mem = m_persistentManifoldPoolAllocator->allocate(sizeof(cbtPersistentManifold));
+	// ***CHRONO*** during batch updates, allocate from the pool of the calling thread
+	void* mem = NULL;
+	if (m_batchUpdating)
+	{
+		if (cbtPoolAllocator* pool = getThreadManifoldPool())
+			mem = pool->allocate(sizeof(cbtPersistentManifold));
+	}
+	if (NULL == mem)
+		mem = m_persistentManifoldPoolAllocator->allocate(sizeof(cbtPersistentManifold));
 	if (NULL == mem)
 	{
 		//we got a pool memory overflow, by default we fallback to dynamically allocate memory. If we require a contiguous contact pool then assert.
@@ -88,11 +126,18 @@ void cbtCollisionDispatcherMt::releaseManifold(cbtPersistentManifold* manifold)
 	if (m_persistentManifoldPoolAllocator->validPtr(manifold))
 	{
 		m_persistentManifoldPoolAllocator->freeMemory(manifold);
+		return;
 	}
-	else
+	// ***CHRONO*** the manifold may have been allocated from any of the per-thread pools
+	for (int i = 0; i < m_threadManifoldPools.size(); ++i)
 	{
-		cbtAlignedFree(manifold);
+		if (m_threadManifoldPools[i] && m_threadManifoldPools[i]->validPtr(manifold))
+		{
+			m_threadManifoldPools[i]->freeMemory(manifold);
+			return;
+		}
 	}
+	cbtAlignedFree(manifold);
 }
 
 struct CollisionDispatcherUpdater : public cbtIParallelForBody
@@ -23,6 +23,7 @@ class cbtCollisionDispatcherMt : public cbtCollisionDispatcher
 {
 public:
 	cbtCollisionDispatcherMt(cbtCollisionConfiguration* config, int grainSize = 40);
+	virtual ~cbtCollisionDispatcherMt();
 
 	virtual cbtPersistentManifold* getNewManifold(const cbtCollisionObject* body0, const cbtCollisionObject* body1) BT_OVERRIDE;
 	virtual void releaseManifold(cbtPersistentManifold* manifold) BT_OVERRIDE;
@@ -32,6 +33,11 @@ public:
 protected:
 	bool m_batchUpdating;
 	int m_grainSize;
+
+	// ***CHRONO*** per-thread manifold pools, used during batch updates to avoid contention on the shared pool
+	cbtAlignedObjectArray<cbtPoolAllocator*> m_threadManifoldPools;
+
+	cbtPoolAllocator* getThreadManifoldPool();
 };
 
 #endif  //BT_COLLISION_DISPATCHER_MT_H
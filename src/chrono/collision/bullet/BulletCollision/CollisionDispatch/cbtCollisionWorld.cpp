@@ -33,6 +33,7 @@ subject to the following restrictions:
 #include "BulletCollision/CollisionShapes/cbtCEtriangleShape.h" //***CHRONO***
 #include "LinearMath/cbtAabbUtil2.h"
 #include "LinearMath/cbtQuickprof.h"
+#include "LinearMath/cbtThreads.h"  //***CHRONO***
 #include "LinearMath/cbtSerializer.h"
 #include "BulletCollision/CollisionShapes/cbtConvexPolyhedron.h"
 #include "BulletCollision/CollisionDispatch/cbtCollisionObjectWrapper.h"
@@ -154,6 +155,12 @@ void cbtCollisionWorld::addCollisionObject(cbtCollisionObject* collisionObject,
 void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 {
 	cbtVector3 minAabb, maxAabb;
+	computeSingleAabb(colObj, minAabb, maxAabb);
+	setSingleAabb(colObj, minAabb, maxAabb);
+}
+
+void cbtCollisionWorld::computeSingleAabb(cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb)
+{
 	colObj->getCollisionShape()->getAabb(colObj->getWorldTransform(), minAabb, maxAabb);
 	//need to increase the aabb for contact thresholds
 	cbtVector3 contactThreshold(gContactBreakingThreshold, gContactBreakingThreshold, gContactBreakingThreshold);
@@ -170,7 +177,10 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 		minAabb.setMin(minAabb2);
 		maxAabb.setMax(maxAabb2);
 	}
+}
 
+void cbtCollisionWorld::setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb)
+{
 	cbtBroadphaseInterface* bp = (cbtBroadphaseInterface*)m_broadphasePairCache;
 
 	//moving objects should be moderately sized, probably something wrong if not
@@ -196,20 +206,62 @@ void cbtCollisionWorld::updateSingleAabb(cbtCollisionObject* colObj)
 	}
 }
 
+// ***CHRONO*** parallel loop body for the AABB calculation in updateAabbs
+struct UpdateAabbsLoop : public cbtIParallelForBody
+{
+	cbtCollisionWorld* m_world;
+	cbtCollisionObject* const* m_objects;
+	cbtVector3* m_aabbMin;
+	cbtVector3* m_aabbMax;
+	char* m_flags;
+	bool m_forceUpdate;
+
+	void forLoop(int iBegin, int iEnd) const
+	{
+		for (int i = iBegin; i < iEnd; ++i)
+		{
+			cbtCollisionObject* colObj = m_objects[i];
+			//only update aabb of active objects
+			m_flags[i] = (m_forceUpdate || colObj->isActive()) ? 1 : 0;
+			if (m_flags[i])
+				m_world->computeSingleAabb(colObj, m_aabbMin[i], m_aabbMax[i]);
+		}
+	}
+};
+
 void cbtCollisionWorld::updateAabbs()
 {
 	BT_PROFILE("updateAabbs");
 
-	cbtTransform predictedTrans;
-	for (int i = 0; i < m_collisionObjects.size(); i++)
+	// ***CHRONO*** calculate the AABBs concurrently, then update the broadphase sequentially
+	int numObjects = m_collisionObjects.size();
+	if (numObjects == 0)
+		return;
+
+	m_updateAabbMin.resizeNoInitialize(numObjects);
+	m_updateAabbMax.resizeNoInitialize(numObjects);
+	m_updateAabbFlag.resizeNoInitialize(numObjects);
+
+	UpdateAabbsLoop loop;
+	loop.m_world = this;
+	loop.m_objects = &m_collisionObjects[0];
+	loop.m_aabbMin = &m_updateAabbMin[0];
+	loop.m_aabbMax = &m_updateAabbMax[0];
+	loop.m_flags = &m_updateAabbFlag[0];
+	loop.m_forceUpdate = m_forceUpdateAllAabbs;
+	if (cbtGetTaskScheduler())
+		cbtParallelFor(0, numObjects, 64, loop);
+	else
+		loop.forLoop(0, numObjects);
+
+	for (int i = 0; i < numObjects; i++)
 	{
 		cbtCollisionObject* colObj = m_collisionObjects[i];
 		cbtAssert(colObj->getWorldArrayIndex() == i);
 
-		//only update aabb of active objects
-		if (m_forceUpdateAllAabbs || colObj->isActive())
+		if (m_updateAabbFlag[i])
 		{
-			updateSingleAabb(colObj);
+			setSingleAabb(colObj, m_updateAabbMin[i], m_updateAabbMax[i]);
 		}
 	}
 }
@@ -102,6 +102,11 @@ protected:
 	///it is true by default, because it is error-prone (setting the position of static objects wouldn't update their AABB)
 	bool m_forceUpdateAllAabbs;
 
+	// ***CHRONO*** per-object AABBs computed concurrently in updateAabbs, before updating the broadphase
+	cbtAlignedObjectArray<cbtVector3> m_updateAabbMin;
+	cbtAlignedObjectArray<cbtVector3> m_updateAabbMax;
+	cbtAlignedObjectArray<char> m_updateAabbFlag;
+
 	void serializeCollisionObjects(cbtSerializer* serializer);
 
 	void serializeContactManifolds(cbtSerializer* serializer);
@@ -144,6 +149,10 @@ public:
 
 	void updateSingleAabb(cbtCollisionObject* colObj);
 
+	// ***CHRONO*** split updateSingleAabb into the (thread-safe) AABB calculation and the broadphase update
+	void computeSingleAabb(cbtCollisionObject* colObj, cbtVector3& minAabb, cbtVector3& maxAabb);
+	void setSingleAabb(cbtCollisionObject* colObj, const cbtVector3& minAabb, const cbtVector3& maxAabb);
+
 	virtual void updateAabbs();
 
 	///the computeOverlappingPairs is usually already called by performDiscreteCollisionDetection (or stepSimulation)
@@ -45,7 +45,8 @@ CH_UPCASTING(ChCollisionModelBullet, ChCollisionModelImpl)
 // -----------------------------------------------------------------------------
 
 ChCollisionModelBullet::ChCollisionModelBullet(ChCollisionModel* collision_model)
-    : ChCollisionModelImpl(collision_model) {
+    : ChCollisionModelImpl(collision_model), m_cache_moved(true) {
+    m_cache_frame.setIdentity();
     bt_collision_object = std::unique_ptr<cbtCollisionObject>(new cbtCollisionObject);
     bt_collision_object->setCollisionShape(nullptr);
     bt_collision_object->setUserPointer((void*)this);
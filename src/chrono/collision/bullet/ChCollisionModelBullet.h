@@ -89,6 +89,9 @@ class ChApi ChCollisionModelBullet : public ChCollisionModelImpl {
     std::vector<std::shared_ptr<cbtCollisionShape>> m_bt_shapes;  ///< list of Bullet collision shapes in model
     std::vector<std::shared_ptr<ChCollisionShape>> m_shapes;      ///< extended list of collision shapes
 
+    cbtTransform m_cache_frame;  ///< reference frame for contact caching (frame at the last full narrowphase)
+    bool m_cache_moved;          ///< true if the model requires a full narrowphase in this step
+
     friend class ChCollisionSystemBullet;
     friend class ChCollisionSystemBulletMulticore;
     friend class chrono::fea::ChContactSurfaceMesh;
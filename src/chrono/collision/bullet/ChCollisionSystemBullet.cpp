@@ -13,6 +13,8 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
@@ -37,7 +39,14 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet()
+    : m_debug_drawer(nullptr),
+      m_cache_contacts(false),
+      m_cache_lin_threshold(1e-4),
+      m_cache_ang_threshold(1e-3),
+      m_cache_vel_threshold(1e-3),
+      m_cache_refresh_interval(10),
+      m_cache_step(0) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -128,7 +137,77 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
     cbtAlignedFree(m_tmp_mem);
 }
 
+void ChCollisionSystemBullet::SetBroadphaseType(BroadphaseType type, const ChAABB& world_bounds, int max_objects) {
+    if (!bt_models.empty())
+        throw std::runtime_error("ChCollisionSystemBullet::SetBroadphaseType called after adding collision models.");
+
+    cbtBroadphaseInterface* broadphase = nullptr;
+    switch (type) {
+        case BroadphaseType::DBVT:
+            broadphase = new cbtDbvtBroadphase();
+            break;
+        case BroadphaseType::SAP: {
+            if (world_bounds.IsInverted())
+                throw std::invalid_argument("ChCollisionSystemBullet::SetBroadphaseType: invalid SAP world bounds.");
+            cbtVector3 aabbMin((cbtScalar)world_bounds.min.x(), (cbtScalar)world_bounds.min.y(),
+                               (cbtScalar)world_bounds.min.z());
+            cbtVector3 aabbMax((cbtScalar)world_bounds.max.x(), (cbtScalar)world_bounds.max.y(),
+                               (cbtScalar)world_bounds.max.z());
+            broadphase = new bt32BitAxisSweep3(aabbMin, aabbMax, (unsigned int)max_objects);
+            break;
+        }
+    }
+
+    bt_collision_world->setBroadphase(broadphase);
+    delete bt_broadphase;
+    bt_broadphase = broadphase;
+}
+
+void ChCollisionSystemBullet::EnableContactCaching(bool val,
+                                                   double lin_threshold,
+                                                   double ang_threshold,
+                                                   double vel_threshold,
+                                                   int refresh_interval) {
+    m_cache_contacts = val;
+    m_cache_lin_threshold = lin_threshold;
+    m_cache_ang_threshold = ang_threshold;
+    m_cache_vel_threshold = vel_threshold;
+    m_cache_refresh_interval = std::max(refresh_interval, 1);
+    m_cache_step = 0;
+
+    // Force a full narrowphase at the next collision detection
+    for (auto& model : bt_models)
+        model->m_cache_moved = true;
+
+    bt_dispatcher->setNearCallback(val ? &ChCollisionSystemBullet::CachingNearCallback
+                                       : &cbtCollisionDispatcher::defaultNearCallback);
+}
+
+void ChCollisionSystemBullet::CachingNearCallback(cbtBroadphasePair& pair,
+                                                  cbtCollisionDispatcher& dispatcher,
+                                                  const cbtDispatcherInfo& info) {
+    if (pair.m_algorithm) {
+        auto objA = static_cast<cbtCollisionObject*>(pair.m_pProxy0->m_clientObject);
+        auto objB = static_cast<cbtCollisionObject*>(pair.m_pProxy1->m_clientObject);
+        auto modelA = static_cast<ChCollisionModelBullet*>(objA->getUserPointer());
+        auto modelB = static_cast<ChCollisionModelBullet*>(objB->getUserPointer());
+        if (modelA && modelB && !modelA->m_cache_moved && !modelB->m_cache_moved) {
+            // Refresh the cached contact points for the current positions of the two models
+            cbtManifoldArray manifolds;
+            pair.m_algorithm->getAllContactManifolds(manifolds);
+            for (int i = 0; i < manifolds.size(); i++) {
+                manifolds[i]->refreshContactPoints(manifolds[i]->getBody0()->getWorldTransform(),
+                                                   manifolds[i]->getBody1()->getWorldTransform());
+            }
+            return;
+        }
+    }
+
+    cbtCollisionDispatcher::defaultNearCallback(pair, dispatcher, info);
+}
+
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    ChCollisionSystem::SetNumThreads(nthreads);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -185,9 +264,56 @@ void ChCollisionSystemBullet::Remove(ChCollisionModelBullet* bt_model, bool eras
 }
 
 void ChCollisionSystemBullet::Run() {
-    if (bt_collision_world) {
-        bt_collision_world->performDiscreteCollisionDetection();
+    if (!bt_collision_world)
+        return;
+
+    // With contact caching, flag the models which moved beyond the thresholds since their reference frame or which
+    // are not at rest. Periodically flag all models, so that cached contacts are never stale for more than a few steps.
+    if (m_cache_contacts) {
+        double lin_threshold2 = m_cache_lin_threshold * m_cache_lin_threshold;
+        double cos_threshold = std::cos(m_cache_ang_threshold);
+        double vel_threshold2 = m_cache_vel_threshold * m_cache_vel_threshold;
+        bool refresh = (m_cache_step == 0);
+        m_cache_step = (m_cache_step + 1) % m_cache_refresh_interval;
+        int num_models = (int)bt_models.size();
+
+#pragma omp parallel for num_threads(m_num_threads)
+        for (int i = 0; i < num_models; i++) {
+            auto& model = bt_models[i];
+
+            // Only models attached to a single frame can be cached (not those of deformable contact surfaces)
+            auto contactable = model->GetContactable();
+            if (!dynamic_cast<ChContactable_1vars<6>*>(contactable) &&
+                !dynamic_cast<ChContactable_1vars<3>*>(contactable)) {
+                model->m_cache_moved = true;
+                continue;
+            }
+
+            const auto& frame = model->bt_collision_object->getWorldTransform();
+            const auto& ref = model->m_cache_frame;
+
+            if (refresh) {
+                model->m_cache_moved = true;
+                model->m_cache_frame = frame;
+                continue;
+            }
+
+            // Rotation angle between the two frames, from the trace of the relative rotation matrix
+            cbtMatrix3x3 rel = ref.getBasis().transposeTimes(frame.getBasis());
+            double cos_angle = 0.5 * ((double)rel[0][0] + (double)rel[1][1] + (double)rel[2][2] - 1);
+            double dist2 = (double)(frame.getOrigin() - ref.getOrigin()).length2();
+
+            const auto& origin = frame.getOrigin();
+            ChVector3d pos((double)origin.x(), (double)origin.y(), (double)origin.z());
+            double vel2 = contactable->GetContactPointSpeed(pos).Length2();
+
+            model->m_cache_moved = dist2 > lin_threshold2 || cos_angle < cos_threshold || vel2 > vel_threshold2;
+            if (model->m_cache_moved)
+                model->m_cache_frame = frame;
+        }
     }
+
+    bt_collision_world->performDiscreteCollisionDetection();
 }
 
 ChAABB ChCollisionSystemBullet::GetBoundingBox() const {
@@ -343,17 +469,22 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
 
     this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
 
-    if (rayCallback.hasHit()) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
+    return LoadRayhitResult(rayCallback, result);
+}
+
+bool ChCollisionSystemBullet::LoadRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& callback,
+                                               ChRayhitResult& result) const {
+    if (callback.hasHit()) {
+        auto bt_model = static_cast<ChCollisionModelBullet*>(callback.m_collisionObject->getUserPointer());
         result.hitModel = bt_model->model;
         if (result.hitModel) {
             result.hit = true;
-            result.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
-                                    rayCallback.m_hitPointWorld.z());
-            result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
-                                     rayCallback.m_hitNormalWorld.z());
+            result.abs_hitPoint.Set(callback.m_hitPointWorld.x(), callback.m_hitPointWorld.y(),
+                                    callback.m_hitPointWorld.z());
+            result.abs_hitNormal.Set(callback.m_hitNormalWorld.x(), callback.m_hitNormalWorld.y(),
+                                     callback.m_hitNormalWorld.z());
             result.abs_hitNormal.Normalize();
-            result.dist_factor = rayCallback.m_closestHitFraction;
+            result.dist_factor = callback.m_closestHitFraction;
             result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
             return true;
         }
@@ -362,6 +493,132 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     return false;
 }
 
+// Broadphase callback collecting all collision objects with AABB overlapping a given box.
+class RayPacketCandidates : public cbtBroadphaseAabbCallback {
+  public:
+    virtual bool process(const cbtBroadphaseProxy* proxy) override {
+        objects.push_back(static_cast<cbtCollisionObject*>(proxy->m_clientObject));
+        return true;
+    }
+
+    std::vector<cbtCollisionObject*> objects;
+};
+
+int ChCollisionSystemBullet::RayHitBatch(const std::vector<ChVector3d>& from,
+                                         const ChVector3d& ray,
+                                         ChRayhitResults& results) const {
+    if (ray.Length2() == 0)
+        return ChCollisionSystem::RayHitBatch(from, ray, results);
+
+    int num_rays = (int)from.size();
+    results.Resize(num_rays);
+    if (num_rays == 0)
+        return 0;
+
+    // Query the broadphase once, with the bounding box of the entire packet
+    cbtVector3 btray((cbtScalar)ray.x(), (cbtScalar)ray.y(), (cbtScalar)ray.z());
+    cbtVector3 pmin(BT_LARGE_FLOAT, BT_LARGE_FLOAT, BT_LARGE_FLOAT);
+    cbtVector3 pmax(-BT_LARGE_FLOAT, -BT_LARGE_FLOAT, -BT_LARGE_FLOAT);
+    for (const auto& f : from) {
+        cbtVector3 btfrom((cbtScalar)f.x(), (cbtScalar)f.y(), (cbtScalar)f.z());
+        pmin.setMin(btfrom);
+        pmin.setMin(btfrom + btray);
+        pmax.setMax(btfrom);
+        pmax.setMax(btfrom + btray);
+    }
+
+    RayPacketCandidates candidates;
+    bt_collision_world->getBroadphase()->aabbTest(pmin, pmax, candidates);
+    int num_candidates = (int)candidates.objects.size();
+
+    // Project the ray origins on the plane orthogonal to the ray direction and find their range
+    ChVector3d dir, u, v;
+    ray.GetDirectionAxesAsX(dir, u, v);
+    double umin = std::numeric_limits<double>::max();
+    double vmin = std::numeric_limits<double>::max();
+    double umax = std::numeric_limits<double>::lowest();
+    double vmax = std::numeric_limits<double>::lowest();
+    for (const auto& f : from) {
+        umin = std::min(umin, Vdot(f, u));
+        vmin = std::min(vmin, Vdot(f, v));
+        umax = std::max(umax, Vdot(f, u));
+        vmax = std::max(vmax, Vdot(f, v));
+    }
+
+    // Bin the candidate objects in a grid over the projection plane, based on the projection of their AABBs
+    int n = std::max(1, (int)std::ceil(std::sqrt((double)num_candidates)));
+    double du = std::max((umax - umin) / n, 1e-12);
+    double dv = std::max((vmax - vmin) / n, 1e-12);
+    auto cell_index = [&](double pu, double pv, int& iu, int& iv) {
+        iu = std::min(std::max((int)std::floor((pu - umin) / du), 0), n - 1);
+        iv = std::min(std::max((int)std::floor((pv - vmin) / dv), 0), n - 1);
+    };
+
+    std::vector<std::vector<cbtCollisionObject*>> cells(n * n);
+    for (auto obj : candidates.objects) {
+        const auto& amin = obj->getBroadphaseHandle()->m_aabbMin;
+        const auto& amax = obj->getBroadphaseHandle()->m_aabbMax;
+        double cumin = std::numeric_limits<double>::max();
+        double cvmin = std::numeric_limits<double>::max();
+        double cumax = std::numeric_limits<double>::lowest();
+        double cvmax = std::numeric_limits<double>::lowest();
+        for (int k = 0; k < 8; k++) {
+            ChVector3d corner((k & 1) ? amax.x() : amin.x(), (k & 2) ? amax.y() : amin.y(),
+                              (k & 4) ? amax.z() : amin.z());
+            cumin = std::min(cumin, Vdot(corner, u));
+            cvmin = std::min(cvmin, Vdot(corner, v));
+            cumax = std::max(cumax, Vdot(corner, u));
+            cvmax = std::max(cvmax, Vdot(corner, v));
+        }
+        if (cumax < umin || cumin > umax || cvmax < vmin || cvmin > vmax)
+            continue;
+        int iu1, iv1, iu2, iv2;
+        cell_index(cumin, cvmin, iu1, iv1);
+        cell_index(cumax, cvmax, iu2, iv2);
+        for (int iv = iv1; iv <= iv2; iv++)
+            for (int iu = iu1; iu <= iu2; iu++)
+                cells[iv * n + iu].push_back(obj);
+    }
+
+    // Test each ray against the candidates in its bin
+    int num_hits = 0;
+#pragma omp parallel for num_threads(m_num_threads) reduction(+ : num_hits)
+    for (int i = 0; i < num_rays; i++) {
+        cbtVector3 btfrom((cbtScalar)from[i].x(), (cbtScalar)from[i].y(), (cbtScalar)from[i].z());
+        cbtVector3 btto = btfrom + btray;
+        cbtVector3 rmin = btfrom;
+        cbtVector3 rmax = btfrom;
+        rmin.setMin(btto);
+        rmax.setMax(btto);
+
+        cbtTransform from_trans(cbtMatrix3x3::getIdentity(), btfrom);
+        cbtTransform to_trans(cbtMatrix3x3::getIdentity(), btto);
+
+        cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+        rayCallback.m_collisionFilterGroup = cbtBroadphaseProxy::DefaultFilter;
+        rayCallback.m_collisionFilterMask = cbtBroadphaseProxy::AllFilter;
+
+        int iu, iv;
+        cell_index(Vdot(from[i], u), Vdot(from[i], v), iu, iv);
+        for (auto obj : cells[iv * n + iu]) {
+            auto proxy = obj->getBroadphaseHandle();
+            if (!rayCallback.needsCollision(proxy))
+                continue;
+            if (!TestAabbAgainstAabb2(rmin, rmax, proxy->m_aabbMin, proxy->m_aabbMax))
+                continue;
+            cbtCollisionWorld::rayTestSingle(from_trans, to_trans, obj, obj->getCollisionShape(),
+                                             obj->getWorldTransform(), rayCallback);
+        }
+
+        ChRayhitResult result;
+        LoadRayhitResult(rayCallback, result);
+        results.Set(i, result);
+        num_hits += result.hit ? 1 : 0;
+    }
+
+    return num_hits;
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
                                      const ChVector3d& to,
                                      ChCollisionModel* model,
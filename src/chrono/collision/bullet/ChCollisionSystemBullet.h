@@ -49,7 +49,34 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// engine (custom data may be deallocated).
     // virtual void RemoveAll();
 
+    /// Broadphase algorithm.
+    enum class BroadphaseType {
+        DBVT,  ///< dynamic AABB tree (default)
+        SAP    ///< sweep and prune over sorted axis lists, within fixed world bounds
+    };
+
+    /// Set the broadphase algorithm.
+    /// This function must be called before any collision model is added to the collision system. The SAP broadphase
+    /// requires the bounds of the simulation domain (shapes outside these bounds are still processed, but less
+    /// efficiently) and preallocates storage for the specified maximum number of collision objects.
+    void SetBroadphaseType(BroadphaseType type, const ChAABB& world_bounds = ChAABB(), int max_objects = 65536);
+
+    /// Enable caching of contact manifolds for resting collision models (default: false).
+    /// If enabled, the narrowphase is skipped for a pair of collision models with existing contact manifolds if neither
+    /// model moved more than the specified thresholds (distance and rotation angle) since its last narrowphase and
+    /// neither model moves faster than the specified speed. The cached contact points of such pairs are only refreshed
+    /// for the current positions of the models. To prevent slow creep from accumulating on stale contact normals, a full
+    /// narrowphase is still performed for all pairs every 'refresh_interval' collision detection steps.
+    /// This reduces the cost of collision detection in scenes with many resting contacts (e.g., stacking).
+    void EnableContactCaching(bool val,
+                              double lin_threshold = 1e-4,
+                              double ang_threshold = 1e-3,
+                              double vel_threshold = 1e-3,
+                              int refresh_interval = 10);
+
     /// Set the number of OpenMP threads for collision detection.
+    /// If Bullet is compiled with OpenMP support, the AABB updates and the narrowphase processing of overlapping pairs
+    /// are distributed over the specified number of threads.
     virtual void SetNumThreads(int nthreads) override;
 
     /// Run the algorithm and finds all the contacts.
@@ -95,6 +122,15 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a coherent packet of parallel rays.
+    /// The broadphase is queried only once for the entire packet. The candidate collision objects are then binned in
+    /// a grid over the plane orthogonal to the ray direction, so that each ray is tested only against the objects
+    /// whose projection overlaps its own bin.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const ChVector3d& ray,
+                            ChRayhitResults& results) const override;
+    using ChCollisionSystem::RayHitBatch;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,10 +172,18 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Load the closest hit recorded by the given Bullet ray callback into the specified result.
+    bool LoadRayhitResult(const cbtCollisionWorld::ClosestRayResultCallback& callback, ChRayhitResult& result) const;
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
 
+    /// Near callback used with contact caching: skip the narrowphase for pairs of models that did not move.
+    static void CachingNearCallback(cbtBroadphasePair& pair,
+                                    cbtCollisionDispatcher& dispatcher,
+                                    const cbtDispatcherInfo& info);
+
     std::vector<std::shared_ptr<ChCollisionModelBullet>> bt_models;
 
     cbtCollisionConfiguration* bt_collision_configuration;
@@ -162,6 +206,13 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    bool m_cache_contacts;         ///< skip narrowphase for pairs of models that did not move
+    double m_cache_lin_threshold;  ///< distance below which a model is not considered moving
+    double m_cache_ang_threshold;  ///< rotation angle below which a model is not considered moving
+    double m_cache_vel_threshold;  ///< speed below which a model is not considered moving
+    int m_cache_refresh_interval;  ///< number of steps between forced full narrowphase passes
+    int m_cache_step;              ///< number of collision detection steps since the last full narrowphase
+
     friend class ChCollisionModelBullet;
 };
 
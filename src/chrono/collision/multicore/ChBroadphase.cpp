@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cmath>
 
 #include "chrono/multicore_math/thrust.h"
 
@@ -25,6 +26,7 @@
 #include <thrust/transform.h>
 #include <thrust/transform_reduce.h>
 #include <thrust/sort.h>
+#include <thrust/count.h>
 #include <thrust/sequence.h>
 #include <thrust/iterator/constant_iterator.h>
 
@@ -40,6 +42,10 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      incremental(false),
+      grid_margin(0.1),
+      grid_frozen(false),
+      frozen_num_shapes(0),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -199,6 +205,10 @@ void ChBroadphase::ComputeTopLevelResolution() {
             break;
         case GridType::FIXED_DENSITY:
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            break;
+        case GridType::ADAPTIVE:
+            bins_per_axis = ComputeAdaptiveResolution(diag);
+            break;
     }
 
     // Calculate actual bin dimension
@@ -208,25 +218,266 @@ void ChBroadphase::ComputeTopLevelResolution() {
     cd_data->inv_bin_size = 1.0 / cd_data->bin_size;
 }
 
+// Determine a grid resolution with roughly 'grid_density' shapes per non-empty bin.
+// Starting from a uniform estimate over the entire domain, the shape AABB centers are binned and the grid is refined
+// by the ratio of the actual mean occupancy of non-empty bins to the target density. For strongly non-uniform shape
+// distributions (e.g., a dense pile in a large, mostly empty domain), this results in much smaller bins than
+// GridType::FIXED_DENSITY. The total number of bins is capped to limit the memory used for empty bins.
+vec3 ChBroadphase::ComputeAdaptiveResolution(const real3& diag) const {
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    const double max_bins = std::max(64.0 * num_shapes, 1000.0);
+
+    vec3 res = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+    if (num_shapes == 0 || diag.x <= 0 || diag.y <= 0 || diag.z <= 0)
+        return res;
+
+    for (int pass = 0; pass < 2; pass++) {
+        real3 inv_size = real3(res.x, res.y, res.z) / diag;
+        std::vector<uint> bin_count((size_t)res.x * res.y * res.z, 0);
+
+        // Count active shapes and non-empty bins
+        uint num_active = 0;
+        uint num_occupied = 0;
+        for (int i = 0; i < num_shapes; i++) {
+            if (obj_data_id[i] == UINT_MAX)
+                continue;
+            real3 center = 0.5 * (aabb_min[i] + aabb_max[i]);
+            vec3 bin = Clamp(HashMin(center, inv_size), vec3(0, 0, 0), res - vec3(1, 1, 1));
+            if (bin_count[Hash_Index(bin, res)]++ == 0)
+                num_occupied++;
+            num_active++;
+        }
+        if (num_occupied == 0)
+            break;
+
+        // Refinement factor, limited by the maximum number of bins
+        double num_bins = (double)res.x * res.y * res.z;
+        double factor = std::cbrt(num_active / (num_occupied * grid_density));
+        factor = std::min(factor, std::cbrt(max_bins / num_bins));
+        if (factor < 1.1)
+            break;
+
+        res = vec3(std::max((int)(res.x * factor), 1), std::max((int)(res.y * factor), 1),
+                   std::max((int)(res.z * factor), 1));
+    }
+
+    return res;
+}
+
+// Check whether the grid built in a previous call can be reused.
+// This is the case if the grid settings and number of shapes did not change and all AABBs are inside the grid domain.
+bool ChBroadphase::ReuseGrid() const {
+    if (!grid_frozen || frozen_num_shapes != cd_data->num_rigid_shapes || frozen_type != grid_type)
+        return false;
+
+    switch (grid_type) {
+        case GridType::FIXED_RESOLUTION:
+            if (frozen_resolution.x != grid_resolution.x || frozen_resolution.y != grid_resolution.y ||
+                frozen_resolution.z != grid_resolution.z)
+                return false;
+            break;
+        case GridType::FIXED_BIN_SIZE:
+            if (frozen_bin_size.x != bin_size.x || frozen_bin_size.y != bin_size.y || frozen_bin_size.z != bin_size.z)
+                return false;
+            break;
+        case GridType::FIXED_DENSITY:
+        case GridType::ADAPTIVE:
+            if (frozen_density != grid_density)
+                return false;
+            break;
+    }
+
+    const real3& min_point = cd_data->min_bounding_point;
+    const real3& max_point = cd_data->max_bounding_point;
+    return min_point.x >= frozen_min.x && min_point.y >= frozen_min.y && min_point.z >= frozen_min.z &&
+           max_point.x <= frozen_max.x && max_point.y <= frozen_max.y && max_point.z <= frozen_max.z;
+}
+
+// Inflate the current grid domain and cache the grid settings for use in subsequent calls.
+void ChBroadphase::FreezeGrid() {
+    real3& min_point = cd_data->min_bounding_point;
+    real3& max_point = cd_data->max_bounding_point;
+
+    // Do not freeze a degenerate grid (no colliding shapes)
+    if (min_point.x > max_point.x || min_point.y > max_point.y || min_point.z > max_point.z) {
+        grid_frozen = false;
+        return;
+    }
+
+    real3 margin = grid_margin * (max_point - min_point);
+    min_point = min_point - margin;
+    max_point = max_point + margin;
+    cd_data->global_origin = min_point;
+
+    grid_frozen = true;
+    frozen_num_shapes = cd_data->num_rigid_shapes;
+    frozen_type = grid_type;
+    frozen_resolution = grid_resolution;
+    frozen_bin_size = bin_size;
+    frozen_density = grid_density;
+    frozen_min = min_point;
+    frozen_max = max_point;
+}
+
 // -----------------------------------------------------------------------------
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    // Compute overall AABB
     DetermineBoundingBox();
+
+    // In incremental mode, keep using the current grid for as long as it encloses all AABBs
+    bool reuse_grid = false;
+    if (incremental) {
+        reuse_grid = ReuseGrid();
+        if (reuse_grid) {
+            cd_data->min_bounding_point = frozen_min;
+            cd_data->max_bounding_point = frozen_max;
+            cd_data->global_origin = frozen_min;
+        } else {
+            FreezeGrid();
+        }
+    } else {
+        grid_frozen = false;
+    }
+
+    // Offset all AABBs
     OffsetAABB();
 
     // Determine resolution of the top level grid
-    ComputeTopLevelResolution();
+    if (reuse_grid) {
+        cd_data->bins_per_axis = frozen_bins_per_axis;
+        cd_data->bin_size = (frozen_max - frozen_min) /
+                            real3(frozen_bins_per_axis.x, frozen_bins_per_axis.y, frozen_bins_per_axis.z);
+        cd_data->inv_bin_size = 1.0 / cd_data->bin_size;
+    } else {
+        ComputeTopLevelResolution();
+        frozen_bins_per_axis = cd_data->bins_per_axis;
+    }
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        OneLevelBroadphase(reuse_grid);
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
 }
 
-void ChBroadphase::OneLevelBroadphase() {
+// Number of bins in the range [gmin, gmax] (an empty range is used for inactive shapes).
+static inline uint NumBins(const vec3& gmin, const vec3& gmax) {
+    if (gmax.x < gmin.x || gmax.y < gmin.y || gmax.z < gmin.z)
+        return 0;
+    return (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
+}
+
+// Encode the bin-shape intersections for the specified shape as (bin << 32) | shape.
+static inline void StoreBinKeys(uint shape,
+                                const vec3& gmin,
+                                const vec3& gmax,
+                                const vec3& bins_per_axis,
+                                unsigned long long* keys) {
+    for (int i = gmin.x; i <= gmax.x; i++) {
+        for (int j = gmin.y; j <= gmax.y; j++) {
+            for (int k = gmin.z; k <= gmax.z; k++) {
+                unsigned long long bin = Hash_Index(vec3(i, j, k), bins_per_axis);
+                *keys++ = (bin << 32) | shape;
+            }
+        }
+    }
+}
+
+// Update the sorted list of bin - shape AABB intersections (incremental mode).
+// With a reused grid, only the entries of shapes that moved to a different range of bins are removed and regenerated;
+// the new entries are sorted and merged with the (already sorted) remaining ones. For scenes where most shapes stay in
+// the same bins, this replaces the global sort with a linear pass.
+void ChBroadphase::UpdateBinIntersections(bool rebuild) {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<uint>& bin_intersections = cd_data->bin_intersections;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+
+    if ((int)shape_bin_min.size() != num_shapes)
+        rebuild = true;
+
+    shape_bin_min.resize(num_shapes);
+    shape_bin_max.resize(num_shapes);
+    shape_bin_changed.resize(num_shapes);
+    bin_intersections.resize(num_shapes + 1);
+    bin_intersections[num_shapes] = 0;
+
+    // Find the range of bins intersected by each shape AABB and flag the shapes with a modified range
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        vec3 gmin(0, 0, 0);
+        vec3 gmax(-1, -1, -1);
+        if (obj_data_id[i] != UINT_MAX) {
+            gmin = HashMin(aabb_min[i], inv_bin_size);
+            gmax = HashMax(aabb_max[i], inv_bin_size);
+        }
+        const vec3& old_min = shape_bin_min[i];
+        const vec3& old_max = shape_bin_max[i];
+        shape_bin_changed[i] = rebuild || gmin.x != old_min.x || gmin.y != old_min.y || gmin.z != old_min.z ||
+                               gmax.x != old_max.x || gmax.y != old_max.y || gmax.z != old_max.z;
+        shape_bin_min[i] = gmin;
+        shape_bin_max[i] = gmax;
+        bin_intersections[i] = shape_bin_changed[i] ? NumBins(gmin, gmax) : 0;
+    }
+
+    // Number of new bin - shape AABB intersections (only for shapes with modified bin ranges)
+    Thrust_Exclusive_Scan(bin_intersections);
+    uint num_new = bin_intersections.back();
+
+    if (rebuild) {
+        // Generate and sort all entries
+        bin_keys.resize(num_new);
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            StoreBinKeys(i, shape_bin_min[i], shape_bin_max[i], bins_per_axis, bin_keys.data() + bin_intersections[i]);
+        }
+        Thrust_Sort(bin_keys);
+    } else if (Thrust_Count(shape_bin_changed, 1) > 0) {
+        // Remove entries of shapes with modified bin ranges (the remaining entries stay sorted)
+        auto end = std::remove_if(bin_keys.begin(), bin_keys.end(), [this](unsigned long long key) {
+            return shape_bin_changed[(uint)(key & 0xFFFFFFFF)] != 0;
+        });
+        size_t num_kept = end - bin_keys.begin();
+        bin_keys.resize(num_kept + num_new);
+
+        // Generate new entries at the end of the list
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            if (shape_bin_changed[i])
+                StoreBinKeys(i, shape_bin_min[i], shape_bin_max[i], bins_per_axis,
+                             bin_keys.data() + num_kept + bin_intersections[i]);
+        }
+
+        // Sort the new entries and merge them with the remaining ones
+        thrust::sort(THRUST_PAR bin_keys.begin() + num_kept, bin_keys.end());
+        std::inplace_merge(bin_keys.begin(), bin_keys.begin() + num_kept, bin_keys.end());
+    }
+
+    // Decode the sorted list into bin indices and shape IDs
+    cd_data->num_bin_aabb_intersections = (uint)bin_keys.size();
+    bin_number.resize(bin_keys.size());
+    bin_aabb_number.resize(bin_keys.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)bin_keys.size(); i++) {
+        bin_number[i] = (uint)(bin_keys[i] >> 32);
+        bin_aabb_number[i] = (uint)(bin_keys[i] & 0xFFFFFFFF);
+    }
+}
+
+void ChBroadphase::OneLevelBroadphase(bool reuse_grid) {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
     const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
 
@@ -255,39 +506,46 @@ void ChBroadphase::OneLevelBroadphase() {
 
     num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
-    bin_intersections.resize(num_shapes + 1);
-    bin_intersections[num_shapes] = 0;
+    if (incremental) {
+        // Update the sorted list of bin - shape AABB intersections, only for shapes that changed bins
+        UpdateBinIntersections(!reuse_grid);
+    } else {
+        bin_intersections.resize(num_shapes + 1);
+        bin_intersections[num_shapes] = 0;
 
-    // Count the number of bins intersected by each shape AABB -> bin_intersections
+        // Count the number of bins intersected by each shape AABB -> bin_intersections
 #pragma omp parallel for
-    for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX) {
-            bin_intersections[i] = 0;
-            continue;
+        for (int i = 0; i < num_shapes; i++) {
+            if (obj_data_id[i] == UINT_MAX) {
+                bin_intersections[i] = 0;
+                continue;
+            }
+            f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
         }
-        f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
-    }
 
-    // Calculate total number of bin - shape AABB intersections
-    Thrust_Exclusive_Scan(bin_intersections);
-    num_bin_aabb_intersections = bin_intersections.back();
+        // Calculate total number of bin - shape AABB intersections
+        Thrust_Exclusive_Scan(bin_intersections);
+        num_bin_aabb_intersections = bin_intersections.back();
 
-    bin_number.resize(num_bin_aabb_intersections);
-    bin_aabb_number.resize(num_bin_aabb_intersections);
-    bin_active.resize(num_bin_aabb_intersections);       // will be resized after calculation of num_active_bins
-    bin_start_index.resize(num_bin_aabb_intersections);  // will be resized after calculation of num_active_bins
+        bin_number.resize(num_bin_aabb_intersections);
+        bin_aabb_number.resize(num_bin_aabb_intersections);
 
-    // For each shape, store the bin index and the shape ID for intersections with this shape
+        // For each shape, store the bin index and the shape ID for intersections with this shape
 #pragma omp parallel for
-    for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
-            continue;
-        f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
-                                      bin_aabb_number);
+        for (int i = 0; i < num_shapes; i++) {
+            if (obj_data_id[i] == UINT_MAX)
+                continue;
+            f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections,
+                                          bin_number, bin_aabb_number);
+        }
+
+        Thrust_Sort_By_Key(bin_number, bin_aabb_number);
     }
 
+    bin_active.resize(num_bin_aabb_intersections);       // will be resized after calculation of num_active_bins
+    bin_start_index.resize(num_bin_aabb_intersections);  // will be resized after calculation of num_active_bins
+
     // Find the number of active bins (i.e. with at least one shape AABB intersection)
-    Thrust_Sort_By_Key(bin_number, bin_aabb_number);
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
     if (num_active_bins <= 0) {
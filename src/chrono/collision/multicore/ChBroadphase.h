@@ -33,7 +33,8 @@ class ChApi ChBroadphase {
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        ADAPTIVE           ///< user-specified density of shapes per non-empty bin (adapted to the shape distribution)
     };
 
     ChBroadphase();
@@ -43,19 +44,41 @@ class ChApi ChBroadphase {
     void Process();
 
   private:
-    void OneLevelBroadphase();
+    void OneLevelBroadphase(bool reuse_grid);
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
+    vec3 ComputeAdaptiveResolution(const real3& diag) const;
     void RigidBoundingBox();
     void FluidBoundingBox();
 
+    bool ReuseGrid() const;
+    void FreezeGrid();
+    void UpdateBinIntersections(bool rebuild);
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
-    real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY and ADAPTIVE)
+    bool incremental;      ///< (input) reuse grid and bin lists across calls, updating only shapes that changed bins
+    real grid_margin;      ///< (input) relative inflation of the grid domain (used in incremental mode)
+
+    // Data for incremental broadphase
+    bool grid_frozen;                          ///< a grid was built in incremental mode
+    int frozen_num_shapes;                     ///< number of shapes when the grid was built
+    GridType frozen_type;                      ///< grid type when the grid was built
+    vec3 frozen_resolution;                    ///< grid resolution setting when the grid was built
+    real3 frozen_bin_size;                     ///< bin size setting when the grid was built
+    real frozen_density;                       ///< grid density setting when the grid was built
+    real3 frozen_min;                          ///< LBR corner of the grid domain
+    real3 frozen_max;                          ///< RTF corner of the grid domain
+    vec3 frozen_bins_per_axis;                 ///< grid resolution
+    std::vector<vec3> shape_bin_min;           ///< [num_rigid_shapes] lower corner of bin range for each shape AABB
+    std::vector<vec3> shape_bin_max;           ///< [num_rigid_shapes] upper corner of bin range for each shape AABB
+    std::vector<char> shape_bin_changed;       ///< [num_rigid_shapes] flag for shapes with a modified bin range
+    std::vector<unsigned long long> bin_keys;  ///< sorted bin-shape intersections, encoded as (bin << 32) | shape
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
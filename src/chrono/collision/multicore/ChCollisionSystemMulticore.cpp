@@ -32,7 +32,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemMulticore)
 CH_UPCASTING(ChCollisionSystemMulticore, ChCollisionSystem)
 
-ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false) {
+ChCollisionSystemMulticore::ChCollisionSystemMulticore() : use_aabb_active(false), use_reaction_cache(true) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -64,10 +64,24 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::SetBroadphaseGridAdaptive(double density) {
+    broadphase.grid_density = real(density);
+    broadphase.grid_type = ChBroadphase::GridType::ADAPTIVE;
+}
+
+void ChCollisionSystemMulticore::EnableIncrementalBroadphase(bool val, double margin) {
+    broadphase.incremental = val;
+    broadphase.grid_margin = real(margin);
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemMulticore::SetDeterministicNarrowphase(bool val) {
+    narrowphase.deterministic = val;
+}
+
 void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_min, const ChVector3d& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -76,6 +90,7 @@ void ChCollisionSystemMulticore::EnableActiveBoundingBox(const ChVector3d& aabb_
 }
 
 void ChCollisionSystemMulticore::SetNumThreads(int nthreads) {
+    ChCollisionSystem::SetNumThreads(nthreads);
 #ifdef _OPENMP
     omp_set_num_threads(nthreads);
 #endif
@@ -335,6 +350,14 @@ void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
     const auto& sids = cd_data->contact_shapeIDs;          // global IDs of shapes in contact
     const auto& sindex = cd_data->shape_data.local_rigid;  // collision model indexes of shapes in contact
 
+    // The reaction cache of the previous step is searched for the contacts reported now. Entries of the current cache
+    // are referenced by the contacts until the next call, so the previous cache is the one recycled.
+    if (use_reaction_cache) {
+        std::swap(reaction_cache, reaction_cache_old);
+        reaction_cache.clear();
+    }
+    int pair_index = 0;
+
     // Loop over all current contacts, create the cinfo structure and add contact to the container.
     // Note that inclusions in the contact container cannot be done in parallel.
     for (uint i = 0; i < cd_data->num_rigid_contacts; i++) {
@@ -359,6 +382,19 @@ void ChCollisionSystemMulticore::ReportContacts(ChContactContainer* container) {
         cinfo.distance = cd_data->dpth_rigid_rigid[i];
         cinfo.eff_radius = cd_data->erad_rigid_rigid[i];
 
+        // Contacts of a given shape pair are contiguous; identify each contact by its index within the pair
+        pair_index = (i > 0 && sids[i] == sids[i - 1]) ? pair_index + 1 : 0;
+        if (use_reaction_cache) {
+            ReactionCacheKey key = {sids[i], pair_index};
+            auto& entry = reaction_cache[key];
+            auto old_entry = reaction_cache_old.find(key);
+            if (old_entry != reaction_cache_old.end())
+                entry = old_entry->second;
+            else
+                entry.fill(0);
+            cinfo.reaction_cache = entry.data();
+        }
+
         // Execute user custom callback, if any
         bool add_contact = true;
         if (this->narrow_callback)
@@ -600,6 +636,59 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
+int ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChVector3d>& from,
+                                            const std::vector<ChVector3d>& to,
+                                            ChRayhitResults& results) const {
+    assert(from.size() == to.size());
+    int num_rays = (int)from.size();
+    results.Resize(num_rays);
+
+    if (cd_data->num_active_bins == 0) {
+        std::fill(results.hit.begin(), results.hit.end(), 0);
+        std::fill(results.dist_factor.begin(), results.dist_factor.end(), 1.0);
+        std::fill(results.hitModel.begin(), results.hitModel.end(), nullptr);
+        return 0;
+    }
+
+    const auto& bodies = m_system->GetBodies();
+
+    int num_hits = 0;
+#pragma omp parallel num_threads(m_num_threads) reduction(+ : num_hits)
+    {
+        // One ray tester per thread, reused for all rays processed by that thread
+        ChRayTest tester(cd_data);
+        ChRayTest::RayHitInfo info;
+
+#pragma omp for
+        for (int i = 0; i < num_rays; i++) {
+            if (tester.Check(FromChVector(from[i]), FromChVector(to[i]), info)) {
+                uint bid = cd_data->shape_data.id_rigid[info.shapeID];
+                results.hit[i] = 1;
+                results.abs_hitNormal[i] = ToChVector(info.normal);
+                results.abs_hitPoint[i] = ToChVector(info.point);
+                results.dist_factor[i] = info.t;
+                results.hitModel[i] = bodies[bid]->GetCollisionModel().get();
+                num_hits++;
+            } else {
+                results.hit[i] = 0;
+                results.dist_factor[i] = 1;
+                results.hitModel[i] = nullptr;
+            }
+        }
+    }
+
+    return num_hits;
+}
+
+int ChCollisionSystemMulticore::RayHitBatch(const std::vector<ChVector3d>& from,
+                                            const ChVector3d& ray,
+                                            ChRayhitResults& results) const {
+    std::vector<ChVector3d> to(from.size());
+    for (size_t i = 0; i < from.size(); i++)
+        to[i] = from[i] + ray;
+    return RayHitBatch(from, to, results);
+}
+
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
                                         const ChVector3d& to,
                                         ChCollisionModel* model,
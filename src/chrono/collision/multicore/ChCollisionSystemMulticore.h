@@ -20,6 +20,9 @@
 #ifndef CH_COLLISION_SYSTEM_MULTICORE_H
 #define CH_COLLISION_SYSTEM_MULTICORE_H
 
+#include <array>
+#include <unordered_map>
+
 #include "chrono/core/ChTimer.h"
 
 #include "chrono/collision/ChCollisionSystem.h"
@@ -75,17 +78,40 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Set a variable number of grid bins, adapted to the distribution of collision shapes, such that there are roughly
+    /// `density` collision shapes per non-empty bin. For strongly non-uniform distributions (e.g., a dense pile in a
+    /// large, mostly empty domain) this results in smaller bins than SetBroadphaseGridDensity.
+    /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
+    void SetBroadphaseGridAdaptive(double density);
+
+    /// Enable/disable the incremental broadphase (default: false).
+    /// If enabled, the broadphase grid is kept fixed for as long as it encloses all shape AABBs (a new grid is inflated
+    /// by `margin` times the extents of the collision domain) and the bin lists are updated only for shapes that moved
+    /// to different bins. This is most effective for scenes where a large fraction of the shapes is at rest.
+    void EnableIncrementalBroadphase(bool val, double margin = 0.1);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable deterministic generation of rigid-rigid contacts (default: false).
+    /// If enabled, the list of contacts (and its ordering) reported by the narrowphase is bitwise identical regardless
+    /// of the number of OpenMP threads. Contacts are generated in canonical order, sorted by the IDs of the two shapes
+    /// in contact, using per-thread contact buffers.
+    void SetDeterministicNarrowphase(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
     void EnableActiveBoundingBox(const ChVector3d& aabb_min, const ChVector3d& aabb_max);
 
+    /// Enable caching of contact reactions across steps (default: true).
+    /// Contacts are identified by the pair of colliding shapes and their index among the contacts of that pair. The
+    /// cached reactions are used to warm start the solver for contacts stored in a ChContactContainerNSC.
+    void EnableReactionCache(bool val) { use_reaction_cache = val; }
+
     /// Get the dimensions of the "active" box.
     /// The return value indicates whether or not the active box feature is enabled.
     bool GetActiveBoundingBox(ChVector3d& aabb_min, ChVector3d& aabb_max) const;
@@ -127,6 +153,17 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// Currently not implemented.
     virtual bool RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests with all collision models for a batch of rays.
+    /// Each thread reuses a single ray tester for all rays it processes.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const std::vector<ChVector3d>& to,
+                            ChRayhitResults& results) const override;
+
+    /// Perform ray-hit tests with all collision models for a coherent packet of parallel rays.
+    virtual int RayHitBatch(const std::vector<ChVector3d>& from,
+                            const ChVector3d& ray,
+                            ChRayhitResults& results) const override;
+
     /// Perform a ray-hit test with the specified collision model.
     /// Currently not implemented.
     virtual bool RayHit(const ChVector3d& from,
@@ -180,6 +217,25 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
 
     ChTimer m_timer_broad;
     ChTimer m_timer_narrow;
+
+    /// Persistent identifier of a contact: pair of shape IDs and index among the contacts of that pair.
+    struct ReactionCacheKey {
+        long long shapeIDs;
+        int index;
+        bool operator==(const ReactionCacheKey& other) const {
+            return shapeIDs == other.shapeIDs && index == other.index;
+        }
+    };
+    struct ReactionCacheHash {
+        std::size_t operator()(const ReactionCacheKey& key) const {
+            return std::hash<long long>()(key.shapeIDs) ^ (std::hash<int>()(key.index) * 0x9e3779b9);
+        }
+    };
+    typedef std::unordered_map<ReactionCacheKey, std::array<float, 6>, ReactionCacheHash> ReactionCache;
+
+    bool use_reaction_cache;           ///< enable caching of contact reactions
+    ReactionCache reaction_cache;      ///< cached reactions of the contacts reported in the current step
+    ReactionCache reaction_cache_old;  ///< cached reactions of the contacts reported in the previous step
 };
 
 /// @} collision_mc
@@ -48,25 +48,25 @@ vec3 Compute_Grid_Resolution(uint num_aabb, const real3& d, real k) {
 // ONE AND TWO LEVEL FUNCTIONS==========================================================
 
 // Function to Count AABB Bin intersections.
-void f_Count_AABB_BIN_Intersection(const uint index,
-                                   const real3& inv_bin_size,
-                                   const std::vector<real3>& aabb_min,
-                                   const std::vector<real3>& aabb_max,
-                                   std::vector<uint>& bins_intersected) {
+CH_SIMD_CLONES void f_Count_AABB_BIN_Intersection(const uint index,
+                                                  const real3& inv_bin_size,
+                                                  const std::vector<real3>& aabb_min,
+                                                  const std::vector<real3>& aabb_max,
+                                                  std::vector<uint>& bins_intersected) {
     vec3 gmin = HashMin(aabb_min[index], inv_bin_size);
     vec3 gmax = HashMax(aabb_max[index], inv_bin_size);
     bins_intersected[index] = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
 }
 
 // Function to Store AABB Bin Intersections.
-void f_Store_AABB_BIN_Intersection(const uint index,
-                                   const vec3& bins_per_axis,
-                                   const real3& inv_bin_size,
-                                   const std::vector<real3>& aabb_min_data,
-                                   const std::vector<real3>& aabb_max_data,
-                                   const std::vector<uint>& bins_intersected,
-                                   std::vector<uint>& bin_number,
-                                   std::vector<uint>& aabb_number) {
+CH_SIMD_CLONES void f_Store_AABB_BIN_Intersection(const uint index,
+                                                  const vec3& bins_per_axis,
+                                                  const real3& inv_bin_size,
+                                                  const std::vector<real3>& aabb_min_data,
+                                                  const std::vector<real3>& aabb_max_data,
+                                                  const std::vector<uint>& bins_intersected,
+                                                  std::vector<uint>& bin_number,
+                                                  std::vector<uint>& aabb_number) {
     uint count = 0, i, j, k;
     vec3 gmin = HashMin(aabb_min_data[index], inv_bin_size);
     vec3 gmax = HashMax(aabb_max_data[index], inv_bin_size);
@@ -83,19 +83,19 @@ void f_Store_AABB_BIN_Intersection(const uint index,
 }
 
 // Function to count AABB AABB intersection.
-void f_Count_AABB_AABB_Intersection(const uint index,
-                                    const real3 inv_bin_size_vec,
-                                    const vec3 bins_per_axis,
-                                    const std::vector<real3>& aabb_min_data,
-                                    const std::vector<real3>& aabb_max_data,
-                                    const std::vector<uint>& bin_number,
-                                    const std::vector<uint>& aabb_number,
-                                    const std::vector<uint>& bin_start_index,
-                                    const std::vector<short2>& fam_data,
-                                    const std::vector<char>& body_active,
-                                    const std::vector<char>& body_collide,
-                                    const std::vector<uint>& body_id,
-                                    std::vector<uint>& num_contact) {
+CH_SIMD_CLONES void f_Count_AABB_AABB_Intersection(const uint index,
+                                                   const real3 inv_bin_size_vec,
+                                                   const vec3 bins_per_axis,
+                                                   const std::vector<real3>& aabb_min_data,
+                                                   const std::vector<real3>& aabb_max_data,
+                                                   const std::vector<uint>& bin_number,
+                                                   const std::vector<uint>& aabb_number,
+                                                   const std::vector<uint>& bin_start_index,
+                                                   const std::vector<short2>& fam_data,
+                                                   const std::vector<char>& body_active,
+                                                   const std::vector<char>& body_collide,
+                                                   const std::vector<uint>& body_id,
+                                                   std::vector<uint>& num_contact) {
     uint start = bin_start_index[index];
     uint end = bin_start_index[index + 1];
     uint count = 0;
@@ -146,20 +146,20 @@ void f_Count_AABB_AABB_Intersection(const uint index,
 }
 
 // Function to store AABB-AABB intersections.
-void f_Store_AABB_AABB_Intersection(const uint index,
-                                    const real3 inv_bin_size_vec,
-                                    const vec3 bins_per_axis,
-                                    const std::vector<real3>& aabb_min_data,
-                                    const std::vector<real3>& aabb_max_data,
-                                    const std::vector<uint>& bin_number,
-                                    const std::vector<uint>& aabb_number,
-                                    const std::vector<uint>& bin_start_index,
-                                    const std::vector<uint>& num_contact,
-                                    const std::vector<short2>& fam_data,
-                                    const std::vector<char>& body_active,
-                                    const std::vector<char>& body_collide,
-                                    const std::vector<uint>& body_id,
-                                    std::vector<long long>& potential_contacts) {
+CH_SIMD_CLONES void f_Store_AABB_AABB_Intersection(const uint index,
+                                                   const real3 inv_bin_size_vec,
+                                                   const vec3 bins_per_axis,
+                                                   const std::vector<real3>& aabb_min_data,
+                                                   const std::vector<real3>& aabb_max_data,
+                                                   const std::vector<uint>& bin_number,
+                                                   const std::vector<uint>& aabb_number,
+                                                   const std::vector<uint>& bin_start_index,
+                                                   const std::vector<uint>& num_contact,
+                                                   const std::vector<short2>& fam_data,
+                                                   const std::vector<char>& body_active,
+                                                   const std::vector<char>& body_collide,
+                                                   const std::vector<uint>& body_id,
+                                                   std::vector<long long>& potential_contacts) {
     uint start = bin_start_index[index];
     uint end = bin_start_index[index + 1];
     // Terminate early if there is only one object in the bin
@@ -24,6 +24,7 @@
 #include "chrono/collision/multicore/ChCollisionUtils.h"
 
 #include "chrono/multicore_math/utility.h"
+#include "chrono/utils/ChOpenMP.h"
 
 // Always include ChConfig.h *before* any Thrust headers!
 #include "chrono/ChConfig.h"
@@ -42,8 +43,19 @@ ChNarrowphase::ChNarrowphase()
       num_potential_rigid_contacts(0),
       num_potential_fluid_contacts(0),
       num_potential_rigid_fluid_contacts(0),
+      deterministic(false),
       cd_data(nullptr) {}
 
+void ChNarrowphase::ContactBuffer::Clear() {
+    norm.clear();
+    cpta.clear();
+    cptb.clear();
+    dpth.clear();
+    erad.clear();
+    bids.clear();
+    shapeIDs.clear();
+}
+
 void ChNarrowphase::ClearContacts() {
     // Return now if no potential collisions.
     if (num_potential_rigid_contacts == 0) {
@@ -79,7 +91,10 @@ void ChNarrowphase::ProcessRigids() {
     PreprocessLocalToParent();
 
     if (num_potential_rigid_contacts != 0) {
-        ProcessRigidRigid();
+        if (deterministic)
+            ProcessRigidRigidDeterministic();
+        else
+            ProcessRigidRigid();
     }
 
     if (cd_data->state_data.num_fluid_bodies != 0) {
@@ -202,6 +217,13 @@ void ChNarrowphase::Dispatch_Init(uint index,
                                   uint& ID_B,
                                   ConvexShape* shapeA,
                                   ConvexShape* shapeB) {
+    Dispatch_Shapes(index, ID_A, ID_B, shapeA, shapeB);
+
+    //// TODO: what is the best way to dispatch this?
+    icoll = contact_index[index];
+}
+
+void ChNarrowphase::Dispatch_Shapes(uint index, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB) {
     const std::vector<uint>& obj_data_ID = cd_data->shape_data.id_rigid;
     const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
 
@@ -217,9 +239,6 @@ void ChNarrowphase::Dispatch_Init(uint index,
 
     shapeA->data = &cd_data->shape_data;
     shapeB->data = &cd_data->shape_data;
-
-    //// TODO: what is the best way to dispatch this?
-    icoll = contact_index[index];
 }
 
 void ChNarrowphase::Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC) {
@@ -318,6 +337,31 @@ void ChNarrowphase::DispatchHybridMPR() {
     }
 }
 
+int ChNarrowphase::DispatchPair(const ConvexShape* shapeA,
+                                const ConvexShape* shapeB,
+                                real3* norm,
+                                real3* ptA,
+                                real3* ptB,
+                                real* depth,
+                                real* eff_radius) const {
+    const real envelope = cd_data->collision_envelope;
+    int nC = 0;
+
+    if (algorithm != Algorithm::MPR) {
+        if (PRIMSCollision(shapeA, shapeB, 2 * envelope, norm, ptA, ptB, depth, eff_radius, nC))
+            return nC;
+        if (algorithm == Algorithm::PRIMS)
+            return 0;
+    }
+
+    if (MPRCollision(shapeA, shapeB, envelope, norm[0], ptA[0], ptB[0], depth[0])) {
+        eff_radius[0] = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+        return 1;
+    }
+
+    return 0;
+}
+
 // -----------------------------------------------------------------------------
 
 void ChNarrowphase::ProcessRigidRigid() {
@@ -383,6 +427,95 @@ void ChNarrowphase::ProcessRigidRigid() {
     contact_shapeIDs.resize(num_rigid_contacts);
 }
 
+void ChNarrowphase::ProcessRigidRigidDeterministic() {
+    std::vector<real3>& norm_data = cd_data->norm_rigid_rigid;
+    std::vector<real3>& cpta_data = cd_data->cpta_rigid_rigid;
+    std::vector<real3>& cptb_data = cd_data->cptb_rigid_rigid;
+    std::vector<real>& dpth_data = cd_data->dpth_rigid_rigid;
+    std::vector<real>& erad_data = cd_data->erad_rigid_rigid;
+    std::vector<vec2>& bids_data = cd_data->bids_rigid_rigid;
+    std::vector<long long>& contact_shapeIDs = cd_data->contact_shapeIDs;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_rigid_contacts = cd_data->num_rigid_contacts;
+
+    // The broadphase generates candidate pairs bin by bin, in an order which depends on the (parallel) sorting of the
+    // shape-bin intersections. Sort the candidate pairs by their encoded shape IDs to obtain a canonical order.
+    Thrust_Sort(pair_shapeIDs);
+
+    // Split the sorted list of candidate pairs in contiguous ranges, one per thread. Each thread appends the contacts it
+    // finds to its own buffer, so that no worst-case storage nor compaction of the global contact arrays is needed.
+    int nthreads = ChOMP::GetMaxThreads();
+    if ((int)contact_buffers.size() < nthreads)
+        contact_buffers.resize(nthreads);
+    for (auto& buffer : contact_buffers)
+        buffer.Clear();
+
+    const uint num_pairs = num_potential_rigid_contacts;
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        int tid = ChOMP::GetThreadNum();
+        int nt = ChOMP::GetNumThreads();
+        uint start = (uint)(((size_t)num_pairs * tid) / nt);
+        uint end = (uint)(((size_t)num_pairs * (tid + 1)) / nt);
+
+        ContactBuffer& buffer = contact_buffers[tid];
+
+        ConvexShape shapeA;
+        ConvexShape shapeB;
+
+        real3 norm[max_pair_contacts];
+        real3 ptA[max_pair_contacts];
+        real3 ptB[max_pair_contacts];
+        real depth[max_pair_contacts];
+        real eff_radius[max_pair_contacts];
+
+        for (uint index = start; index < end; index++) {
+            uint ID_A, ID_B;
+            Dispatch_Shapes(index, ID_A, ID_B, &shapeA, &shapeB);
+
+            int nC = DispatchPair(&shapeA, &shapeB, norm, ptA, ptB, depth, eff_radius);
+            for (int i = 0; i < nC; i++) {
+                buffer.norm.push_back(norm[i]);
+                buffer.cpta.push_back(ptA[i]);
+                buffer.cptb.push_back(ptB[i]);
+                buffer.dpth.push_back(depth[i]);
+                buffer.erad.push_back(eff_radius[i]);
+                buffer.bids.push_back(I2(ID_A, ID_B));
+                buffer.shapeIDs.push_back(pair_shapeIDs[index]);
+            }
+        }
+    }
+
+    // Concatenate the per-thread buffers, in thread order (i.e., in canonical pair order)
+    std::vector<uint> buffer_start(contact_buffers.size() + 1);
+    buffer_start[0] = 0;
+    for (size_t t = 0; t < contact_buffers.size(); t++)
+        buffer_start[t + 1] = buffer_start[t] + (uint)contact_buffers[t].Size();
+    num_rigid_contacts = buffer_start.back();
+
+    norm_data.resize(num_rigid_contacts);
+    cpta_data.resize(num_rigid_contacts);
+    cptb_data.resize(num_rigid_contacts);
+    dpth_data.resize(num_rigid_contacts);
+    erad_data.resize(num_rigid_contacts);
+    bids_data.resize(num_rigid_contacts);
+    contact_shapeIDs.resize(num_rigid_contacts);
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int t = 0; t < (signed)contact_buffers.size(); t++) {
+        const ContactBuffer& buffer = contact_buffers[t];
+        uint start = buffer_start[t];
+        std::copy(buffer.norm.begin(), buffer.norm.end(), norm_data.begin() + start);
+        std::copy(buffer.cpta.begin(), buffer.cpta.end(), cpta_data.begin() + start);
+        std::copy(buffer.cptb.begin(), buffer.cptb.end(), cptb_data.begin() + start);
+        std::copy(buffer.dpth.begin(), buffer.dpth.end(), dpth_data.begin() + start);
+        std::copy(buffer.erad.begin(), buffer.erad.end(), erad_data.begin() + start);
+        std::copy(buffer.bids.begin(), buffer.bids.end(), bids_data.begin() + start);
+        std::copy(buffer.shapeIDs.begin(), buffer.shapeIDs.end(), contact_shapeIDs.begin() + start);
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 inline int GridCoord(real x, real inv_bin_edge, real minimum) {
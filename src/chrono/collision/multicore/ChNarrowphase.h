@@ -43,6 +43,11 @@ namespace chrono {
 /// rcyl     |                                              N        N
 /// trimesh  |                                                       N
 /// </pre>
+///
+/// Optionally, rigid-rigid contacts can be generated in a deterministic manner (see
+/// ChCollisionSystemMulticore::SetDeterministicNarrowphase). In that case, candidate pairs are processed in canonical
+/// order (sorted by shape IDs), each thread collects its contacts in a private buffer, and the buffers are concatenated
+/// in thread order. The resulting contact list is then bitwise identical regardless of the number of threads.
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -111,7 +116,24 @@ class ChApi ChNarrowphase {
     static const int max_neighbors = 64;
     static const int max_rigid_neighbors = 32;
 
+    /// Maximum number of contacts generated for a single pair of shapes (box-box and box-cylshell interactions).
+    static const int max_pair_contacts = 8;
+
   private:
+    /// Rigid-rigid contact data generated by one thread in the deterministic narrowphase.
+    struct ContactBuffer {
+        std::vector<real3> norm;
+        std::vector<real3> cpta;
+        std::vector<real3> cptb;
+        std::vector<real> dpth;
+        std::vector<real> erad;
+        std::vector<vec2> bids;
+        std::vector<long long> shapeIDs;
+
+        void Clear();
+        size_t Size() const { return dpth.size(); }
+    };
+
     /// Calculate total number of potential contacts.
     int PreprocessCount();
 
@@ -127,14 +149,27 @@ class ChApi ChNarrowphase {
     /// Perform collision detection involving rigid shapes (rigid-rigid and rigid-fluid).
     void ProcessRigids();
     void ProcessRigidRigid();
+    void ProcessRigidRigidDeterministic();
     void ProcessRigidFluid();
 
     void DispatchMPR();
     void DispatchPRIMS();
     void DispatchHybridMPR();
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
+    void Dispatch_Shapes(uint index, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
+    /// Run the current narrowphase algorithm on a single pair of shapes.
+    /// Contact data is written in the provided arrays (of size at least max_pair_contacts). Return the number of
+    /// contacts found.
+    int DispatchPair(const ConvexShape* shapeA,
+                     const ConvexShape* shapeB,
+                     real3* norm,
+                     real3* ptA,
+                     real3* ptB,
+                     real* depth,
+                     real* eff_radius) const;
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     std::vector<char> contact_rigid_active;
@@ -147,6 +182,9 @@ class ChApi ChNarrowphase {
     uint num_potential_rigid_fluid_contacts;
 
     Algorithm algorithm;
+    bool deterministic;  ///< if true, generate rigid-rigid contacts in canonical pair order
+
+    std::vector<ContactBuffer> contact_buffers;  ///< per-thread contact buffers (deterministic narrowphase)
 
     std::vector<uint> f_bin_intersections;
     std::vector<uint> f_bin_number;
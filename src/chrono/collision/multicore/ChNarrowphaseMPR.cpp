@@ -405,13 +405,13 @@ real Vec3PointTriDist2(const real3& P, const real3& V0, const real3& V1, const r
     return sqrDistance;
 }
 
-void FindPenetration(const ConvexBase* shapeA,
-                     const ConvexBase* shapeB,
-                     const real& envelope,
-                     simplex& portal,
-                     real& depth,
-                     real3& n,
-                     real3& point) {
+CH_SIMD_CLONES void FindPenetration(const ConvexBase* shapeA,
+                                    const ConvexBase* shapeB,
+                                    const real& envelope,
+                                    simplex& portal,
+                                    real& depth,
+                                    real3& n,
+                                    real3& point) {
     ////real3 zero = real3(0);
     real3 dir;
 
@@ -459,7 +459,11 @@ void FindPenetrationSegment(const ConvexBase* shapeA,
     n = Normalize(n);
 }
 
-bool FindPortal(const ConvexBase* shapeA, const ConvexBase* shapeB, const real& envelope, simplex& portal, real3& n) {
+CH_SIMD_CLONES bool FindPortal(const ConvexBase* shapeA,
+                               const ConvexBase* shapeB,
+                               const real& envelope,
+                               simplex& portal,
+                               real3& n) {
     // Phase One: Identify a portal
     for (int wi = 0; wi < WHILE_LOOP_MAX; wi++) {
         // Obtain the support point in a direction perpendicular to the existing plane
@@ -487,7 +491,10 @@ bool FindPortal(const ConvexBase* shapeA, const ConvexBase* shapeB, const real&
     return true;
 }
 
-int DiscoverPortal(const ConvexBase* shapeA, const ConvexBase* shapeB, const real& envelope, simplex& portal) {
+CH_SIMD_CLONES int DiscoverPortal(const ConvexBase* shapeA,
+                                  const ConvexBase* shapeB,
+                                  const real& envelope,
+                                  simplex& portal) {
     real3 n, va, vb;
     // vertex 0 is center of portal
     FindCenter(shapeA, shapeB, portal);
@@ -556,7 +563,10 @@ int DiscoverPortal(const ConvexBase* shapeA, const ConvexBase* shapeB, const rea
     }
     return 0;
 }
-int RefinePortal(const ConvexBase* shapeA, const ConvexBase* shapeB, const real& envelope, simplex& portal) {
+CH_SIMD_CLONES int RefinePortal(const ConvexBase* shapeA,
+                                const ConvexBase* shapeB,
+                                const real& envelope,
+                                simplex& portal) {
     real3 n;
     for (int i = 0; i < MAX_ITERATIONS; i++) {
         // Compute normal of the wedge face
@@ -584,12 +594,12 @@ int RefinePortal(const ConvexBase* shapeA, const ConvexBase* shapeB, const real&
 }
 
 // Code for Convex-Convex Collision detection, adopted from xeno-collide
-bool MPRContact(const ConvexBase* shapeA,
-                const ConvexBase* shapeB,
-                const real& envelope,
-                real3& returnNormal,
-                real3& point,
-                real& depth) {
+CH_SIMD_CLONES bool MPRContact(const ConvexBase* shapeA,
+                               const ConvexBase* shapeB,
+                               const real& envelope,
+                               real3& returnNormal,
+                               real3& point,
+                               real& depth) {
     simplex portal;
 
     int result = DiscoverPortal(shapeA, shapeB, envelope, portal);
@@ -627,13 +637,13 @@ void MPRGetPoints(const ConvexBase* shapeA,
 
 // -----------------------------------------------------------------------------
 
-bool ChNarrowphase::MPRCollision(const ConvexBase* shapeA,
-                                 const ConvexBase* shapeB,
-                                 real envelope,
-                                 real3& normal,
-                                 real3& pointA,
-                                 real3& pointB,
-                                 real& depth) {
+CH_SIMD_CLONES bool ChNarrowphase::MPRCollision(const ConvexBase* shapeA,
+                                                const ConvexBase* shapeB,
+                                                real envelope,
+                                                real3& normal,
+                                                real3& pointA,
+                                                real3& pointB,
+                                                real& depth) {
     real3 point;
     if (!MPRContact(shapeA, shapeB, envelope, normal, point, depth)) {
         return false;
@@ -35,16 +35,16 @@ static real edge_radius = 0.1;
 // In:  sphere centered at pos1 with radius1
 //      sphere centered at pos2 with radius2
 
-bool sphere_sphere(const real3& pos1,
-                   const real& radius1,
-                   const real3& pos2,
-                   const real& radius2,
-                   const real& separation,
-                   real3& norm,
-                   real& depth,
-                   real3& pt1,
-                   real3& pt2,
-                   real& eff_radius) {
+CH_SIMD_CLONES bool sphere_sphere(const real3& pos1,
+                                  const real& radius1,
+                                  const real3& pos2,
+                                  const real& radius2,
+                                  const real& separation,
+                                  real3& norm,
+                                  real& depth,
+                                  real3& pt1,
+                                  real3& pt2,
+                                  real& eff_radius) {
     real3 delta = pos2 - pos1;
     real dist2 = Dot(delta, delta);
     real radSum = radius1 + radius2;
@@ -76,18 +76,18 @@ bool sphere_sphere(const real3& pos1,
 //              capsule has radius1 and half-length hlen1 (in Z direction)
 //      sphere centered at pos2 with radius2
 
-bool capsule_sphere(const real3& pos1,
-                    const quaternion& rot1,
-                    const real& radius1,
-                    const real& hlen1,
-                    const real3& pos2,
-                    const real& radius2,
-                    const real& separation,
-                    real3& norm,
-                    real& depth,
-                    real3& pt1,
-                    real3& pt2,
-                    real& eff_radius) {
+CH_SIMD_CLONES bool capsule_sphere(const real3& pos1,
+                                   const quaternion& rot1,
+                                   const real& radius1,
+                                   const real& hlen1,
+                                   const real3& pos2,
+                                   const real& radius2,
+                                   const real& separation,
+                                   real3& norm,
+                                   real& depth,
+                                   real3& pt1,
+                                   real3& pt2,
+                                   real& eff_radius) {
     // Working in the global frame, project the sphere center onto the
     // capsule's centerline and clamp the resulting location to the extent
     // of the capsule length.
@@ -129,18 +129,18 @@ bool capsule_sphere(const real3& pos1,
 //              cylinder has radius1 and half-length hlen1 (in Z direction)
 //      sphere centered at pos2 with radius2
 
-bool cylinder_sphere(const real3& pos1,
-                     const quaternion& rot1,
-                     const real& radius1,
-                     const real& hlen1,
-                     const real3& pos2,
-                     const real& radius2,
-                     const real& separation,
-                     real3& norm,
-                     real& depth,
-                     real3& pt1,
-                     real3& pt2,
-                     real& eff_radius) {
+CH_SIMD_CLONES bool cylinder_sphere(const real3& pos1,
+                                    const quaternion& rot1,
+                                    const real& radius1,
+                                    const real& hlen1,
+                                    const real3& pos2,
+                                    const real& radius2,
+                                    const real& separation,
+                                    real3& norm,
+                                    real& depth,
+                                    real3& pt1,
+                                    real3& pt2,
+                                    real& eff_radius) {
     // Express the sphere position in the frame of the cylinder.
     real3 spherePos = TransformParentToLocal(pos1, rot1, pos2);
 
@@ -195,19 +195,19 @@ bool cylinder_sphere(const real3& pos1,
 //              radius of the sweeping sphere is srad1
 //      sphere centered at pos2 with radius2
 
-bool roundedcyl_sphere(const real3& pos1,
-                       const quaternion& rot1,
-                       const real& radius1,
-                       const real& hlen1,
-                       const real& srad1,
-                       const real3& pos2,
-                       const real& radius2,
-                       const real& separation,
-                       real3& norm,
-                       real& depth,
-                       real3& pt1,
-                       real3& pt2,
-                       real& eff_radius) {
+CH_SIMD_CLONES bool roundedcyl_sphere(const real3& pos1,
+                                      const quaternion& rot1,
+                                      const real& radius1,
+                                      const real& hlen1,
+                                      const real& srad1,
+                                      const real3& pos2,
+                                      const real& radius2,
+                                      const real& separation,
+                                      real3& norm,
+                                      real& depth,
+                                      real3& pt1,
+                                      real3& pt2,
+                                      real& eff_radius) {
     // Express the sphere position in the frame of the rounded cylinder.
     real3 spherePos = TransformParentToLocal(pos1, rot1, pos2);
 
@@ -264,17 +264,17 @@ bool roundedcyl_sphere(const real3& pos1,
 // In:  box at position pos1, with orientation rot1, and half-dimensions hdims1
 //      sphere centered at pos2 and with radius2
 
-bool box_sphere(const real3& pos1,
-                const quaternion& rot1,
-                const real3& hdims1,
-                const real3& pos2,
-                const real& radius2,
-                const real& separation,
-                real3& norm,
-                real& depth,
-                real3& pt1,
-                real3& pt2,
-                real& eff_radius) {
+CH_SIMD_CLONES bool box_sphere(const real3& pos1,
+                               const quaternion& rot1,
+                               const real3& hdims1,
+                               const real3& pos2,
+                               const real& radius2,
+                               const real& separation,
+                               real3& norm,
+                               real& depth,
+                               real3& pt1,
+                               real3& pt2,
+                               real& eff_radius) {
     // Express the sphere position in the frame of the box.
     real3 spherePos = TransformParentToLocal(pos1, rot1, pos2);
 
@@ -318,18 +318,18 @@ bool box_sphere(const real3& pos1,
 //              radius of the sweeping sphere is srad1
 //      sphere centered at pos2 and with radius2
 
-bool roundedbox_sphere(const real3& pos1,
-                       const quaternion& rot1,
-                       const real3& hdims1,
-                       const real& srad1,
-                       const real3& pos2,
-                       const real& radius2,
-                       const real& separation,
-                       real3& norm,
-                       real& depth,
-                       real3& pt1,
-                       real3& pt2,
-                       real& eff_radius) {
+CH_SIMD_CLONES bool roundedbox_sphere(const real3& pos1,
+                                      const quaternion& rot1,
+                                      const real3& hdims1,
+                                      const real& srad1,
+                                      const real3& pos2,
+                                      const real& radius2,
+                                      const real& separation,
+                                      real3& norm,
+                                      real& depth,
+                                      real3& pt1,
+                                      real3& pt2,
+                                      real& eff_radius) {
     // Express the sphere position in the frame of the rounded box.
     real3 spherePos = TransformParentToLocal(pos1, rot1, pos2);
 
@@ -374,17 +374,17 @@ bool roundedbox_sphere(const real3& pos1,
 // In: triangular face defined by points A1, B1, C1
 //     sphere sphere centered at pos2 and with radius2
 
-bool triangle_sphere(const real3& A1,
-                     const real3& B1,
-                     const real3& C1,
-                     const real3& pos2,
-                     const real& radius2,
-                     const real& separation,
-                     real3& norm,
-                     real& depth,
-                     real3& pt1,
-                     real3& pt2,
-                     real& eff_radius) {
+CH_SIMD_CLONES bool triangle_sphere(const real3& A1,
+                                    const real3& B1,
+                                    const real3& C1,
+                                    const real3& pos2,
+                                    const real& radius2,
+                                    const real& separation,
+                                    real3& norm,
+                                    real& depth,
+                                    real3& pt1,
+                                    real3& pt2,
+                                    real& eff_radius) {
     real radius2_s = radius2 + separation;
 
     // Calculate face normal.
@@ -441,20 +441,20 @@ bool triangle_sphere(const real3& A1,
 //              capsule has radius2 and half-length hlen2 (in Z direction)
 // Note: a capsule-capsule collision may return 0, 1, or 2 contacts
 
-int capsule_capsule(const real3& pos1,
-                    const quaternion& rot1,
-                    const real& radius1,
-                    const real& hlen1,
-                    const real3& pos2,
-                    const quaternion& rot2,
-                    const real& radius2,
-                    const real& hlen2,
-                    const real& separation,
-                    real3* norm,
-                    real* depth,
-                    real3* pt1,
-                    real3* pt2,
-                    real* eff_radius) {
+CH_SIMD_CLONES int capsule_capsule(const real3& pos1,
+                                   const quaternion& rot1,
+                                   const real& radius1,
+                                   const real& hlen1,
+                                   const real3& pos2,
+                                   const quaternion& rot2,
+                                   const real& radius2,
+                                   const real& hlen2,
+                                   const real& separation,
+                                   real3* norm,
+                                   real* depth,
+                                   real3* pt1,
+                                   real3* pt2,
+                                   real* eff_radius) {
     // Express the second capule in the frame of the first one.
     real3 pos = RotateT(pos2 - pos1, rot1);
     quaternion rot = Mult(Inv(rot1), rot2);
@@ -570,19 +570,19 @@ int capsule_capsule(const real3& pos1,
 //              capsule has radius2 and half-length hlen2 (in Z direction)
 // Note: a box-capsule collision may return 0, 1, or 2 contacts
 
-int box_capsule(const real3& pos1,
-                const quaternion& rot1,
-                const real3& hdims1,
-                const real3& pos2,
-                const quaternion& rot2,
-                const real& radius2,
-                const real& hlen2,
-                const real& separation,
-                real3* norm,
-                real* depth,
-                real3* pt1,
-                real3* pt2,
-                real* eff_radius) {
+CH_SIMD_CLONES int box_capsule(const real3& pos1,
+                               const quaternion& rot1,
+                               const real3& hdims1,
+                               const real3& pos2,
+                               const quaternion& rot2,
+                               const real& radius2,
+                               const real& hlen2,
+                               const real& separation,
+                               real3* norm,
+                               real* depth,
+                               real3* pt1,
+                               real3* pt2,
+                               real* eff_radius) {
     real radius2_s = radius2 + separation;
 
     // Express the capsule in the frame of the box.
@@ -714,19 +714,19 @@ int box_capsule(const real3& pos1,
 // - only treat interactions when the cylinder axis is parallel to or perpendicular on a box face.
 // - for any other relative configuration report -1 contacts (which will trigger a fall-back onto MPR).
 // - a box-cylshell collision may return up to 8 contacts.
-int box_cylshell(const real3& pos1,
-                 const quaternion& rot1,
-                 const real3& hdims,
-                 const real3& pos2,
-                 const quaternion& rot2,
-                 const real& radius,
-                 const real& hlen,
-                 const real& separation,
-                 real3* norm,
-                 real* depth,
-                 real3* pt1,
-                 real3* pt2,
-                 real* eff_radius) {
+CH_SIMD_CLONES int box_cylshell(const real3& pos1,
+                                const quaternion& rot1,
+                                const real3& hdims,
+                                const real3& pos2,
+                                const quaternion& rot2,
+                                const real& radius,
+                                const real& hlen,
+                                const real& separation,
+                                real3* norm,
+                                real* depth,
+                                real3* pt1,
+                                real3* pt2,
+                                real* eff_radius) {
     // Express cylinder in the box frame
     real3 c = RotateT(pos2 - pos1, rot1);    // cylinder center (expressed in box frame)
     quaternion rot = Mult(Inv(rot1), rot2);  // cylinder orientation (w.r.t box frame)
@@ -919,18 +919,18 @@ int box_cylshell(const real3& pos1,
 // In:  "this" box at position posT, with orientation rotT, and half-dimensions hdimsT
 //      "other" box at position posO, with orientation rotO, and half-dimensions hdimsO
 
-int box_box(const real3& posT,
-            const quaternion& rotT,
-            const real3& hdimsT,
-            const real3& posO,
-            const quaternion& rotO,
-            const real3& hdimsO,
-            const real& separation,
-            real3* norm,
-            real* depth,
-            real3* ptT,
-            real3* ptO,
-            real* eff_radius) {
+CH_SIMD_CLONES int box_box(const real3& posT,
+                           const quaternion& rotT,
+                           const real3& hdimsT,
+                           const real3& posO,
+                           const quaternion& rotO,
+                           const real3& hdimsO,
+                           const real& separation,
+                           real3* norm,
+                           real* depth,
+                           real3* ptT,
+                           real3* ptO,
+                           real* eff_radius) {
     // Express the other box into the frame of this box.
     // (this is a bit cryptic with the functions we have available)
     real3 pos = RotateT(posO - posT, rotT);
@@ -1229,16 +1229,16 @@ int box_box(const real3& posT,
 //     triangular face defined by points A2, B2, C2
 // Note: a triangle-box collision may return up to 6 contacts
 
-int triangle_box(const real3& pos1,
-                 const quaternion& rot1,
-                 const real3& hdims1,
-                 const real3* v2,
-                 const real& separation,
-                 real3* norm,
-                 real* depth,
-                 real3* pt1,
-                 real3* pt2,
-                 real* eff_radius) {
+CH_SIMD_CLONES int triangle_box(const real3& pos1,
+                                const quaternion& rot1,
+                                const real3& hdims1,
+                                const real3* v2,
+                                const real& separation,
+                                real3* norm,
+                                real* depth,
+                                real3* pt1,
+                                real3* pt2,
+                                real* eff_radius) {
     // Express the triangle vertices in the box frame.
     real3 v[] = {RotateT(v2[0] - pos1, rot1), RotateT(v2[1] - pos1, rot1), RotateT(v2[2] - pos1, rot1)};
 
@@ -1401,6 +1401,7 @@ real ChNarrowphase::GetDefaultEdgeRadius() {
 // In these cases, the corresponding ct_depth is a positive value.
 // This function returns true if it was able to determine the collision state
 // for the given pair of shapes and false if the shape types are not supported.
+CH_SIMD_CLONES
 bool ChNarrowphase::PRIMSCollision(const ConvexBase* shapeA,  // first candidate shape
                                    const ConvexBase* shapeB,  // second candidate shape
                                    real separation,           // maximum separation
@@ -15,6 +15,9 @@
 #ifndef CH_ELEMENT_ANCF_H
 #define CH_ELEMENT_ANCF_H
 
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChQuadrature.h"
 
 namespace chrono {
@@ -29,6 +32,31 @@ class ChApi ChElementANCF {
     ChElementANCF() : m_full_dof(true), m_element_dof(0) {}
     virtual ~ChElementANCF() {}
 
+    /// Integration data used for the batched evaluation of the internal forces (see ChElementANCFBatch).
+    /// All elements are assumed to use the "Continuous Integration" method, with a Green-Lagrange strain and a linear
+    /// (optionally viscoelastic) material law at each integration point p:
+    /// - columns 3p, 3p+1, 3p+2 of SD are the corrected normalized shape function derivatives at point p (one row per
+    ///   shape function);
+    /// - kGQ(p) is minus the Gauss quadrature weight times the element Jacobian at point p;
+    /// - material[p] is the index of the stiffness matrix used at point p (see GetBatchMaterialData).
+    struct BatchIntegrationData {
+        ChMatrixDynamic<> SD;
+        ChVectorDynamic<> kGQ;
+        std::vector<int> material;
+    };
+
+    /// Load the integration data for the batched evaluation of the internal forces.
+    /// Return false if the element does not support batched evaluation (default).
+    virtual bool GetBatchIntegrationData(BatchIntegrationData& data) { return false; }
+
+    /// Load the 6x6 stiffness matrices (in Voigt notation) and the damping coefficient for the batched evaluation of
+    /// the internal forces, for the current element settings. Return false if the internal forces cannot currently be
+    /// evaluated in batch (e.g., with the "Pre-Integration" method); such elements are then evaluated individually.
+    virtual bool GetBatchMaterialData(std::vector<ChMatrix66d>& D, double& alpha) { return false; }
+
+    /// Load the current nodal coordinates and their time derivatives, [ebar ebardot], one row per shape function.
+    virtual void GetBatchCoordinates(ChMatrixRef ebar_ebardot) {}
+
   protected:
     int m_element_dof;           ///< actual number of degrees of freedom for the element
     bool m_full_dof;             ///< true if all node variables are active (not fixed)
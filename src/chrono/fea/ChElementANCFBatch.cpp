@@ -0,0 +1,262 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <typeinfo>
+
+#include "chrono/fea/ChElementANCFBatch.h"
+
+namespace chrono {
+namespace fea {
+
+// Number of elements processed together (one per SIMD lane), based on the instruction set enabled in Eigen
+#if defined(EIGEN_VECTORIZE_AVX512)
+static const int kLaneWidth = 8;
+#elif defined(EIGEN_VECTORIZE_AVX)
+static const int kLaneWidth = 4;
+#elif defined(EIGEN_VECTORIZE)
+static const int kLaneWidth = 2;
+#else
+static const int kLaneWidth = 1;
+#endif
+
+using Lane = Eigen::Array<double, kLaneWidth, 1>;
+using LaneVector = std::vector<Lane, Eigen::aligned_allocator<Lane>>;
+
+static inline Lane LoadLane(const double* ptr) {
+    return Eigen::Map<const Lane>(ptr);
+}
+
+// -----------------------------------------------------------------------------
+
+// Generalized internal forces for a group of elements, using the "Continuous Integration" method with a linear
+// (DAMPING=false) or linear viscoelastic (DAMPING=true) material model.  This is the same calculation as in the
+// ComputeInternalForcesContIntDamping/NoDamping functions of the ANCF elements, performed one Gauss quadrature point at
+// a time for all lanes.  Each Green-Lagrange strain component is scaled by minus the Gauss quadrature weight times the
+// element Jacobian (kGQ) and combined with its scaled time derivative before calculating the stresses.
+template <bool DAMPING>
+static void ComputeGroupForces(int nsf,
+                               int nip,
+                               const double* SD,         // shape function derivatives: [(3p+d)*nsf + k] lanes
+                               const double* kGQ,        // Gauss quadrature scale factors: [p] lanes
+                               const int* material,      // stiffness matrix index at each integration point
+                               const LaneVector& e,      // [ebar ebardot]: [6k + j]
+                               const LaneVector& D,      // stiffness matrices: [36m + 6r + s]
+                               const Lane& alpha,        // damping coefficients
+                               LaneVector& Q) {          // internal forces: [3k + c]
+    for (auto& q : Q)
+        q.setZero();
+
+    for (int p = 0; p < nip; p++) {
+        const double* SDp = SD + (size_t)3 * p * nsf * kLaneWidth;
+
+        // Deformation gradient F(c,d) and its time derivative at the current point
+        Lane F[3][3];
+        Lane Fdot[3][3];
+        for (int c = 0; c < 3; c++) {
+            for (int d = 0; d < 3; d++) {
+                F[c][d].setZero();
+                Fdot[c][d].setZero();
+            }
+        }
+        for (int d = 0; d < 3; d++) {
+            for (int k = 0; k < nsf; k++) {
+                Lane sd = LoadLane(SDp + (d * nsf + k) * kLaneWidth);
+                for (int c = 0; c < 3; c++) {
+                    F[c][d] += sd * e[6 * k + c];
+                    if (DAMPING)
+                        Fdot[c][d] += sd * e[6 * k + 3 + c];
+                }
+            }
+        }
+
+        // Scaled Green-Lagrange strains in Voigt notation: kGQ*[E11,E22,E33,2*E23,2*E13,2*E12] (+ alpha*Edot)
+        Lane E[6];
+        E[0] = 0.5 * (F[0][0] * F[0][0] + F[1][0] * F[1][0] + F[2][0] * F[2][0] - 1);
+        E[1] = 0.5 * (F[0][1] * F[0][1] + F[1][1] * F[1][1] + F[2][1] * F[2][1] - 1);
+        E[2] = 0.5 * (F[0][2] * F[0][2] + F[1][2] * F[1][2] + F[2][2] * F[2][2] - 1);
+        E[3] = F[0][1] * F[0][2] + F[1][1] * F[1][2] + F[2][1] * F[2][2];
+        E[4] = F[0][0] * F[0][2] + F[1][0] * F[1][2] + F[2][0] * F[2][2];
+        E[5] = F[0][0] * F[0][1] + F[1][0] * F[1][1] + F[2][0] * F[2][1];
+        if (DAMPING) {
+            E[0] += alpha * (F[0][0] * Fdot[0][0] + F[1][0] * Fdot[1][0] + F[2][0] * Fdot[2][0]);
+            E[1] += alpha * (F[0][1] * Fdot[0][1] + F[1][1] * Fdot[1][1] + F[2][1] * Fdot[2][1]);
+            E[2] += alpha * (F[0][2] * Fdot[0][2] + F[1][2] * Fdot[1][2] + F[2][2] * Fdot[2][2]);
+            E[3] += alpha * (F[0][2] * Fdot[0][1] + F[1][2] * Fdot[1][1] + F[2][2] * Fdot[2][1] +  //
+                             F[0][1] * Fdot[0][2] + F[1][1] * Fdot[1][2] + F[2][1] * Fdot[2][2]);
+            E[4] += alpha * (F[0][2] * Fdot[0][0] + F[1][2] * Fdot[1][0] + F[2][2] * Fdot[2][0] +  //
+                             F[0][0] * Fdot[0][2] + F[1][0] * Fdot[1][2] + F[2][0] * Fdot[2][2]);
+            E[5] += alpha * (F[0][1] * Fdot[0][0] + F[1][1] * Fdot[1][0] + F[2][1] * Fdot[2][0] +  //
+                             F[0][0] * Fdot[0][1] + F[1][0] * Fdot[1][1] + F[2][0] * Fdot[2][1]);
+        }
+        Lane scale = LoadLane(kGQ + p * kLaneWidth);
+        for (int i = 0; i < 6; i++)
+            E[i] *= scale;
+
+        // Scaled 2nd Piola-Kirchoff stresses: kGQ*SPK2 = D * E_Combined
+        const Lane* Dp = D.data() + 36 * material[p];
+        Lane S[6];
+        for (int r = 0; r < 6; r++) {
+            S[r] = Dp[6 * r] * E[0];
+            for (int s = 1; s < 6; s++)
+                S[r] += Dp[6 * r + s] * E[s];
+        }
+
+        // Scaled transpose of the 1st Piola-Kirchoff stresses, P(c,d) = kGQ*(SPK2*F_transpose)(d,c)
+        Lane P[3][3];
+        for (int c = 0; c < 3; c++) {
+            P[c][0] = F[c][0] * S[0] + F[c][1] * S[5] + F[c][2] * S[4];
+            P[c][1] = F[c][0] * S[5] + F[c][1] * S[1] + F[c][2] * S[3];
+            P[c][2] = F[c][0] * S[4] + F[c][1] * S[3] + F[c][2] * S[2];
+        }
+
+        // Accumulate the generalized internal forces, Qi(k,c) = sum_d SD(k,d) * P(c,d)
+        for (int d = 0; d < 3; d++) {
+            for (int k = 0; k < nsf; k++) {
+                Lane sd = LoadLane(SDp + (d * nsf + k) * kLaneWidth);
+                for (int c = 0; c < 3; c++)
+                    Q[3 * k + c] += sd * P[c][d];
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+ChElementANCFBatch::ChElementANCFBatch() : m_type(typeid(void)), m_nsf(0), m_nip(0), m_nmat(0) {}
+
+int ChElementANCFBatch::GetLaneWidth() {
+    return kLaneWidth;
+}
+
+bool ChElementANCFBatch::AddElement(std::shared_ptr<ChElementBase> element) {
+    auto ancf = dynamic_cast<ChElementANCF*>(element.get());
+    if (!ancf)
+        return false;
+    if (!m_elements.empty() && std::type_index(typeid(*element)) != m_type)
+        return false;
+
+    ChElementANCF::BatchIntegrationData data;
+    if (!ancf->GetBatchIntegrationData(data))
+        return false;
+
+    int nsf = (int)data.SD.rows();
+    int nip = (int)data.kGQ.size();
+    if (data.SD.cols() != 3 * nip || (int)data.material.size() != nip)
+        return false;
+
+    if (m_elements.empty()) {
+        m_type = std::type_index(typeid(*element));
+        m_nsf = nsf;
+        m_nip = nip;
+        m_material = data.material;
+        m_nmat = 0;
+        for (auto m : m_material)
+            m_nmat = std::max(m_nmat, m + 1);
+    } else if (nsf != m_nsf || nip != m_nip || data.material != m_material) {
+        return false;
+    }
+
+    // Start a new group of elements if needed (unused lanes are left with zero data)
+    unsigned int i = (unsigned int)m_elements.size();
+    unsigned int g = i / kLaneWidth;
+    unsigned int l = i % kLaneWidth;
+    if (l == 0) {
+        m_SD.resize(m_SD.size() + (size_t)3 * m_nip * m_nsf * kLaneWidth, 0.0);
+        m_kGQ.resize(m_kGQ.size() + (size_t)m_nip * kLaneWidth, 0.0);
+    }
+
+    double* SD = m_SD.data() + (size_t)g * 3 * m_nip * m_nsf * kLaneWidth;
+    double* kGQ = m_kGQ.data() + (size_t)g * m_nip * kLaneWidth;
+    for (int p = 0; p < m_nip; p++) {
+        for (int d = 0; d < 3; d++) {
+            for (int k = 0; k < m_nsf; k++)
+                SD[((3 * p + d) * m_nsf + k) * kLaneWidth + l] = data.SD(k, 3 * p + d);
+        }
+        kGQ[p * kLaneWidth + l] = data.kGQ(p);
+    }
+
+    m_elements.push_back(element);
+    m_ancf.push_back(ancf);
+    m_forces.push_back(ChVectorDynamic<>::Zero(3 * m_nsf));
+
+    return true;
+}
+
+void ChElementANCFBatch::ComputeInternalForces(int num_threads) {
+    int num_groups = (int)((m_elements.size() + kLaneWidth - 1) / kLaneWidth);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads)
+    for (int g = 0; g < num_groups; g++) {
+        ComputeGroup(g);
+    }
+}
+
+void ChElementANCFBatch::ComputeGroup(unsigned int g) {
+    LaneVector e(6 * m_nsf, Lane::Zero());
+    LaneVector D(36 * m_nmat, Lane::Zero());
+    LaneVector Q(3 * m_nsf);
+    Lane alpha = Lane::Zero();
+
+    std::vector<ChMatrix66d> D_element;
+    ChMatrixDynamic<> e_element(m_nsf, 6);
+
+    // Gather the current element data in the group lanes.
+    // Elements which cannot be evaluated in batch are left with zero data (and zero forces from the kernel).
+    bool batched[kLaneWidth];
+    bool damping = false;
+    for (int l = 0; l < kLaneWidth; l++) {
+        size_t i = (size_t)g * kLaneWidth + l;
+        double element_alpha;
+        batched[l] = i < m_elements.size() && m_ancf[i]->GetBatchMaterialData(D_element, element_alpha) &&
+                     (int)D_element.size() == m_nmat;
+        if (!batched[l])
+            continue;
+
+        m_ancf[i]->GetBatchCoordinates(e_element);
+        for (int k = 0; k < m_nsf; k++) {
+            for (int j = 0; j < 6; j++)
+                e[6 * k + j](l) = e_element(k, j);
+        }
+        for (int m = 0; m < m_nmat; m++) {
+            for (int r = 0; r < 6; r++) {
+                for (int s = 0; s < 6; s++)
+                    D[36 * m + 6 * r + s](l) = D_element[m](r, s);
+            }
+        }
+        alpha(l) = element_alpha;
+        damping = damping || element_alpha != 0;
+    }
+
+    const double* SD = m_SD.data() + (size_t)g * 3 * m_nip * m_nsf * kLaneWidth;
+    const double* kGQ = m_kGQ.data() + (size_t)g * m_nip * kLaneWidth;
+    if (damping)
+        ComputeGroupForces<true>(m_nsf, m_nip, SD, kGQ, m_material.data(), e, D, alpha, Q);
+    else
+        ComputeGroupForces<false>(m_nsf, m_nip, SD, kGQ, m_material.data(), e, D, alpha, Q);
+
+    // Scatter the lane results to the element force vectors
+    for (int l = 0; l < kLaneWidth; l++) {
+        size_t i = (size_t)g * kLaneWidth + l;
+        if (i >= m_elements.size())
+            break;
+        if (batched[l]) {
+            for (int k = 0; k < 3 * m_nsf; k++)
+                m_forces[i](k) = Q[k](l);
+        } else {
+            m_elements[i]->ComputeInternalForces(m_forces[i]);
+        }
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
@@ -0,0 +1,87 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_ELEMENT_ANCF_BATCH_H
+#define CH_ELEMENT_ANCF_BATCH_H
+
+#include <memory>
+#include <typeindex>
+#include <vector>
+
+#include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChElementANCF.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Batched evaluation of the internal forces of ANCF elements of the same type.
+///
+/// The integration data of all elements in the batch (shape function derivatives and Gauss quadrature scale factors,
+/// see ChElementANCF::BatchIntegrationData) is stored in a structure-of-arrays layout, interleaving groups of
+/// elements. The internal forces of all elements in a group are then evaluated together, with each element mapped to
+/// one lane of the SIMD registers. The number of lanes is set by the instruction set the library was compiled for
+/// (8 with AVX-512, 4 with AVX, 2 with SSE2 or NEON). If vectorization is not available (a single lane), batched
+/// evaluation brings no benefit and ChMesh evaluates all elements individually.
+///
+/// Elements which cannot be evaluated in batch with their current settings (see ChElementANCF::GetBatchMaterialData)
+/// are evaluated individually, using their own ComputeInternalForces.
+class ChApi ChElementANCFBatch {
+  public:
+    ChElementANCFBatch();
+
+    /// Return the number of elements evaluated together by the vectorized kernel.
+    static int GetLaneWidth();
+
+    /// Add the given element to this batch.
+    /// Return false if the element does not support batched evaluation, or if its type or integration layout differ
+    /// from those of the elements already in this batch.
+    bool AddElement(std::shared_ptr<ChElementBase> element);
+
+    /// Return the number of elements in this batch.
+    unsigned int GetNumElements() const { return (unsigned int)m_elements.size(); }
+
+    /// Return the specified element in this batch.
+    std::shared_ptr<ChElementBase> GetElement(unsigned int i) const { return m_elements[i]; }
+
+    /// Evaluate the internal forces of all elements in this batch, using the specified number of threads.
+    void ComputeInternalForces(int num_threads = 1);
+
+    /// Return the internal forces of the specified element, as evaluated at the last call to ComputeInternalForces.
+    const ChVectorDynamic<>& GetInternalForces(unsigned int i) const { return m_forces[i]; }
+
+  private:
+    /// Evaluate the internal forces of the elements in the specified group.
+    void ComputeGroup(unsigned int g);
+
+    std::vector<std::shared_ptr<ChElementBase>> m_elements;  ///< elements in this batch
+    std::vector<ChElementANCF*> m_ancf;                      ///< elements in this batch, as ANCF elements
+    std::vector<ChVectorDynamic<>> m_forces;                 ///< element internal forces
+
+    std::type_index m_type;       ///< type of the elements in this batch
+    int m_nsf;                    ///< number of shape functions
+    int m_nip;                    ///< number of integration points
+    int m_nmat;                   ///< number of stiffness matrices
+    std::vector<int> m_material;  ///< stiffness matrix index at each integration point
+
+    std::vector<double> m_SD;   ///< shape function derivatives, interleaved by element group
+    std::vector<double> m_kGQ;  ///< Gauss quadrature scale factors, interleaved by element group
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -122,6 +122,33 @@ class ChApi ChElementBase {
     /// and not even the g vector, for instance if using lumped masses.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) = 0;
 
+    /// Same as EleIntLoadResidual_F, but without synchronization of the updates to R.
+    /// This is called (instead of EleIntLoadResidual_F) by a mesh with colored assembly, which guarantees that no other
+    /// thread concurrently updates the entries of R corresponding to the nodes of this element.
+    virtual void EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) { EleIntLoadResidual_F(R, c); }
+
+    /// Same as EleIntLoadResidual_F_gravity, but without synchronization of the updates to R.
+    /// This is called (instead of EleIntLoadResidual_F_gravity) by a mesh with colored assembly.
+    virtual void EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) {
+        EleIntLoadResidual_F_gravity(R, G_acc, c);
+    }
+
+    /// Add the given internal forces Fi (with the layout of ComputeInternalForces), scaled by c, into a global vector R
+    /// at the global nodes offsets. This is used to load internal forces evaluated outside of the element, e.g. in
+    /// batch with other elements (see ChMesh::EnableBatchedInternalForces). If 'exclusive' is false, R is updated with
+    /// atomic operations. Elements supporting batched evaluation of their internal forces must implement this function;
+    /// the default implementation ignores Fi and evaluates the internal forces through EleIntLoadResidual_F (or
+    /// EleIntLoadResidual_F_exclusive), so that no forces are lost for elements without such support.
+    virtual void EleIntLoadResidual_Fi(ChVectorDynamic<>& R,
+                                       const ChVectorDynamic<>& Fi,
+                                       const double c,
+                                       bool exclusive) {
+        if (exclusive)
+            EleIntLoadResidual_F_exclusive(R, c);
+        else
+            EleIntLoadResidual_F(R, c);
+    }
+
     // Functions for interfacing to the solver
 
     /// Register with the given system descriptor any ChKRMBlock objects associated with this item.
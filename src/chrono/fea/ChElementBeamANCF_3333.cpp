@@ -449,6 +449,55 @@ void ChElementBeamANCF_3333::ComputeGravityForces(ChVectorDynamic<>& Fg, const C
     GravForceCompact = m_GravForceScale * G_acc.eigen().transpose();
 }
 
+// -----------------------------------------------------------------------------
+// Interface to ChElementANCF base class (batched evaluation of the internal forces)
+// -----------------------------------------------------------------------------
+
+bool ChElementBeamANCF_3333::GetBatchIntegrationData(BatchIntegrationData& data) {
+    // The shape function derivatives are only precomputed for the "Continuous Integration" method
+    if (m_method != IntFrcMethod::ContInt)
+        return false;
+
+    // Reorder the shape function derivative matrix columns by Gauss quadrature point.  The points excluding the
+    // Poisson effect (diagonal stiffness matrix D0) come first, followed by the points for the Poisson effect (Dv).
+    data.SD.resize(NSF, 3 * NIP);
+    data.kGQ.resize(NIP);
+    data.material.resize(NIP);
+    for (unsigned int ip = 0; ip < NIP_D0; ip++) {
+        for (unsigned int d = 0; d < 3; d++)
+            data.SD.col(3 * ip + d) = m_SD.col(d * NIP_D0 + ip);
+        data.kGQ(ip) = m_kGQ_D0(ip);
+        data.material[ip] = 0;
+    }
+    for (unsigned int ip = 0; ip < NIP_Dv; ip++) {
+        unsigned int p = NIP_D0 + ip;
+        for (unsigned int d = 0; d < 3; d++)
+            data.SD.col(3 * p + d) = m_SD.col(3 * NIP_D0 + d * NIP_Dv + ip);
+        data.kGQ(p) = m_kGQ_Dv(ip);
+        data.material[p] = 1;
+    }
+    return true;
+}
+
+bool ChElementBeamANCF_3333::GetBatchMaterialData(std::vector<ChMatrix66d>& D, double& alpha) {
+    if (m_method != IntFrcMethod::ContInt)
+        return false;
+
+    // With the split of the stiffness matrix, the entries of Dv outside of the upper 3x3 block are all zeros
+    D.resize(2);
+    D[0] = GetMaterial()->Get_D0().asDiagonal();
+    D[1].setZero();
+    D[1].block<3, 3>(0, 0) = GetMaterial()->Get_Dv();
+    alpha = m_damping_enabled ? m_Alpha : 0;
+    return true;
+}
+
+void ChElementBeamANCF_3333::GetBatchCoordinates(ChMatrixRef ebar_ebardot) {
+    MatrixNx6 e;
+    CalcCombinedCoordMatrix(e);
+    ebar_ebardot = e;
+}
+
 // -----------------------------------------------------------------------------
 // Interface to ChElementBeam base class (and similar methods)
 // -----------------------------------------------------------------------------
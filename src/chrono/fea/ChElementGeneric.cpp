@@ -26,18 +26,42 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
 
     //// Attention: this is called from within a parallel OMP for loop.
     //// Must use atomic increment when updating the global vector R.
+    LoadNodalVector(R, Fi, true);
+}
+
+void ChElementGeneric::EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) {
+    ChVectorDynamic<> Fi(GetNumCoordsPosLevel());
+    ComputeInternalForces(Fi);
+    Fi *= c;
+
+    LoadNodalVector(R, Fi, false);
+}
+
+void ChElementGeneric::EleIntLoadResidual_Fi(ChVectorDynamic<>& R,
+                                             const ChVectorDynamic<>& Fi,
+                                             const double c,
+                                             bool exclusive) {
+    ChVectorDynamic<> F = c * Fi;
+
+    LoadNodalVector(R, F, !exclusive);
+}
 
+void ChElementGeneric::LoadNodalVector(ChVectorDynamic<>& R, const ChVectorDynamic<>& F, bool atomic) {
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
         if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
+            unsigned int offset = GetNode(in)->NodeGetOffsetVelLevel();
+            if (atomic) {
+                for (unsigned int j = 0; j < node_dofs; j++)
 #pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fi(stride + j);
+                    R(offset + j) += F(stride + j);
+            } else {
+                R.segment(offset, node_dofs) += F.segment(stride, node_dofs);
+            }
         }
         stride += GetNodeNumCoordsPosLevel(in);
     }
-    // std::cout << "EleIntLoadResidual_F , R=" << R << std::endl;
 }
 
 void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {
@@ -90,17 +114,17 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
 
     //// Attention: this is called from within a parallel OMP for loop.
     //// Must use atomic increment when updating the global vector R.
+    LoadNodalVector(R, Fg, true);
+}
 
-    unsigned int stride = 0;
-    for (unsigned int in = 0; in < GetNumNodes(); in++) {
-        unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
-        if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fg(stride + j);
-        }
-        stride += GetNodeNumCoordsPosLevel(in);
-    }
+void ChElementGeneric::EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R,
+                                                              const ChVector3d& G_acc,
+                                                              const double c) {
+    ChVectorDynamic<> Fg(GetNumCoordsPosLevel());
+    ComputeGravityForces(Fg, G_acc);
+    Fg *= c;
+
+    LoadNodalVector(R, Fg, false);
 }
 
 // A default fall-back implementation of the ComputeGravityForces that will work for all elements inherited from
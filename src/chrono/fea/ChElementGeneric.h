@@ -63,6 +63,20 @@ class ChApi ChElementGeneric : public ChElementBase {
     /// only if they are inherited by ChLoadableUVW so it can use GetDensity() and Gauss quadrature.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector3d& G_acc, const double c) override;
 
+    /// Same as EleIntLoadResidual_F, but without atomic updates of R (see ChMesh::EnableColoredAssembly).
+    virtual void EleIntLoadResidual_F_exclusive(ChVectorDynamic<>& R, const double c) override;
+
+    /// Same as EleIntLoadResidual_F_gravity, but without atomic updates of R (see ChMesh::EnableColoredAssembly).
+    virtual void EleIntLoadResidual_F_gravity_exclusive(ChVectorDynamic<>& R,
+                                                        const ChVector3d& G_acc,
+                                                        const double c) override;
+
+    /// Add the given internal forces Fi, scaled by c, into R (see ChMesh::EnableBatchedInternalForces).
+    virtual void EleIntLoadResidual_Fi(ChVectorDynamic<>& R,
+                                       const ChVectorDynamic<>& Fi,
+                                       const double c,
+                                       bool exclusive) override;
+
     // FEM functions
 
     /// Compute the gravitational forces.
@@ -92,6 +106,10 @@ class ChApi ChElementGeneric : public ChElementBase {
     virtual void VariablesFbIncrementMq() override;
 
   protected:
+    /// Add the nodal vector F (with the same layout as the element internal forces) to R, at the global node offsets.
+    /// If 'atomic' is true, R is updated with atomic operations.
+    void LoadNodalVector(ChVectorDynamic<>& R, const ChVectorDynamic<>& F, bool atomic);
+
     ChKRMBlock Kmatr;
 };
 
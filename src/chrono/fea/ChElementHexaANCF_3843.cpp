@@ -523,6 +523,43 @@ void ChElementHexaANCF_3843::ComputeGravityForces(ChVectorDynamic<>& Fg, const C
     GravForceCompact = m_GravForceScale * G_acc.eigen().transpose();
 }
 
+// -----------------------------------------------------------------------------
+// Interface to ChElementANCF base class (batched evaluation of the internal forces)
+// -----------------------------------------------------------------------------
+
+bool ChElementHexaANCF_3843::GetBatchIntegrationData(BatchIntegrationData& data) {
+    // The shape function derivatives are only precomputed for the "Continuous Integration" method
+    if (m_method != IntFrcMethod::ContInt)
+        return false;
+
+    // Reorder the shape function derivative matrix columns by Gauss quadrature point
+    data.SD.resize(NSF, 3 * NIP);
+    data.kGQ.resize(NIP);
+    data.material.assign(NIP, 0);
+    for (unsigned int ip = 0; ip < NIP; ip++) {
+        for (unsigned int d = 0; d < 3; d++)
+            data.SD.col(3 * ip + d) = m_SD.col(d * NIP + ip);
+        data.kGQ(ip) = m_kGQ(ip);
+    }
+    return true;
+}
+
+bool ChElementHexaANCF_3843::GetBatchMaterialData(std::vector<ChMatrix66d>& D, double& alpha) {
+    if (m_method != IntFrcMethod::ContInt)
+        return false;
+
+    D.resize(1);
+    D[0] = GetMaterial()->Get_D();
+    alpha = m_damping_enabled ? m_Alpha : 0;
+    return true;
+}
+
+void ChElementHexaANCF_3843::GetBatchCoordinates(ChMatrixRef ebar_ebardot) {
+    MatrixNx6 e;
+    CalcCombinedCoordMatrix(e);
+    ebar_ebardot = e;
+}
+
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 
@@ -559,6 +559,52 @@ void ChElementShellANCF_3833::ComputeGravityForces(ChVectorDynamic<>& Fg, const
     GravForceCompact = m_GravForceScale * G_acc.eigen().transpose();
 }
 
+// -----------------------------------------------------------------------------
+// Interface to ChElementANCF base class (batched evaluation of the internal forces)
+// -----------------------------------------------------------------------------
+
+bool ChElementShellANCF_3833::GetBatchIntegrationData(BatchIntegrationData& data) {
+    // The shape function derivatives are only precomputed for the "Continuous Integration" method
+    if (m_method != IntFrcMethod::ContInt)
+        return false;
+
+    // Reorder the shape function derivative matrix columns by Gauss quadrature point, for all layers.
+    // Each layer uses its own stiffness matrix.
+    int num_points = NIP * m_numLayers;
+    data.SD.resize(NSF, 3 * num_points);
+    data.kGQ.resize(num_points);
+    data.material.resize(num_points);
+    for (int kl = 0; kl < m_numLayers; kl++) {
+        for (unsigned int ip = 0; ip < NIP; ip++) {
+            int p = kl * NIP + ip;
+            for (unsigned int d = 0; d < 3; d++)
+                data.SD.col(3 * p + d) = m_SD.col(3 * NIP * kl + d * NIP + ip);
+            data.kGQ(p) = m_kGQ(p);
+            data.material[p] = kl;
+        }
+    }
+    return true;
+}
+
+bool ChElementShellANCF_3833::GetBatchMaterialData(std::vector<ChMatrix66d>& D, double& alpha) {
+    if (m_method != IntFrcMethod::ContInt)
+        return false;
+
+    D.resize(m_numLayers);
+    for (int kl = 0; kl < m_numLayers; kl++) {
+        D[kl] = m_layers[kl].GetMaterial()->Get_E_eps();
+        RotateReorderStiffnessMatrix(D[kl], m_layers[kl].GetFiberAngle());
+    }
+    alpha = m_damping_enabled ? m_Alpha : 0;
+    return true;
+}
+
+void ChElementShellANCF_3833::GetBatchCoordinates(ChMatrixRef ebar_ebardot) {
+    MatrixNx6 e;
+    CalcCombinedCoordMatrix(e);
+    ebar_ebardot = e;
+}
+
 // -----------------------------------------------------------------------------
 // Interface to ChElementShell base class
 // -----------------------------------------------------------------------------
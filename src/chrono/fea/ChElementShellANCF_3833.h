@@ -273,6 +273,20 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
     /// Compute the generalized force vector due to gravity using the efficient ANCF specific method
     virtual void ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector3d& G_acc) override;
 
+    // Interface to ChElementANCF base class (batched evaluation of the internal forces)
+    // --------------------------------------
+
+    /// Load the integration data for the batched evaluation of the internal forces.
+    /// Return false if the "Pre-Integration" method is used.
+    virtual bool GetBatchIntegrationData(BatchIntegrationData& data) override;
+
+    /// Load the stiffness matrices and damping coefficient for the batched evaluation of the internal forces.
+    /// Return false if the "Pre-Integration" method is used.
+    virtual bool GetBatchMaterialData(std::vector<ChMatrix66d>& D, double& alpha) override;
+
+    /// Load the current nodal coordinates and their time derivatives, [ebar ebardot].
+    virtual void GetBatchCoordinates(ChMatrixRef ebar_ebardot) override;
+
     // Interface to ChElementShell base class
     // --------------------------------------
 
@@ -18,12 +18,14 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
 
+#include "chrono/fea/ChElementANCFBatch.h"
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
@@ -45,6 +47,12 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
 
+    colored_assembly = other.colored_assembly;
+    colors_valid = false;
+
+    batched_forces = other.batched_forces;
+    batches_valid = false;
+
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
 }
@@ -67,6 +75,9 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // element integration data may have changed
+    batches_valid = false;
 }
 
 void ChMesh::Relax() {
@@ -96,6 +107,8 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
     velements.push_back(elem);
+    colors_valid = false;
+    batches_valid = false;
 
     // If the mesh is already added to a system, mark the system uninitialized and out-of-date
     if (system) {
@@ -107,6 +120,8 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    colors_valid = false;
+    batches_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -118,6 +133,8 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    colors_valid = false;
+    batches_valid = false;
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -125,6 +142,138 @@ void ChMesh::ClearNodes() {
     }
 }
 
+void ChMesh::EnableColoredAssembly(bool val) {
+    colored_assembly = val;
+    colors_valid = false;
+    if (!val) {
+        color_elements.clear();
+        color_start.clear();
+    }
+}
+
+void ChMesh::ColorElements() {
+    const int max_colors = 64;
+
+    // Bitmask of the colors already used by elements connected to each node.
+    // Nodes are identified by their address, as elements may also reference nodes not listed in this mesh.
+    std::unordered_map<ChNodeFEAbase*, uint64_t> node_colors;
+    node_colors.reserve(vnodes.size());
+
+    // Greedy coloring of the elements, in element order (color -1 for elements which cannot be colored)
+    std::vector<int> element_color(velements.size());
+    std::vector<unsigned int> color_count(max_colors + 1, 0);
+
+    for (size_t ie = 0; ie < velements.size(); ie++) {
+        auto& element = velements[ie];
+        unsigned int num_nodes = element->GetNumNodes();
+
+        uint64_t used = 0;
+        for (unsigned int in = 0; in < num_nodes; in++)
+            used |= node_colors[element->GetNode(in).get()];
+
+        int color = -1;
+        if (used != ~uint64_t(0)) {
+            color = 0;
+            while (used & (uint64_t(1) << color))
+                color++;
+            for (unsigned int in = 0; in < num_nodes; in++)
+                node_colors[element->GetNode(in).get()] |= (uint64_t(1) << color);
+        }
+
+        element_color[ie] = color;
+        color_count[color < 0 ? max_colors : color]++;
+    }
+
+    // Sort elements by color (stable, so that the element order is preserved within each color)
+    int num_colors = 0;
+    while (num_colors < max_colors && color_count[num_colors] > 0)
+        num_colors++;
+
+    color_start.assign(num_colors + 1, 0);
+    for (int color = 0; color < num_colors; color++)
+        color_start[color + 1] = color_start[color] + color_count[color];
+
+    std::vector<unsigned int> next(color_start.begin(), color_start.end());
+    unsigned int next_uncolored = color_start.back();
+
+    color_elements.resize(velements.size());
+    for (size_t ie = 0; ie < velements.size(); ie++) {
+        int color = element_color[ie];
+        if (color < 0)
+            color_elements[next_uncolored++] = (unsigned int)ie;
+        else
+            color_elements[next[color]++] = (unsigned int)ie;
+    }
+
+    colors_valid = true;
+}
+
+void ChMesh::ForEachElementColored(int nthreads, const std::function<void(unsigned int)>& func) {
+    if (!colors_valid)
+        ColorElements();
+
+    // Elements of the same color do not share any node and can be processed concurrently.
+    int num_colors = (int)color_start.size() - 1;
+    for (int color = 0; color < num_colors; color++) {
+        int start = (int)color_start[color];
+        int end = (int)color_start[color + 1];
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int k = start; k < end; k++) {
+            func(color_elements[k]);
+        }
+    }
+
+    // Elements which could not be colored are processed sequentially.
+    for (size_t k = color_start.back(); k < color_elements.size(); k++) {
+        func(color_elements[k]);
+    }
+}
+
+void ChMesh::EnableBatchedInternalForces(bool val) {
+    batched_forces = val;
+    batches_valid = false;
+    if (!val) {
+        element_batches.clear();
+        element_forces.clear();
+    }
+}
+
+void ChMesh::BuildElementBatches() {
+    element_batches.clear();
+    element_forces.assign(velements.size(), nullptr);
+
+    // Without SIMD support (a single lane), all elements are evaluated individually
+    if (ChElementANCFBatch::GetLaneWidth() > 1) {
+        std::vector<std::pair<int, unsigned int>> element_slots(velements.size(), {-1, 0});
+
+        for (size_t ie = 0; ie < velements.size(); ie++) {
+            // Add the element to the first batch accepting it, or start a new batch
+            bool added = false;
+            for (size_t ib = 0; ib < element_batches.size() && !added; ib++) {
+                if (element_batches[ib]->AddElement(velements[ie])) {
+                    element_slots[ie] = {(int)ib, element_batches[ib]->GetNumElements() - 1};
+                    added = true;
+                }
+            }
+            if (!added) {
+                auto batch = chrono_types::make_shared<ChElementANCFBatch>();
+                if (batch->AddElement(velements[ie])) {
+                    element_slots[ie] = {(int)element_batches.size(), 0};
+                    element_batches.push_back(batch);
+                }
+            }
+        }
+
+        for (size_t ie = 0; ie < velements.size(); ie++) {
+            int ib = element_slots[ie].first;
+            if (ib >= 0)
+                element_forces[ie] = &element_batches[ib]->GetInternalForces(element_slots[ie].second);
+        }
+    }
+
+    batches_valid = true;
+}
+
 void ChMesh::AddContactSurface(std::shared_ptr<ChContactSurface> m_surf) {
     m_surf->SetPhysicsItem(this);
     vcontactsurfaces.push_back(m_surf);
@@ -289,43 +438,69 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
     }
 
     int nthreads = GetSystem()->nthreads_chrono;
+    const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
 
     // elements internal forces
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+    if (batched_forces) {
+        // evaluate the internal forces of batched elements first; these are only loaded in R below
+        if (!batches_valid)
+            BuildElementBatches();
+        for (auto& batch : element_batches)
+            batch->ComputeInternalForces(nthreads);
+    }
+    if (colored_assembly) {
+        ForEachElementColored(nthreads, [this, &R, c](unsigned int ie) {
+            if (batched_forces && element_forces[ie])
+                velements[ie]->EleIntLoadResidual_Fi(R, *element_forces[ie], c, true);
+            else
+                velements[ie]->EleIntLoadResidual_F_exclusive(R, c);
+        });
+    } else {
+        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int ie = 0; ie < velements.size(); ie++) {
+            if (batched_forces && element_forces[ie])
+                velements[ie]->EleIntLoadResidual_Fi(R, *element_forces[ie], c, false);
+            else
+                velements[ie]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+        if (colored_assembly) {
+            ForEachElementColored(nthreads, [this, &R, &G_acc, c](unsigned int ie) {
+                velements[ie]->EleIntLoadResidual_F_gravity_exclusive(R, G_acc, c);
+            });
+        } else {
+            //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+            }
         }
     }
 
     // nodes gravity forces
-    local_off_v = 0;
     if (automatic_gravity_load && system) {
-        // #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
         //// PARALLEL FOR, (no need here to use omp atomic to avoid race condition in writing to R)
+        // Each node writes to its own entries of R, located using the node offset relative to that of the mesh.
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
         for (int in = 0; in < vnodes.size(); in++) {
             if (!vnodes[in]->IsFixed()) {
+                unsigned int local_off = vnodes[in]->NodeGetOffsetVelLevel() - GetOffset_w();
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(vnodes[in])) {
-                    ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector3d fg = c * mnode->GetMass() * G_acc;
+                    R.segment(off + local_off, 3) += fg.eigen();
                 }
                 // ChNodeFEAxyzrot is not inherited from ChNodeFEAxyz, so must deal with it too
                 if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(vnodes[in])) {
-                    ChVector3d fg = c * mnode->GetMass() * system->GetGravitationalAcceleration();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
+                    ChVector3d fg = c * mnode->GetMass() * G_acc;
+                    R.segment(off + local_off, 3) += fg.eigen();
                 }
-                local_off_v += vnodes[in]->GetNumCoordsVelLevelActive();
             }
         }
     }
@@ -418,8 +593,14 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
+    if (colored_assembly) {
+        ForEachElementColored(GetSystem()->nthreads_chrono, [this, &R, &w, c](unsigned int ie) {
+            velements[ie]->EleIntLoadResidual_Mv(R, w, c);
+        });
+    } else {
+        for (unsigned int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadResidual_Mv(R, w, c);
+        }
     }
 }
 
@@ -17,6 +17,7 @@
 
 #include <cstdlib>
 #include <cmath>
+#include <functional>
 
 #include "chrono/core/ChTimer.h"
 #include "chrono/physics/ChIndexedNodes.h"
@@ -32,6 +33,8 @@ class ChAssembly;
 
 namespace fea {
 
+class ChElementANCFBatch;
+
 /// @addtogroup chrono_fea
 /// @{
 
@@ -43,6 +46,10 @@ class ChApi ChMesh : public ChIndexedNodes {
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          colored_assembly(false),
+          colors_valid(false),
+          batched_forces(false),
+          batches_valid(false),
           ncalls_internal_forces(0),
           ncalls_KRMload(0) {}
     ChMesh(const ChMesh& other);
@@ -104,6 +111,36 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Enable/disable colored assembly of element forces (default: false).
+    /// If enabled, the mesh elements are graph-colored so that no two elements of the same color share a node. Element
+    /// internal forces, gravity forces, and mass-vector products are then loaded in the system residual one color at a
+    /// time, with all elements of a color processed concurrently and without atomic updates of the residual. This
+    /// replaces the default loop over all elements, which relies on atomic updates. Results may differ from those of
+    /// the default loop only in the order of floating-point summations.
+    void EnableColoredAssembly(bool val);
+
+    /// Return true if colored assembly of element forces is enabled.
+    bool IsColoredAssemblyEnabled() const { return colored_assembly; }
+
+    /// Return the number of element colors (0 if colored assembly is disabled or was not performed yet).
+    /// Elements which could not be colored are not counted here; these are processed sequentially, after all colors.
+    int GetNumColors() const { return color_start.empty() ? 0 : (int)color_start.size() - 1; }
+
+    /// Enable/disable batched evaluation of element internal forces (default: false).
+    /// If enabled, elements of the same type which support it (currently the ANCF elements ChElementHexaANCF_3843,
+    /// ChElementShellANCF_3833, and ChElementBeamANCF_3333 with the "Continuous Integration" method) are grouped in
+    /// batches, and their internal forces are evaluated together with a kernel vectorized across elements (see
+    /// ChElementANCFBatch). All other elements are evaluated individually. If the library was compiled without SIMD
+    /// support, no batches are created. Results may differ from those of the individual evaluation only in the order of
+    /// floating-point operations.
+    void EnableBatchedInternalForces(bool val);
+
+    /// Return true if batched evaluation of element internal forces is enabled.
+    bool IsBatchedInternalForcesEnabled() const { return batched_forces; }
+
+    /// Return the number of element batches (0 if batched evaluation is disabled or was not performed yet).
+    int GetNumElementBatches() const { return (int)element_batches.size(); }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -276,6 +313,17 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the mesh elements into colors, based on the nodes they share.
+    void ColorElements();
+
+    /// Invoke the given function for all elements, one color at a time, using the specified number of threads.
+    /// The function is called with the element index. Elements of the same color are processed concurrently; uncolored
+    /// elements are processed sequentially.
+    void ForEachElementColored(int nthreads, const std::function<void(unsigned int)>& func);
+
+    /// Group the mesh elements supporting batched evaluation of their internal forces in batches of same-type elements.
+    void BuildElementBatches();
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -288,6 +336,16 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    bool colored_assembly;                     ///< use colored assembly of element forces
+    bool colors_valid;                         ///< element coloring up to date
+    std::vector<unsigned int> color_elements;  ///< element indices, sorted by color (uncolored elements at the end)
+    std::vector<unsigned int> color_start;     ///< start of each color in color_elements
+
+    bool batched_forces;                                               ///< use batched internal force evaluation
+    bool batches_valid;                                                ///< element batches up to date
+    std::vector<std::shared_ptr<ChElementANCFBatch>> element_batches;  ///< batches of same-type elements
+    std::vector<const ChVectorDynamic<>*> element_forces;              ///< batched forces of each element
+
     ChTimer timer_internal_forces;
     ChTimer timer_KRMload;
     unsigned int ncalls_internal_forces;
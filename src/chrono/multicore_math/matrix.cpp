@@ -429,7 +429,7 @@ ChApi inline Mat33 MAbs(const real* M) {
 //[1,5,9 ]
 //[2,6,10]
 //[3,7,11]
-ChApi real3 operator*(const Mat33& M, const real3& v) {
+CH_SIMD_CLONES ChApi real3 operator*(const Mat33& M, const real3& v) {
     return MulMV(M.array, v.array);
 }
 
@@ -437,7 +437,7 @@ ChApi Mat33 operator*(const Mat33& N, const real scale) {
     return ScaleMat(N.array, scale);
 }
 
-ChApi Mat33 operator*(const Mat33& M, const Mat33& N) {
+CH_SIMD_CLONES ChApi Mat33 operator*(const Mat33& M, const Mat33& N) {
     return MulMM(M.array, N.array);
 }
 ChApi Mat33 operator+(const Mat33& M, const Mat33& N) {
@@ -463,41 +463,41 @@ ChApi OPERATOR_EQUALSALT(*, real, Mat33)       //
 ChApi Mat33 operator*(const real s, const Mat33& a) {
     return a * s;
 }
-ChApi Mat33 Abs(const Mat33& m) {
+CH_SIMD_CLONES ChApi Mat33 Abs(const Mat33& m) {
     return MAbs(m.array);
 }
-ChApi Mat33 SkewSymmetric(const real3& r) {
+CH_SIMD_CLONES ChApi Mat33 SkewSymmetric(const real3& r) {
     return Mat33(0, r[2], -r[1], -r[2], 0, r[0], r[1], -r[0], 0);
 }
-ChApi Mat33 SkewSymmetricAlt(const real3& r) {
+CH_SIMD_CLONES ChApi Mat33 SkewSymmetricAlt(const real3& r) {
     return Mat33(0, r[2], r[1], r[2], 0, r[0], r[1], r[0], 0);
 }
-ChApi Mat33 MultTranspose(const Mat33& M, const Mat33& N) {
+CH_SIMD_CLONES ChApi Mat33 MultTranspose(const Mat33& M, const Mat33& N) {
     // Not a clean way to write this in AVX, might as well transpose first and then multiply
     return M * Transpose(N);
 }
 
-ChApi Mat33 TransposeMult(const Mat33& M, const Mat33& N) {
+CH_SIMD_CLONES ChApi Mat33 TransposeMult(const Mat33& M, const Mat33& N) {
     return MulM_TM(M.array, N.array);
 }
 
-ChApi Mat33 Transpose(const Mat33& a) {
+CH_SIMD_CLONES ChApi Mat33 Transpose(const Mat33& a) {
     return Mat33(a[0], a[4], a[8], a[1], a[5], a[9], a[2], a[6], a[10]);
 }
 
-ChApi real Trace(const Mat33& m) {
+CH_SIMD_CLONES ChApi real Trace(const Mat33& m) {
     return m[0] + m[5] + m[10];
 }
 // Multiply a 3x1 by a 1x3 to get a 3x3
-ChApi Mat33 OuterProduct(const real3& a, const real3& b) {
+CH_SIMD_CLONES ChApi Mat33 OuterProduct(const real3& a, const real3& b) {
     return OuterProductVV(a.array, b.array);
 }
 
-ChApi real InnerProduct(const Mat33& A, const Mat33& B) {
+CH_SIMD_CLONES ChApi real InnerProduct(const Mat33& A, const Mat33& B) {
     return simd::HorizontalAdd(DotMM(A.array, B.array));
 }
 
-ChApi Mat33 Adjoint(const Mat33& A) {
+CH_SIMD_CLONES ChApi Mat33 Adjoint(const Mat33& A) {
     Mat33 T;
     T[0] = A[5] * A[10] - A[9] * A[6];
     T[1] = -A[1] * A[10] + A[9] * A[2];
@@ -513,7 +513,7 @@ ChApi Mat33 Adjoint(const Mat33& A) {
     return T;
 }
 
-ChApi Mat33 AdjointTranspose(const Mat33& A) {
+CH_SIMD_CLONES ChApi Mat33 AdjointTranspose(const Mat33& A) {
     Mat33 T;
     T[0] = A[5] * A[10] - A[9] * A[6];
     T[1] = -A[4] * A[10] + A[8] * A[6];
@@ -530,12 +530,12 @@ ChApi Mat33 AdjointTranspose(const Mat33& A) {
     return T;
 }
 
-ChApi real Determinant(const Mat33& m) {
+CH_SIMD_CLONES ChApi real Determinant(const Mat33& m) {
     return m[0] * (m[5] * m[10] - m[9] * m[6]) - m[4] * (m[1] * m[10] - m[9] * m[2]) +
            m[8] * (m[1] * m[6] - m[5] * m[2]);
 }
 
-ChApi Mat33 Inverse(const Mat33& A) {
+CH_SIMD_CLONES ChApi Mat33 Inverse(const Mat33& A) {
     real s = Determinant(A);
     if (s > 0.0) {
         return Adjoint(A) * real(1.0 / s);
@@ -545,7 +545,7 @@ ChApi Mat33 Inverse(const Mat33& A) {
 }
 
 // Same as inverse but we store it transposed
-ChApi Mat33 InverseTranspose(const Mat33& A) {
+CH_SIMD_CLONES ChApi Mat33 InverseTranspose(const Mat33& A) {
     real s = Determinant(A);
     if (s > 0.0) {
         return AdjointTranspose(A) * real(1.0 / s);
@@ -553,28 +553,28 @@ ChApi Mat33 InverseTranspose(const Mat33& A) {
         return Mat33(0);
     }
 }
-ChApi Mat33 InverseUnsafe(const Mat33& A) {
+CH_SIMD_CLONES ChApi Mat33 InverseUnsafe(const Mat33& A) {
     real s = Determinant(A);
     return Adjoint(A) * real(1.0 / s);
 }
 
 // Same as inverse but we store it transposed
-ChApi Mat33 InverseTransposeUnsafe(const Mat33& A) {
+CH_SIMD_CLONES ChApi Mat33 InverseTransposeUnsafe(const Mat33& A) {
     real s = Determinant(A);
     return AdjointTranspose(A) * real(1.0 / s);
 }
-ChApi real Norm(const Mat33& A) {
+CH_SIMD_CLONES ChApi real Norm(const Mat33& A) {
     return Sqrt(Trace(A * Transpose(A)));
 }
-ChApi real NormSq(const Mat33& A) {
+CH_SIMD_CLONES ChApi real NormSq(const Mat33& A) {
     return Trace(A * Transpose(A));
 }
-ChApi real DoubleDot(const Mat33& A, const Mat33& B) {
+CH_SIMD_CLONES ChApi real DoubleDot(const Mat33& A, const Mat33& B) {
     return A[0] * B[0] + A[1] * B[1] + A[2] * B[2] + A[4] * B[4] + A[5] * B[5] + A[6] * B[6] + A[8] * B[8] +
            A[9] * B[9] + A[10] * B[10];
 }
 
-ChApi real3 LargestColumnNormalized(const Mat33& A) {
+CH_SIMD_CLONES ChApi real3 LargestColumnNormalized(const Mat33& A) {
     real3 scale = DotMM(A.array);
     real3 sqrt_scale = simd::SquareRoot(scale);
     if (scale.x > scale.y) {
@@ -588,11 +588,11 @@ ChApi real3 LargestColumnNormalized(const Mat33& A) {
 }
 //// ========================================================================================
 
-ChApi Mat33 operator*(const DiagMat33& M, const Mat33& N) {
+CH_SIMD_CLONES ChApi Mat33 operator*(const DiagMat33& M, const Mat33& N) {
     return Mat33(M.x11 * N[0], M.x22 * N[1], M.x33 * N[2], M.x11 * N[4], M.x22 * N[5], M.x33 * N[6], M.x11 * N[8],
                  M.x22 * N[9], M.x33 * N[10]);
 }
-ChApi real3 operator*(const DiagMat33& M, const real3& v) {
+CH_SIMD_CLONES ChApi real3 operator*(const DiagMat33& M, const real3& v) {
     real3 result;
     result.x = M.x11 * v.x;
     result.y = M.x22 * v.y;
@@ -603,7 +603,7 @@ ChApi real3 operator*(const DiagMat33& M, const real3& v) {
 ChApi SymMat33 operator-(const SymMat33& M, const real& v) {
     return SymMat33(M.x11 - v, M.x21, M.x31, M.x22 - v, M.x32, M.x33 - v);  // only subtract diagonal
 }
-ChApi SymMat33 CofactorMatrix(const SymMat33& A) {
+CH_SIMD_CLONES ChApi SymMat33 CofactorMatrix(const SymMat33& A) {
     SymMat33 T;
     T.x11 = A.x22 * A.x33 - A.x32 * A.x32;   //
     T.x21 = -A.x21 * A.x33 + A.x32 * A.x31;  //
@@ -613,7 +613,7 @@ ChApi SymMat33 CofactorMatrix(const SymMat33& A) {
     T.x33 = A.x11 * A.x22 - A.x21 * A.x21;   //
     return T;
 }
-ChApi real3 LargestColumnNormalized(const SymMat33& A) {
+CH_SIMD_CLONES ChApi real3 LargestColumnNormalized(const SymMat33& A) {
     real scale1 = Length2(real3(A.x11, A.x21, A.x31));
     real scale2 = Length2(real3(A.x21, A.x22, A.x32));
     real scale3 = Length2(real3(A.x31, A.x32, A.x33));
@@ -630,12 +630,12 @@ ChApi real3 LargestColumnNormalized(const SymMat33& A) {
         return (real3(1, 0, 0));
     }
 }
-ChApi SymMat33 NormalEquationsMatrix(const Mat33& A) {
+CH_SIMD_CLONES ChApi SymMat33 NormalEquationsMatrix(const Mat33& A) {
     return NormalEquations(A.array);
 }
 //// ========================================================================================
 
-ChApi real3 operator*(const Mat32& M, const real2& v) {
+CH_SIMD_CLONES ChApi real3 operator*(const Mat32& M, const real2& v) {
     real3 result;
     result.x = M[0] * v.x + M[4] * v.y;
     result.y = M[1] * v.x + M[5] * v.y;
@@ -643,7 +643,7 @@ ChApi real3 operator*(const Mat32& M, const real2& v) {
 
     return result;
 }
-ChApi Mat32 operator*(const SymMat33& M, const Mat32& N) {
+CH_SIMD_CLONES ChApi Mat32 operator*(const SymMat33& M, const Mat32& N) {
     Mat32 result;
     // x11 x21 x31  c11 c12
     // x21 x22 x32  c21 c22
@@ -662,14 +662,14 @@ ChApi Mat32 operator*(const SymMat33& M, const Mat32& N) {
 ChApi SymMat22 operator-(const SymMat22& M, const real& v) {
     return SymMat22(M.x11 - v, M.x21, M.x22 - v);  //
 }
-ChApi SymMat22 CofactorMatrix(const SymMat22& A) {
+CH_SIMD_CLONES ChApi SymMat22 CofactorMatrix(const SymMat22& A) {
     SymMat22 T;
     T.x11 = A.x22;   //
     T.x21 = -A.x21;  //
     T.x22 = A.x11;   //
     return T;
 }
-ChApi real2 LargestColumnNormalized(const SymMat22& A) {
+CH_SIMD_CLONES ChApi real2 LargestColumnNormalized(const SymMat22& A) {
     real scale1 = Length2(real2(A.x11, A.x21));
     real scale2 = Length2(real2(A.x21, A.x22));
     if (scale1 > scale2) {
@@ -682,7 +682,7 @@ ChApi real2 LargestColumnNormalized(const SymMat22& A) {
 }
 
 // A^T*B
-ChApi SymMat22 TransposeTimesWithSymmetricResult(const Mat32& A, const Mat32& B) {
+CH_SIMD_CLONES ChApi SymMat22 TransposeTimesWithSymmetricResult(const Mat32& A, const Mat32& B) {
     SymMat22 T;
     T.x11 = A[0] * B[0] + A[1] * B[1] + A[2] * B[2];
     T.x21 = A[4] * B[0] + A[5] * B[1] + A[6] * B[2];
@@ -691,7 +691,7 @@ ChApi SymMat22 TransposeTimesWithSymmetricResult(const Mat32& A, const Mat32& B)
     return T;
 }
 
-ChApi SymMat22 ConjugateWithTranspose(const Mat32& A, const SymMat33& B) {
+CH_SIMD_CLONES ChApi SymMat22 ConjugateWithTranspose(const Mat32& A, const SymMat33& B) {
     return TransposeTimesWithSymmetricResult(B * A, A);
 }
 
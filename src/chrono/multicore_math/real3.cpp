@@ -97,22 +97,22 @@ ChApi OPERATOR_EQUALS_IMPL(/, real3, real3);
 ChApi OPERATOR_EQUALS_IMPL(+, real3, real3);
 ChApi OPERATOR_EQUALS_IMPL(-, real3, real3);
 
-ChApi real Dot(const real3& v1, const real3& v2) {
+CH_SIMD_CLONES ChApi real Dot(const real3& v1, const real3& v2) {
     // return v1.x * v2.x + v1.y * v2.y + v1.z * v2.z;
     return simd::Dot3(v1, v2);
 }
 
-ChApi real Dot(const real3& v) {
+CH_SIMD_CLONES ChApi real Dot(const real3& v) {
     // return v.x * v.x + v.y * v.y + v.z * v.z;
     return simd::Dot3(v);
 }
 
-ChApi real3 Normalize(const real3& v) {
+CH_SIMD_CLONES ChApi real3 Normalize(const real3& v) {
     // return simd::Normalize3(v);
     return v / Sqrt(Dot(v));
 }
 
-ChApi real Length(const real3& v) {
+CH_SIMD_CLONES ChApi real Length(const real3& v) {
     return Sqrt(Dot(v));
     // return simd::Length3(v);
 }
@@ -121,7 +121,7 @@ ChApi real3 Sqrt(const real3& v) {
     return simd::SquareRoot(v);
 }
 
-ChApi real3 Cross(const real3& b, const real3& c) {
+CH_SIMD_CLONES ChApi real3 Cross(const real3& b, const real3& c) {
 #if defined(CHRONO_AVX_2_0) && defined(CHRONO_HAS_FMA)
     return simd::Cross3(b, c);
 #else
@@ -165,11 +165,11 @@ ChApi real Min(const real3& a) {
     return simd::Min3(a);
 }
 
-ChApi real Length2(const real3& v1) {
+CH_SIMD_CLONES ChApi real Length2(const real3& v1) {
     return Dot(v1);
 }
 
-ChApi real SafeLength(const real3& v) {
+CH_SIMD_CLONES ChApi real SafeLength(const real3& v) {
     real len_sq = Length2(v);
     if (len_sq) {
         return Sqrt(len_sq);
@@ -178,7 +178,7 @@ ChApi real SafeLength(const real3& v) {
     }
 }
 
-ChApi real3 SafeNormalize(const real3& v, const real3& safe) {
+CH_SIMD_CLONES ChApi real3 SafeNormalize(const real3& v, const real3& safe) {
     real len_sq = Length2(v);
     if (len_sq > real(0)) {
         return v * InvSqrt(len_sq);
@@ -259,7 +259,7 @@ ChApi bool IsZero(const real3& v) {
     return simd::IsZero(v, C_REAL_EPSILON);
 }
 
-ChApi real3 OrthogonalVector(const real3& v) {
+CH_SIMD_CLONES ChApi real3 OrthogonalVector(const real3& v) {
     real3 abs = Abs(v);
     if (abs.x < abs.y) {
         return abs.x < abs.z ? real3(0, v.z, -v.y) : real3(v.y, -v.x, 0);
@@ -268,7 +268,7 @@ ChApi real3 OrthogonalVector(const real3& v) {
     }
 }
 
-ChApi real3 UnitOrthogonalVector(const real3& v) {
+CH_SIMD_CLONES ChApi real3 UnitOrthogonalVector(const real3& v) {
     return Normalize(OrthogonalVector(v));
 }
 
@@ -77,7 +77,11 @@ ChApi real4 operator-(const real4& a) {
     return simd::Negate(a);
 }
 
-ChApi real4 Dot4(const real3& v, const real3& v1, const real3& v2, const real3& v3, const real3& v4) {
+CH_SIMD_CLONES ChApi real4 Dot4(const real3& v,
+                                const real3& v1,
+                                const real3& v2,
+                                const real3& v3,
+                                const real3& v4) {
     return simd::Dot4(v, v1, v2, v3, v4);
 }
 
@@ -130,15 +134,15 @@ ChApi quaternion Inv(const quaternion& a) {
     return (~a) / t1;
 }
 
-ChApi real Dot(const quaternion& v1, const quaternion& v2) {
+CH_SIMD_CLONES ChApi real Dot(const quaternion& v1, const quaternion& v2) {
     return simd::Dot4(v1, v2);
 }
 
-ChApi real Dot(const quaternion& v) {
+CH_SIMD_CLONES ChApi real Dot(const quaternion& v) {
     return simd::Dot4(v);
 }
 
-ChApi quaternion Mult(const quaternion& a, const quaternion& b) {
+CH_SIMD_CLONES ChApi quaternion Mult(const quaternion& a, const quaternion& b) {
 #if defined(CHRONO_AVX_2_0)
     return simd::QuatMult(a, b);
 #else
@@ -151,21 +155,21 @@ ChApi quaternion Mult(const quaternion& a, const quaternion& b) {
 #endif
 }
 
-ChApi quaternion Normalize(const quaternion& v) {
+CH_SIMD_CLONES ChApi quaternion Normalize(const quaternion& v) {
     return simd::Normalize(v);
 }
 
-ChApi real3 Rotate(const real3& v, const quaternion& q) {
+CH_SIMD_CLONES ChApi real3 Rotate(const real3& v, const quaternion& q) {
     real3 t = 2 * Cross(q.vect(), v);
     return v + q.w * t + Cross(q.vect(), t);
 }
 
-ChApi real3 RotateT(const real3& v, const quaternion& q) {
+CH_SIMD_CLONES ChApi real3 RotateT(const real3& v, const quaternion& q) {
     return Rotate(v, ~q);
 }
 
 // Rotate a vector with the absolute value of a rotation matrix generated by a quaternion
-ChApi real3 AbsRotate(const quaternion& q, const real3& v) {
+CH_SIMD_CLONES ChApi real3 AbsRotate(const quaternion& q, const real3& v) {
     real e0e0 = q.w * q.w;
     real e1e1 = q.x * q.x;
     real e2e2 = q.y * q.y;
@@ -188,7 +192,7 @@ ChApi real3 AbsRotate(const quaternion& q, const real3& v) {
     return result;
 }
 
-ChApi quaternion QuatFromAngleAxis(const real& angle, const real3& axis) {
+CH_SIMD_CLONES ChApi quaternion QuatFromAngleAxis(const real& angle, const real3& axis) {
     quaternion quat;
     real halfang;
     real sinhalf;
@@ -201,7 +205,7 @@ ChApi quaternion QuatFromAngleAxis(const real& angle, const real3& axis) {
     return (quat);
 }
 
-ChApi real3 AMatU(const quaternion& q) {
+CH_SIMD_CLONES ChApi real3 AMatU(const quaternion& q) {
     real3 V;
 
     real e0e0 = q.w * q.w;
@@ -218,7 +222,7 @@ ChApi real3 AMatU(const quaternion& q) {
     return V;
 }
 
-ChApi real3 AMatV(const quaternion& q) {
+CH_SIMD_CLONES ChApi real3 AMatV(const quaternion& q) {
     real3 V;
 
     real e0e0 = q.w * q.w;
@@ -235,7 +239,7 @@ ChApi real3 AMatV(const quaternion& q) {
     return V;
 }
 
-ChApi real3 AMatW(const quaternion& q) {
+CH_SIMD_CLONES ChApi real3 AMatW(const quaternion& q) {
     real3 V;
 
     real e0e0 = q.w * q.w;
@@ -48,3 +48,31 @@
     #undef USE_AVX
     #undef USE_SSE
 #endif
+
+// Runtime dispatch: functions marked with CH_SIMD_CLONES are compiled for several instruction sets and the variant
+// best supported by the host CPU is selected when the library is loaded (GNU indirect functions). This allows a single
+// binary, built for a conservative target, to use AVX2/FMA and AVX-512 in the hot multicore kernels.
+// Variants are selected by feature level (x86-64-v3: AVX2/FMA/BMI2, x86-64-v4: AVX-512), not by CPU model, so that
+// any CPU supporting these instructions (Intel or AMD) uses them.
+#if defined(CHRONO_SIMD_DISPATCH)
+    #define CH_SIMD_CLONES __attribute__((target_clones("default", "arch=x86-64-v3", "arch=x86-64-v4")))
+#else
+    #define CH_SIMD_CLONES
+#endif
+
+namespace chrono {
+
+/// Return the instruction set of the variants selected at run time for functions marked with CH_SIMD_CLONES.
+/// This is one of "avx512", "avx2", or "default" (also returned if runtime dispatch is disabled).
+inline const char* GetSimdDispatchTarget() {
+#if defined(CHRONO_SIMD_DISPATCH)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("x86-64-v4"))
+        return "avx512";
+    if (__builtin_cpu_supports("x86-64-v3"))
+        return "avx2";
+#endif
+    return "default";
+}
+
+}  // end namespace chrono
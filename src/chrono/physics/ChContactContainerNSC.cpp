@@ -21,54 +21,9 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerNSC)
 
-ChContactContainerNSC::ChContactContainerNSC()
-    : n_added_6_6(0),
-      n_added_6_3(0),
-      n_added_3_3(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0),
-      n_added_33_3(0),
-      n_added_33_6(0),
-      n_added_33_333(0),
-      n_added_33_666(0),
-      n_added_33_33(0),
-      n_added_66_3(0),
-      n_added_66_6(0),
-      n_added_66_333(0),
-      n_added_66_666(0),
-      n_added_66_33(0),
-      n_added_66_66(0),
-      n_added_6_6_rolling(0) {}
-
-ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other)
-    : ChContactContainer(other),
-      n_added_3_3(0),
-      n_added_6_3(0),
-      n_added_6_6(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0),
-      n_added_33_3(0),
-      n_added_33_6(0),
-      n_added_33_333(0),
-      n_added_33_666(0),
-      n_added_33_33(0),
-      n_added_66_3(0),
-      n_added_66_6(0),
-      n_added_66_333(0),
-      n_added_66_666(0),
-      n_added_66_33(0),
-      n_added_66_66(0),
-      n_added_6_6_rolling(0) {}
+ChContactContainerNSC::ChContactContainerNSC() {}
+
+ChContactContainerNSC::ChContactContainerNSC(const ChContactContainerNSC& other) : ChContactContainer(other) {}
 
 ChContactContainerNSC::~ChContactContainerNSC() {
     RemoveAllContacts();
@@ -79,222 +34,115 @@ void ChContactContainerNSC::Update(double time, bool update_assets) {
     ChContactContainer::Update(time, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerNSC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-
-    _RemoveAllContacts(contactlist_33_3, lastcontact_33_3, n_added_33_3);
-    _RemoveAllContacts(contactlist_33_6, lastcontact_33_6, n_added_33_6);
-    _RemoveAllContacts(contactlist_33_333, lastcontact_33_333, n_added_33_333);
-    _RemoveAllContacts(contactlist_33_666, lastcontact_33_666, n_added_33_666);
-    _RemoveAllContacts(contactlist_33_33, lastcontact_33_33, n_added_33_33);
-
-    _RemoveAllContacts(contactlist_66_3, lastcontact_66_3, n_added_66_3);
-    _RemoveAllContacts(contactlist_66_6, lastcontact_66_6, n_added_66_6);
-    _RemoveAllContacts(contactlist_66_333, lastcontact_66_333, n_added_66_333);
-    _RemoveAllContacts(contactlist_66_666, lastcontact_66_666, n_added_66_666);
-    _RemoveAllContacts(contactlist_66_33, lastcontact_66_33, n_added_66_33);
-    _RemoveAllContacts(contactlist_66_66, lastcontact_66_66, n_added_66_66);
-
-    _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
+    contactlist_3_3.Clear();
+
+    contactlist_6_6.Clear();
+    contactlist_6_3.Clear();
+
+    contactlist_333_3.Clear();
+    contactlist_333_6.Clear();
+    contactlist_333_333.Clear();
+
+    contactlist_666_3.Clear();
+    contactlist_666_6.Clear();
+    contactlist_666_333.Clear();
+    contactlist_666_666.Clear();
+
+    contactlist_33_3.Clear();
+    contactlist_33_6.Clear();
+    contactlist_33_333.Clear();
+    contactlist_33_666.Clear();
+    contactlist_33_33.Clear();
+
+    contactlist_66_3.Clear();
+    contactlist_66_6.Clear();
+    contactlist_66_333.Clear();
+    contactlist_66_666.Clear();
+    contactlist_66_33.Clear();
+    contactlist_66_66.Clear();
+
+    contactlist_6_6_rolling.Clear();
 }
 
 void ChContactContainerNSC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
-
-    lastcontact_33_3 = contactlist_33_3.begin();
-    n_added_33_3 = 0;
-    lastcontact_33_6 = contactlist_33_6.begin();
-    n_added_33_6 = 0;
-    lastcontact_33_333 = contactlist_33_333.begin();
-    n_added_33_333 = 0;
-    lastcontact_33_666 = contactlist_33_666.begin();
-    n_added_33_666 = 0;
-    lastcontact_33_33 = contactlist_33_33.begin();
-    n_added_33_33 = 0;
-
-    lastcontact_66_3 = contactlist_66_3.begin();
-    n_added_66_3 = 0;
-    lastcontact_66_6 = contactlist_66_6.begin();
-    n_added_66_6 = 0;
-    lastcontact_66_333 = contactlist_66_333.begin();
-    n_added_66_333 = 0;
-    lastcontact_66_666 = contactlist_66_666.begin();
-    n_added_66_666 = 0;
-    lastcontact_66_33 = contactlist_66_33.begin();
-    n_added_66_33 = 0;
-    lastcontact_66_66 = contactlist_66_66.begin();
-    n_added_66_66 = 0;
-
-    lastcontact_6_6_rolling = contactlist_6_6_rolling.begin();
-    n_added_6_6_rolling = 0;
+    contactlist_3_3.Rewind();
+
+    contactlist_6_6.Rewind();
+    contactlist_6_3.Rewind();
+
+    contactlist_333_3.Rewind();
+    contactlist_333_6.Rewind();
+    contactlist_333_333.Rewind();
+
+    contactlist_666_3.Rewind();
+    contactlist_666_6.Rewind();
+    contactlist_666_333.Rewind();
+    contactlist_666_666.Rewind();
+
+    contactlist_33_3.Rewind();
+    contactlist_33_6.Rewind();
+    contactlist_33_333.Rewind();
+    contactlist_33_666.Rewind();
+    contactlist_33_33.Rewind();
+
+    contactlist_66_3.Rewind();
+    contactlist_66_6.Rewind();
+    contactlist_66_333.Rewind();
+    contactlist_66_666.Rewind();
+    contactlist_66_33.Rewind();
+    contactlist_66_66.Rewind();
+
+    contactlist_6_6_rolling.Rewind();
 }
 
 void ChContactContainerNSC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
-
-    while (lastcontact_33_3 != contactlist_33_3.end()) {
-        delete (*lastcontact_33_3);
-        lastcontact_33_3 = contactlist_33_3.erase(lastcontact_33_3);
-    }
-    while (lastcontact_33_6 != contactlist_33_6.end()) {
-        delete (*lastcontact_33_6);
-        lastcontact_33_6 = contactlist_33_6.erase(lastcontact_33_6);
-    }
-    while (lastcontact_33_333 != contactlist_33_333.end()) {
-        delete (*lastcontact_33_333);
-        lastcontact_33_333 = contactlist_33_333.erase(lastcontact_33_333);
-    }
-    while (lastcontact_33_666 != contactlist_33_666.end()) {
-        delete (*lastcontact_33_666);
-        lastcontact_33_666 = contactlist_33_666.erase(lastcontact_33_666);
-    }
-    while (lastcontact_33_33 != contactlist_33_33.end()) {
-        delete (*lastcontact_33_33);
-        lastcontact_33_33 = contactlist_33_33.erase(lastcontact_33_33);
-    }
-
-    while (lastcontact_66_3 != contactlist_66_3.end()) {
-        delete (*lastcontact_66_3);
-        lastcontact_66_3 = contactlist_66_3.erase(lastcontact_66_3);
-    }
-    while (lastcontact_66_6 != contactlist_66_6.end()) {
-        delete (*lastcontact_66_6);
-        lastcontact_66_6 = contactlist_66_6.erase(lastcontact_66_6);
-    }
-    while (lastcontact_66_333 != contactlist_66_333.end()) {
-        delete (*lastcontact_66_333);
-        lastcontact_66_333 = contactlist_66_333.erase(lastcontact_66_333);
-    }
-    while (lastcontact_66_666 != contactlist_66_666.end()) {
-        delete (*lastcontact_66_666);
-        lastcontact_66_666 = contactlist_66_666.erase(lastcontact_66_666);
-    }
-    while (lastcontact_66_33 != contactlist_66_33.end()) {
-        delete (*lastcontact_66_33);
-        lastcontact_66_33 = contactlist_66_33.erase(lastcontact_66_33);
-    }
-    while (lastcontact_66_66 != contactlist_66_66.end()) {
-        delete (*lastcontact_66_66);
-        lastcontact_66_66 = contactlist_66_66.erase(lastcontact_66_66);
-    }
-
-    while (lastcontact_6_6_rolling != contactlist_6_6_rolling.end()) {
-        delete (*lastcontact_6_6_rolling);
-        lastcontact_6_6_rolling = contactlist_6_6_rolling.erase(lastcontact_6_6_rolling);
-    }
+    // destroy contacts that were not reused
+    contactlist_3_3.Trim();
+
+    contactlist_6_6.Trim();
+    contactlist_6_3.Trim();
+
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
+
+    contactlist_33_3.Trim();
+    contactlist_33_6.Trim();
+    contactlist_33_333.Trim();
+    contactlist_33_666.Trim();
+    contactlist_33_33.Trim();
+
+    contactlist_66_3.Trim();
+    contactlist_66_6.Trim();
+    contactlist_66_333.Trim();
+    contactlist_66_666.Trim();
+    contactlist_66_33.Trim();
+    contactlist_66_66.Trim();
+
+    contactlist_6_6_rolling.Trim();
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
-                           int& n_added,                              // number of contacts inserted
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactlist,         // contact pool
                            ChContactContainerNSC* container,          // contact container
                            Ta* objA,                                  // collidable object A
                            Tb* objB,                                  // collidable object B
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeNSC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
+    if (Tcont* mc = contactlist.Reuse()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        lastcontact++;
+        mc->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        contactlist.Emplace(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
     }
-    n_added++;
 }
 
 void ChContactContainerNSC::AddContact(const ChCollisionInfo& cinfo,
@@ -375,37 +223,32 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 3_33 -> 33_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_3, lastcontact_33_3, n_added_33_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 3_66 -> 66_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_3, lastcontact_66_3, n_added_66_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -415,40 +258,35 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6    ***NOTE: for body-body one could have rolling friction: ***
                 if (cmat.rolling_friction || cmat.spinning_friction) {
-                    _OptimalContactInsert(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, this,
-                                          objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6_rolling, this, objA, objB, cinfo, cmat);
                 } else {
-                    _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                    _OptimalContactInsert(contactlist_6_6, this, objA, objB, cinfo, cmat);
                 }
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 6_33 -> 33_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_6, lastcontact_33_6, n_added_33_6, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 6_66 -> 66_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_6, lastcontact_66_6, n_added_66_6, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -458,36 +296,30 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 333_33 -> 33_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_333, lastcontact_33_333, n_added_33_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_333, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 333_66 -> 66_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_333, lastcontact_66_333, n_added_66_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -497,35 +329,29 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 666_33 -> 33_666
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_666, lastcontact_33_666, n_added_33_666, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_666, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 666_66 -> 66_666
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_666, lastcontact_66_666, n_added_66_666, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_666, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -535,32 +361,28 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 33_3
-                _OptimalContactInsert(contactlist_33_3, lastcontact_33_3, n_added_33_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 33_6
-                _OptimalContactInsert(contactlist_33_6, lastcontact_33_6, n_added_33_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 33_333
-                _OptimalContactInsert(contactlist_33_333, lastcontact_33_333, n_added_33_333, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 33_666
-                _OptimalContactInsert(contactlist_33_666, lastcontact_33_666, n_added_33_666, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_666, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 33_33
-                _OptimalContactInsert(contactlist_33_33, lastcontact_33_33, n_added_33_33, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_33, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 33_66 -> 66_33
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_33, lastcontact_66_33, n_added_66_33, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_33, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -570,31 +392,27 @@ void ChContactContainerNSC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 66_3
-                _OptimalContactInsert(contactlist_66_3, lastcontact_66_3, n_added_66_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 66_6
-                _OptimalContactInsert(contactlist_66_6, lastcontact_66_6, n_added_66_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 66_333
-                _OptimalContactInsert(contactlist_66_333, lastcontact_66_333, n_added_66_333, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 66_666
-                _OptimalContactInsert(contactlist_66_666, lastcontact_66_666, n_added_66_666, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_666, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 66_33
-                _OptimalContactInsert(contactlist_66_33, lastcontact_66_33, n_added_66_33, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_33, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 66_66
-                _OptimalContactInsert(contactlist_66_66, lastcontact_66_66, n_added_66_66, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_66, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -655,8 +473,8 @@ ChVector3d ChContactContainerNSC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -669,8 +487,9 @@ void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::Repo
 }
 
 template <class Tcont>
-void _ReportAllContactsRolling(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsRolling(ChContactPool<Tcont>& contactlist,
+                               ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -715,8 +534,9 @@ void ChContactContainerNSC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 }
 
 template <class Tcont>
-void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContactsNSC(ChContactPool<Tcont>& contactlist,
+                           ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -730,9 +550,9 @@ void _ReportAllContactsNSC(std::list<Tcont*>& contactlist, ChContactContainerNSC
 }
 
 template <class Tcont>
-void _ReportAllContactsRollingNSC(std::list<Tcont*>& contactlist,
+void _ReportAllContactsRollingNSC(ChContactPool<Tcont>& contactlist,
                                   ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -780,11 +600,11 @@ void ChContactContainerNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCa
 
 template <class Tcont>
 void _IntStateGatherReactions(unsigned int& coffset,
-                              std::list<Tcont*>& contactlist,
+                              ChContactPool<Tcont>& contactlist,
                               const unsigned int off_L,
                               ChVectorDynamic<>& L,
                               const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
         coffset += stride;
@@ -827,11 +647,11 @@ void ChContactContainerNSC::IntStateGatherReactions(const unsigned int off_L, Ch
 
 template <class Tcont>
 void _IntStateScatterReactions(unsigned int& coffset,
-                               std::list<Tcont*>& contactlist,
+                               ChContactPool<Tcont>& contactlist,
                                const unsigned int off_L,
                                const ChVectorDynamic<>& L,
                                const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
         coffset += stride;
@@ -874,14 +694,14 @@ void ChContactContainerNSC::IntStateScatterReactions(const unsigned int off_L, c
 
 template <class Tcont>
 void _IntLoadResidual_CqL(unsigned int& coffset,           // offset of the contacts
-                          std::list<Tcont*>& contactlist,  // list of contacts
+                          ChContactPool<Tcont>& contactlist,  // list of contacts
                           const unsigned int off_L,        // offset in L multipliers
                           ChVectorDynamic<>& R,            // result: the R residual, R += c*Cq'*L
                           const ChVectorDynamic<>& L,      // the L vector
                           const double c,                  // a scaling factor
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
         coffset += stride;
@@ -927,7 +747,7 @@ void ChContactContainerNSC::IntLoadResidual_CqL(const unsigned int off_L,
 
 template <class Tcont>
 void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
-                          std::list<Tcont*>& contactlist,  // contact list
+                          ChContactPool<Tcont>& contactlist,  // contact list
                           const unsigned int off,          // offset in Qc residual
                           ChVectorDynamic<>& Qc,           // result: the Qc residual, Qc += c*C
                           const double c,                  // a scaling factor
@@ -935,7 +755,7 @@ void _IntLoadConstraint_C(unsigned int& coffset,           // contact offset
                           double recovery_clamp,           // value for min/max clamping of c*C
                           const int stride                 // stride
 ) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
         coffset += stride;
@@ -982,7 +802,7 @@ void ChContactContainerNSC::IntLoadConstraint_C(const unsigned int off,
 
 template <class Tcont>
 void _IntToDescriptor(unsigned int& coffset,
-                      std::list<Tcont*>& contactlist,
+                      ChContactPool<Tcont>& contactlist,
                       const unsigned int off_v,
                       const ChStateDelta& v,
                       const ChVectorDynamic<>& R,
@@ -990,7 +810,7 @@ void _IntToDescriptor(unsigned int& coffset,
                       const ChVectorDynamic<>& L,
                       const ChVectorDynamic<>& Qc,
                       const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
         coffset += stride;
@@ -1038,13 +858,13 @@ void ChContactContainerNSC::IntToDescriptor(const unsigned int off_v,
 
 template <class Tcont>
 void _IntFromDescriptor(unsigned int& coffset,
-                        std::list<Tcont*>& contactlist,
+                        ChContactPool<Tcont>& contactlist,
                         const unsigned int off_v,
                         ChStateDelta& v,
                         const unsigned int off_L,
                         ChVectorDynamic<>& L,
                         const int stride) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
         coffset += stride;
@@ -1091,8 +911,8 @@ void ChContactContainerNSC::IntFromDescriptor(const unsigned int off_v,
 // SOLVER INTERFACES
 
 template <class Tcont>
-void _InjectConstraints(std::list<Tcont*>& contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectConstraints(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->InjectConstraints(descriptor);
         ++itercontact;
@@ -1131,8 +951,8 @@ void ChContactContainerNSC::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 template <class Tcont>
-void _ConstraintsBiReset(std::list<Tcont*>& contactlist) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiReset(ChContactPool<Tcont>& contactlist) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiReset();
         ++itercontact;
@@ -1171,8 +991,8 @@ void ChContactContainerNSC::ConstraintsBiReset() {
 }
 
 template <class Tcont>
-void _ConstraintsBiLoad_C(std::list<Tcont*>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ConstraintsBiLoad_C(ChContactPool<Tcont>& contactlist, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
         ++itercontact;
@@ -1215,9 +1035,9 @@ void ChContactContainerNSC::LoadConstraintJacobians() {
 }
 
 template <class Tcont>
-void _ConstraintsFetch_react(std::list<Tcont*>& contactlist, double factor) {
+void _ConstraintsFetch_react(ChContactPool<Tcont>& contactlist, double factor) {
     // From constraints to react vector:
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ConstraintsFetch_react(factor);
         ++itercontact;
@@ -15,19 +15,19 @@
 #ifndef CH_CONTACTCONTAINER_NSC_H
 #define CH_CONTACTCONTAINER_NSC_H
 
-#include <list>
-
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactNSC.h"
 #include "chrono/physics/ChContactNSCrolling.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many non-smooth contacts.
-/// Implemented using linked lists of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
-/// reactions). It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions,
-/// that account also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
+/// Implemented using pools of ChContactNSC objects (that is, contacts between two ChContactable objects, with 3
+/// reactions), one per pair of contactable types, with contiguous storage and reuse of contact objects across steps.
+/// It might also contain ChContactNSCrolling objects (extended versions of ChContactNSC, with 6 reactions, that account
+/// also for rolling and spinning resistance), but also for '6dof vs 6dof' contactables.
 class ChApi ChContactContainerNSC : public ChContactContainer {
   public:
     typedef ChContactNSC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactNSC_3_3;
@@ -69,22 +69,15 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 +                                                                                    //
-               n_added_6_3 + n_added_6_6 +                                                                      //
-               n_added_333_3 + n_added_333_6 + n_added_333_333 +                                                //
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 +                              //
-               n_added_33_3 + n_added_33_6 + n_added_33_333 + n_added_33_666 + n_added_33_33 +                  //
-               n_added_66_3 + n_added_66_6 + n_added_66_333 + n_added_66_666 + n_added_66_33 + n_added_66_66 +  //
-               n_added_6_6_rolling;                                                                             //
+        return GetNumContactsSliding() + contactlist_6_6_rolling.size();
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the
+    /// contact pools and tries to reuse previous contact objects until possible, to avoid construction and allocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -100,7 +93,8 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version destroys the contact objects that were not reused (if any), but keeps their
+    /// storage for subsequent steps.
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -140,15 +134,7 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Report the number of scalar unilateral constraints.
     /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
     virtual unsigned int GetNumConstraintsUnilateral() override {
-        auto n_added_sliding =                                                                              //
-            n_added_3_3 +                                                                                   //
-            n_added_6_3 + n_added_6_6 +                                                                     //
-            n_added_333_3 + n_added_333_6 + n_added_333_333 +                                               //
-            n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 +                             //
-            n_added_33_3 + n_added_33_6 + n_added_33_333 + n_added_33_666 + n_added_33_33 +                 //
-            n_added_66_3 + n_added_66_6 + n_added_66_333 + n_added_66_666 + n_added_66_33 + n_added_66_66;  //
-
-        return 3 * n_added_sliding + 6 * n_added_6_6_rolling;
+        return 3 * GetNumContactsSliding() + 6 * contactlist_6_6_rolling.size();
     }
 
     /// Objects will rebounce only if their relative colliding speed is above this threshold.
@@ -209,96 +195,51 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
-    std::list<ChContactNSC_3_3*> contactlist_3_3;
-
-    std::list<ChContactNSC_6_6*> contactlist_6_6;
-    std::list<ChContactNSC_6_3*> contactlist_6_3;
-
-    std::list<ChContactNSC_333_3*> contactlist_333_3;
-    std::list<ChContactNSC_333_6*> contactlist_333_6;
-    std::list<ChContactNSC_333_333*> contactlist_333_333;
-
-    std::list<ChContactNSC_666_3*> contactlist_666_3;
-    std::list<ChContactNSC_666_6*> contactlist_666_6;
-    std::list<ChContactNSC_666_333*> contactlist_666_333;
-    std::list<ChContactNSC_666_666*> contactlist_666_666;
-
-    std::list<ChContactNSC_33_3*> contactlist_33_3;
-    std::list<ChContactNSC_33_6*> contactlist_33_6;
-    std::list<ChContactNSC_33_333*> contactlist_33_333;
-    std::list<ChContactNSC_33_666*> contactlist_33_666;
-    std::list<ChContactNSC_33_33*> contactlist_33_33;
-
-    std::list<ChContactNSC_66_3*> contactlist_66_3;
-    std::list<ChContactNSC_66_6*> contactlist_66_6;
-    std::list<ChContactNSC_66_333*> contactlist_66_333;
-    std::list<ChContactNSC_66_666*> contactlist_66_666;
-    std::list<ChContactNSC_66_33*> contactlist_66_33;
-    std::list<ChContactNSC_66_66*> contactlist_66_66;
-
-    std::list<ChContactNSCrolling_6_6*> contactlist_6_6_rolling;
-
-    int n_added_3_3;
-
-    int n_added_6_6;
-    int n_added_6_3;
+    ChContactPool<ChContactNSC_3_3> contactlist_3_3;
 
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
+    ChContactPool<ChContactNSC_6_6> contactlist_6_6;
+    ChContactPool<ChContactNSC_6_3> contactlist_6_3;
 
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
+    ChContactPool<ChContactNSC_333_3> contactlist_333_3;
+    ChContactPool<ChContactNSC_333_6> contactlist_333_6;
+    ChContactPool<ChContactNSC_333_333> contactlist_333_333;
 
-    int n_added_33_3;
-    int n_added_33_6;
-    int n_added_33_333;
-    int n_added_33_666;
-    int n_added_33_33;
+    ChContactPool<ChContactNSC_666_3> contactlist_666_3;
+    ChContactPool<ChContactNSC_666_6> contactlist_666_6;
+    ChContactPool<ChContactNSC_666_333> contactlist_666_333;
+    ChContactPool<ChContactNSC_666_666> contactlist_666_666;
 
-    int n_added_66_3;
-    int n_added_66_6;
-    int n_added_66_333;
-    int n_added_66_666;
-    int n_added_66_33;
-    int n_added_66_66;
+    ChContactPool<ChContactNSC_33_3> contactlist_33_3;
+    ChContactPool<ChContactNSC_33_6> contactlist_33_6;
+    ChContactPool<ChContactNSC_33_333> contactlist_33_333;
+    ChContactPool<ChContactNSC_33_666> contactlist_33_666;
+    ChContactPool<ChContactNSC_33_33> contactlist_33_33;
 
-    int n_added_6_6_rolling;
+    ChContactPool<ChContactNSC_66_3> contactlist_66_3;
+    ChContactPool<ChContactNSC_66_6> contactlist_66_6;
+    ChContactPool<ChContactNSC_66_333> contactlist_66_333;
+    ChContactPool<ChContactNSC_66_666> contactlist_66_666;
+    ChContactPool<ChContactNSC_66_33> contactlist_66_33;
+    ChContactPool<ChContactNSC_66_66> contactlist_66_66;
 
-    std::list<ChContactNSC_3_3*>::iterator lastcontact_3_3;
-
-    std::list<ChContactNSC_6_6*>::iterator lastcontact_6_6;
-    std::list<ChContactNSC_6_3*>::iterator lastcontact_6_3;
-
-    std::list<ChContactNSC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactNSC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactNSC_333_333*>::iterator lastcontact_333_333;
-
-    std::list<ChContactNSC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactNSC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactNSC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactNSC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactNSC_33_3*>::iterator lastcontact_33_3;
-    std::list<ChContactNSC_33_6*>::iterator lastcontact_33_6;
-    std::list<ChContactNSC_33_333*>::iterator lastcontact_33_333;
-    std::list<ChContactNSC_33_666*>::iterator lastcontact_33_666;
-    std::list<ChContactNSC_33_33*>::iterator lastcontact_33_33;
-
-    std::list<ChContactNSC_66_3*>::iterator lastcontact_66_3;
-    std::list<ChContactNSC_66_6*>::iterator lastcontact_66_6;
-    std::list<ChContactNSC_66_333*>::iterator lastcontact_66_333;
-    std::list<ChContactNSC_66_666*>::iterator lastcontact_66_666;
-    std::list<ChContactNSC_66_33*>::iterator lastcontact_66_33;
-    std::list<ChContactNSC_66_66*>::iterator lastcontact_66_66;
-
-    std::list<ChContactNSCrolling_6_6*>::iterator lastcontact_6_6_rolling;
+    ChContactPool<ChContactNSCrolling_6_6> contactlist_6_6_rolling;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
   private:
+    /// Return the number of contacts with sliding friction only (i.e., all but the rolling contacts).
+    unsigned int GetNumContactsSliding() const {
+        return contactlist_3_3.size() +                                                            //
+               contactlist_6_3.size() + contactlist_6_6.size() +                                   //
+               contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +  //
+               contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +  //
+               contactlist_666_666.size() +                                                        //
+               contactlist_33_3.size() + contactlist_33_6.size() + contactlist_33_333.size() +     //
+               contactlist_33_666.size() + contactlist_33_33.size() +                              //
+               contactlist_66_3.size() + contactlist_66_6.size() + contactlist_66_333.size() +     //
+               contactlist_66_666.size() + contactlist_66_33.size() + contactlist_66_66.size();    //
+    }
+
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
@@ -20,52 +20,9 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChContactContainerSMC)
 
-ChContactContainerSMC::ChContactContainerSMC()
-    : n_added_3_3(0),
-      n_added_6_3(0),
-      n_added_6_6(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0),
-      n_added_33_3(0),
-      n_added_33_6(0),
-      n_added_33_333(0),
-      n_added_33_666(0),
-      n_added_33_33(0),
-      n_added_66_3(0),
-      n_added_66_6(0),
-      n_added_66_333(0),
-      n_added_66_666(0),
-      n_added_66_33(0),
-      n_added_66_66(0) {}
-
-ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
-    : ChContactContainer(other),
-      n_added_3_3(0),
-      n_added_6_3(0),
-      n_added_6_6(0),
-      n_added_333_3(0),
-      n_added_333_6(0),
-      n_added_333_333(0),
-      n_added_666_3(0),
-      n_added_666_6(0),
-      n_added_666_333(0),
-      n_added_666_666(0),
-      n_added_33_3(0),
-      n_added_33_6(0),
-      n_added_33_333(0),
-      n_added_33_666(0),
-      n_added_33_33(0),
-      n_added_66_3(0),
-      n_added_66_6(0),
-      n_added_66_333(0),
-      n_added_66_666(0),
-      n_added_66_33(0),
-      n_added_66_66(0) {}
+ChContactContainerSMC::ChContactContainerSMC() {}
+
+ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {}
 
 ChContactContainerSMC::~ChContactContainerSMC() {
     RemoveAllContacts();
@@ -76,212 +33,152 @@ void ChContactContainerSMC::Update(double time, bool update_assets) {
     ChContactContainer::Update(time, update_assets);
 }
 
-template <class Tcont, class Titer>
-void _RemoveAllContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        delete (*itercontact);
-        (*itercontact) = 0;
-        ++itercontact;
-    }
-    contactlist.clear();
-    lastcontact = contactlist.begin();
-    n_added = 0;
-}
-
 void ChContactContainerSMC::RemoveAllContacts() {
-    _RemoveAllContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3);
-
-    _RemoveAllContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3);
-    _RemoveAllContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6);
-
-    _RemoveAllContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3);
-    _RemoveAllContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6);
-    _RemoveAllContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333);
-
-    _RemoveAllContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3);
-    _RemoveAllContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6);
-    _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
-    _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
-
-    _RemoveAllContacts(contactlist_33_3, lastcontact_33_3, n_added_33_3);
-    _RemoveAllContacts(contactlist_33_6, lastcontact_33_6, n_added_33_6);
-    _RemoveAllContacts(contactlist_33_333, lastcontact_33_333, n_added_33_333);
-    _RemoveAllContacts(contactlist_33_666, lastcontact_33_666, n_added_33_666);
-    _RemoveAllContacts(contactlist_33_33, lastcontact_33_33, n_added_33_33);
-
-    _RemoveAllContacts(contactlist_66_3, lastcontact_66_3, n_added_66_3);
-    _RemoveAllContacts(contactlist_66_6, lastcontact_66_6, n_added_66_6);
-    _RemoveAllContacts(contactlist_66_333, lastcontact_66_333, n_added_66_333);
-    _RemoveAllContacts(contactlist_66_666, lastcontact_66_666, n_added_66_666);
-    _RemoveAllContacts(contactlist_66_33, lastcontact_66_33, n_added_66_33);
-    _RemoveAllContacts(contactlist_66_66, lastcontact_66_66, n_added_66_66);
+    contactlist_3_3.Clear();
+
+    contactlist_6_3.Clear();
+    contactlist_6_6.Clear();
+
+    contactlist_333_3.Clear();
+    contactlist_333_6.Clear();
+    contactlist_333_333.Clear();
+
+    contactlist_666_3.Clear();
+    contactlist_666_6.Clear();
+    contactlist_666_333.Clear();
+    contactlist_666_666.Clear();
+
+    contactlist_33_3.Clear();
+    contactlist_33_6.Clear();
+    contactlist_33_333.Clear();
+    contactlist_33_666.Clear();
+    contactlist_33_33.Clear();
+
+    contactlist_66_3.Clear();
+    contactlist_66_6.Clear();
+    contactlist_66_333.Clear();
+    contactlist_66_666.Clear();
+    contactlist_66_33.Clear();
+    contactlist_66_66.Clear();
 }
 
 void ChContactContainerSMC::BeginAddContact() {
-    lastcontact_3_3 = contactlist_3_3.begin();
-    n_added_3_3 = 0;
-
-    lastcontact_6_3 = contactlist_6_3.begin();
-    n_added_6_3 = 0;
-    lastcontact_6_6 = contactlist_6_6.begin();
-    n_added_6_6 = 0;
-
-    lastcontact_333_3 = contactlist_333_3.begin();
-    n_added_333_3 = 0;
-    lastcontact_333_6 = contactlist_333_6.begin();
-    n_added_333_6 = 0;
-    lastcontact_333_333 = contactlist_333_333.begin();
-    n_added_333_333 = 0;
-
-    lastcontact_666_3 = contactlist_666_3.begin();
-    n_added_666_3 = 0;
-    lastcontact_666_6 = contactlist_666_6.begin();
-    n_added_666_6 = 0;
-    lastcontact_666_333 = contactlist_666_333.begin();
-    n_added_666_333 = 0;
-    lastcontact_666_666 = contactlist_666_666.begin();
-    n_added_666_666 = 0;
-
-    lastcontact_33_3 = contactlist_33_3.begin();
-    n_added_33_3 = 0;
-    lastcontact_33_6 = contactlist_33_6.begin();
-    n_added_33_6 = 0;
-    lastcontact_33_333 = contactlist_33_333.begin();
-    n_added_33_333 = 0;
-    lastcontact_33_666 = contactlist_33_666.begin();
-    n_added_33_666 = 0;
-    lastcontact_33_33 = contactlist_33_33.begin();
-    n_added_33_33 = 0;
-
-    lastcontact_66_3 = contactlist_66_3.begin();
-    n_added_66_3 = 0;
-    lastcontact_66_6 = contactlist_66_6.begin();
-    n_added_66_6 = 0;
-    lastcontact_66_333 = contactlist_66_333.begin();
-    n_added_66_333 = 0;
-    lastcontact_66_666 = contactlist_66_666.begin();
-    n_added_66_666 = 0;
-    lastcontact_66_33 = contactlist_66_33.begin();
-    n_added_66_33 = 0;
-    lastcontact_66_66 = contactlist_66_66.begin();
-    n_added_66_66 = 0;
+    contactlist_3_3.Rewind();
+
+    contactlist_6_3.Rewind();
+    contactlist_6_6.Rewind();
+
+    contactlist_333_3.Rewind();
+    contactlist_333_6.Rewind();
+    contactlist_333_333.Rewind();
+
+    contactlist_666_3.Rewind();
+    contactlist_666_6.Rewind();
+    contactlist_666_333.Rewind();
+    contactlist_666_666.Rewind();
+
+    contactlist_33_3.Rewind();
+    contactlist_33_6.Rewind();
+    contactlist_33_333.Rewind();
+    contactlist_33_666.Rewind();
+    contactlist_33_33.Rewind();
+
+    contactlist_66_3.Rewind();
+    contactlist_66_6.Rewind();
+    contactlist_66_333.Rewind();
+    contactlist_66_666.Rewind();
+    contactlist_66_33.Rewind();
+    contactlist_66_66.Rewind();
 }
 
-void ChContactContainerSMC::EndAddContact() {
-    // remove contacts that are beyond last contact
-    while (lastcontact_3_3 != contactlist_3_3.end()) {
-        delete (*lastcontact_3_3);
-        lastcontact_3_3 = contactlist_3_3.erase(lastcontact_3_3);
-    }
-
-    while (lastcontact_6_3 != contactlist_6_3.end()) {
-        delete (*lastcontact_6_3);
-        lastcontact_6_3 = contactlist_6_3.erase(lastcontact_6_3);
-    }
-    while (lastcontact_6_6 != contactlist_6_6.end()) {
-        delete (*lastcontact_6_6);
-        lastcontact_6_6 = contactlist_6_6.erase(lastcontact_6_6);
-    }
-
-    while (lastcontact_333_3 != contactlist_333_3.end()) {
-        delete (*lastcontact_333_3);
-        lastcontact_333_3 = contactlist_333_3.erase(lastcontact_333_3);
-    }
-    while (lastcontact_333_6 != contactlist_333_6.end()) {
-        delete (*lastcontact_333_6);
-        lastcontact_333_6 = contactlist_333_6.erase(lastcontact_333_6);
-    }
-    while (lastcontact_333_333 != contactlist_333_333.end()) {
-        delete (*lastcontact_333_333);
-        lastcontact_333_333 = contactlist_333_333.erase(lastcontact_333_333);
-    }
-
-    while (lastcontact_666_3 != contactlist_666_3.end()) {
-        delete (*lastcontact_666_3);
-        lastcontact_666_3 = contactlist_666_3.erase(lastcontact_666_3);
-    }
-    while (lastcontact_666_6 != contactlist_666_6.end()) {
-        delete (*lastcontact_666_6);
-        lastcontact_666_6 = contactlist_666_6.erase(lastcontact_666_6);
-    }
-    while (lastcontact_666_333 != contactlist_666_333.end()) {
-        delete (*lastcontact_666_333);
-        lastcontact_666_333 = contactlist_666_333.erase(lastcontact_666_333);
-    }
-    while (lastcontact_666_666 != contactlist_666_666.end()) {
-        delete (*lastcontact_666_666);
-        lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
-    }
-
-    while (lastcontact_33_3 != contactlist_33_3.end()) {
-        delete (*lastcontact_33_3);
-        lastcontact_33_3 = contactlist_33_3.erase(lastcontact_33_3);
-    }
-    while (lastcontact_33_6 != contactlist_33_6.end()) {
-        delete (*lastcontact_33_6);
-        lastcontact_33_6 = contactlist_33_6.erase(lastcontact_33_6);
-    }
-    while (lastcontact_33_333 != contactlist_33_333.end()) {
-        delete (*lastcontact_33_333);
-        lastcontact_33_333 = contactlist_33_333.erase(lastcontact_33_333);
-    }
-    while (lastcontact_33_666 != contactlist_33_666.end()) {
-        delete (*lastcontact_33_666);
-        lastcontact_33_666 = contactlist_33_666.erase(lastcontact_33_666);
-    }
-    while (lastcontact_33_33 != contactlist_33_33.end()) {
-        delete (*lastcontact_33_33);
-        lastcontact_33_33 = contactlist_33_33.erase(lastcontact_33_33);
-    }
+template <class Tcont>
+void _EvaluateContacts(ChContactPool<Tcont>& contactlist) {
+#pragma omp for schedule(dynamic, 64) nowait
+    for (int i = 0; i < (int)contactlist.size(); i++)
+        contactlist[i]->Evaluate();
+}
 
-    while (lastcontact_66_3 != contactlist_66_3.end()) {
-        delete (*lastcontact_66_3);
-        lastcontact_66_3 = contactlist_66_3.erase(lastcontact_66_3);
-    }
-    while (lastcontact_66_6 != contactlist_66_6.end()) {
-        delete (*lastcontact_66_6);
-        lastcontact_66_6 = contactlist_66_6.erase(lastcontact_66_6);
-    }
-    while (lastcontact_66_333 != contactlist_66_333.end()) {
-        delete (*lastcontact_66_333);
-        lastcontact_66_333 = contactlist_66_333.erase(lastcontact_66_333);
-    }
-    while (lastcontact_66_666 != contactlist_66_666.end()) {
-        delete (*lastcontact_66_666);
-        lastcontact_66_666 = contactlist_66_666.erase(lastcontact_66_666);
-    }
-    while (lastcontact_66_33 != contactlist_66_33.end()) {
-        delete (*lastcontact_66_33);
-        lastcontact_66_33 = contactlist_66_33.erase(lastcontact_66_33);
-    }
-    while (lastcontact_66_66 != contactlist_66_66.end()) {
-        delete (*lastcontact_66_66);
-        lastcontact_66_66 = contactlist_66_66.erase(lastcontact_66_66);
+void ChContactContainerSMC::EndAddContact() {
+    // destroy contacts that were not reused
+    contactlist_3_3.Trim();
+
+    contactlist_6_3.Trim();
+    contactlist_6_6.Trim();
+
+    contactlist_333_3.Trim();
+    contactlist_333_6.Trim();
+    contactlist_333_333.Trim();
+
+    contactlist_666_3.Trim();
+    contactlist_666_6.Trim();
+    contactlist_666_333.Trim();
+    contactlist_666_666.Trim();
+
+    contactlist_33_3.Trim();
+    contactlist_33_6.Trim();
+    contactlist_33_333.Trim();
+    contactlist_33_666.Trim();
+    contactlist_33_33.Trim();
+
+    contactlist_66_3.Trim();
+    contactlist_66_6.Trim();
+    contactlist_66_333.Trim();
+    contactlist_66_666.Trim();
+    contactlist_66_33.Trim();
+    contactlist_66_66.Trim();
+
+    // evaluate the forces of all contacts added since BeginAddContact
+    // (sequentially, unless the contact force algorithm can be called concurrently)
+    int nthreads = 1;
+    if (static_cast<ChSystemSMC*>(GetSystem())->GetContactForceTorqueAlgorithm().IsThreadSafe())
+        nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        _EvaluateContacts(contactlist_3_3);
+
+        _EvaluateContacts(contactlist_6_3);
+        _EvaluateContacts(contactlist_6_6);
+
+        _EvaluateContacts(contactlist_333_3);
+        _EvaluateContacts(contactlist_333_6);
+        _EvaluateContacts(contactlist_333_333);
+
+        _EvaluateContacts(contactlist_666_3);
+        _EvaluateContacts(contactlist_666_6);
+        _EvaluateContacts(contactlist_666_333);
+        _EvaluateContacts(contactlist_666_666);
+
+        _EvaluateContacts(contactlist_33_3);
+        _EvaluateContacts(contactlist_33_6);
+        _EvaluateContacts(contactlist_33_333);
+        _EvaluateContacts(contactlist_33_666);
+        _EvaluateContacts(contactlist_33_33);
+
+        _EvaluateContacts(contactlist_66_3);
+        _EvaluateContacts(contactlist_66_6);
+        _EvaluateContacts(contactlist_66_333);
+        _EvaluateContacts(contactlist_66_666);
+        _EvaluateContacts(contactlist_66_33);
+        _EvaluateContacts(contactlist_66_66);
     }
 }
 
-template <class Tcont, class Titer, class Ta, class Tb>
-void _OptimalContactInsert(std::list<Tcont*>& contactlist,            // contact list
-                           Titer& lastcontact,                        // last contact acquired
-                           int& n_added,                              // number of contacts inserted
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactlist,         // contact pool
                            ChContactContainerSMC* container,          // contact container
                            Ta* objA,                                  // collidable object A
                            Tb* objB,                                  // collidable object B
                            const ChCollisionInfo& cinfo,              // collision information
                            const ChContactMaterialCompositeSMC& cmat  // composite material
 ) {
-    if (lastcontact != contactlist.end()) {
-        // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
-        lastcontact++;
-    } else {
+    Tcont* mc = contactlist.Reuse();
+    if (!mc) {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
-        contactlist.push_back(mc);
-        lastcontact = contactlist.end();
+        mc = contactlist.Emplace(container, objA, objB);
     }
-    n_added++;
+    // the contact force is evaluated in EndAddContact
+    mc->Setup(objA, objB, cinfo, cmat);
 }
 
 void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo,
@@ -370,37 +267,32 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 3_33 -> 33_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_3, lastcontact_33_3, n_added_33_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_3, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 3_66 -> 66_3
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_3, lastcontact_66_3, n_added_66_3, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_3, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -410,35 +302,31 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 6_33 -> 33_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_6, lastcontact_33_6, n_added_33_6, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_6, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 6_66 -> 66_6
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_6, lastcontact_66_6, n_added_66_6, this, objB, objA, swapped_cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_6, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -448,36 +336,30 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_333_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 333_33 -> 33_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_333, lastcontact_33_333, n_added_33_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_333, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 333_66 -> 66_333
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_333, lastcontact_66_333, n_added_66_333, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_333, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -486,35 +368,29 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_666_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB,
-                                      cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 666_33 -> 33_666
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_33_666, lastcontact_33_666, n_added_33_666, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_666, this, objB, objA, swapped_cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 666_66 -> 66_666
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_666, lastcontact_66_666, n_added_66_666, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_666, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -524,32 +400,28 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 33_3
-                _OptimalContactInsert(contactlist_33_3, lastcontact_33_3, n_added_33_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 33_6
-                _OptimalContactInsert(contactlist_33_6, lastcontact_33_6, n_added_33_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_33_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 33_333
-                _OptimalContactInsert(contactlist_33_333, lastcontact_33_333, n_added_33_333, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 33_666
-                _OptimalContactInsert(contactlist_33_666, lastcontact_33_666, n_added_33_666, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_666, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 33_33
-                _OptimalContactInsert(contactlist_33_33, lastcontact_33_33, n_added_33_33, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_33_33, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 33_66 -> 66_33
                 ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_66_33, lastcontact_66_33, n_added_66_33, this, objB, objA,
-                                      swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_33, this, objB, objA, swapped_cinfo, cmat);
             }
         } break;
 
@@ -559,31 +431,27 @@ void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const Ch
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 66_3
-                _OptimalContactInsert(contactlist_66_3, lastcontact_66_3, n_added_66_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_3, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 66_6
-                _OptimalContactInsert(contactlist_66_6, lastcontact_66_6, n_added_66_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_66_6, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 66_333
-                _OptimalContactInsert(contactlist_66_333, lastcontact_66_333, n_added_66_333, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_333, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 66_666
-                _OptimalContactInsert(contactlist_66_666, lastcontact_66_666, n_added_66_666, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_666, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_33) {
                 auto objB = static_cast<ChContactable_2vars<3, 3>*>(contactableB);
                 // 66_33
-                _OptimalContactInsert(contactlist_66_33, lastcontact_66_33, n_added_66_33, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_33, this, objA, objB, cinfo, cmat);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_66) {
                 auto objB = static_cast<ChContactable_2vars<6, 6>*>(contactableB);
                 // 66_66
-                _OptimalContactInsert(contactlist_66_66, lastcontact_66_66, n_added_66_66, this, objA, objB, cinfo,
-                                      cmat);
+                _OptimalContactInsert(contactlist_66_66, this, objA, objB, cinfo, cmat);
             }
         } break;
 
@@ -642,8 +510,8 @@ ChVector3d ChContactContainerSMC::GetContactableTorque(ChContactable* contactabl
 }
 
 template <class Tcont>
-void _ReportAllContacts(std::list<Tcont*>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _ReportAllContacts(ChContactPool<Tcont>& contactlist, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         bool proceed = mcallback->OnReportContact(
             (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
@@ -687,8 +555,8 @@ void ChContactContainerSMC::ReportAllContacts(std::shared_ptr<ReportContactCallb
 // STATE INTERFACE
 
 template <class Tcont>
-void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, const double c) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _IntLoadResidual_F(ChContactPool<Tcont>& contactlist, ChVectorDynamic<>& R, const double c) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContIntLoadResidual_F(R, c);
         ++itercontact;
@@ -696,6 +564,7 @@ void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, co
 }
 
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    // Contact forces were already evaluated (in parallel) in EndAddContact; only scatter them in R here.
     _IntLoadResidual_F(contactlist_3_3, R, c);
 
     _IntLoadResidual_F(contactlist_6_3, R, c);
@@ -725,8 +594,8 @@ void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDy
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _KRMmatricesLoad(ChContactPool<Tcont>& contactlist, double Kfactor, double Rfactor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
         ++itercontact;
@@ -763,8 +632,8 @@ void ChContactContainerSMC::LoadKRMMatrices(double Kfactor, double Rfactor, doub
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& descriptor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+void _InjectKRMmatrices(ChContactPool<Tcont>& contactlist, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(descriptor);
         ++itercontact;
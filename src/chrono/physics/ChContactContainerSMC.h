@@ -17,16 +17,23 @@
 
 #include <algorithm>
 #include <cmath>
-#include <list>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
+#include "chrono/physics/ChContactPool.h"
 #include "chrono/physics/ChContactSMC.h"
 #include "chrono/physics/ChContactable.h"
 
 namespace chrono {
 
 /// Class representing a container of many smooth (penalty) contacts.
-/// Implemented using linked lists of ChContactSMC objects (that is, contacts between two ChContactable objects).
+/// Implemented using pools of ChContactSMC objects (that is, contacts between two ChContactable objects).
+///
+/// The contact forces are evaluated once all contacts were added (see EndAddContact) and are then loaded in the system
+/// residual in IntLoadResidual_F. If the number of Chrono threads is larger than 1 (see ChSystem::SetNumThreads), the
+/// contact forces are evaluated in parallel, provided the contact force algorithm allows it (see
+/// ChSystemSMC::ChContactForceTorqueSMC::IsThreadSafe). Loading the precomputed forces in the residual is always done
+/// sequentially, so that results do not depend on the number of threads.
 class ChApi ChContactContainerSMC : public ChContactContainer {
   public:
     typedef ChContactSMC<ChContactable_1vars<3>, ChContactable_1vars<3> > ChContactSMC_3_3;
@@ -57,86 +64,32 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     typedef ChContactSMC<ChContactable_2vars<6, 6>, ChContactable_2vars<6, 6> > ChContactSMC_66_66;
 
   protected:
-    std::list<ChContactSMC_3_3*> contactlist_3_3;
+    ChContactPool<ChContactSMC_3_3> contactlist_3_3;
 
-    std::list<ChContactSMC_6_3*> contactlist_6_3;
-    std::list<ChContactSMC_6_6*> contactlist_6_6;
+    ChContactPool<ChContactSMC_6_3> contactlist_6_3;
+    ChContactPool<ChContactSMC_6_6> contactlist_6_6;
 
-    std::list<ChContactSMC_333_3*> contactlist_333_3;
-    std::list<ChContactSMC_333_6*> contactlist_333_6;
-    std::list<ChContactSMC_333_333*> contactlist_333_333;
+    ChContactPool<ChContactSMC_333_3> contactlist_333_3;
+    ChContactPool<ChContactSMC_333_6> contactlist_333_6;
+    ChContactPool<ChContactSMC_333_333> contactlist_333_333;
 
-    std::list<ChContactSMC_666_3*> contactlist_666_3;
-    std::list<ChContactSMC_666_6*> contactlist_666_6;
-    std::list<ChContactSMC_666_333*> contactlist_666_333;
-    std::list<ChContactSMC_666_666*> contactlist_666_666;
+    ChContactPool<ChContactSMC_666_3> contactlist_666_3;
+    ChContactPool<ChContactSMC_666_6> contactlist_666_6;
+    ChContactPool<ChContactSMC_666_333> contactlist_666_333;
+    ChContactPool<ChContactSMC_666_666> contactlist_666_666;
 
-    std::list<ChContactSMC_33_3*> contactlist_33_3;
-    std::list<ChContactSMC_33_6*> contactlist_33_6;
-    std::list<ChContactSMC_33_333*> contactlist_33_333;
-    std::list<ChContactSMC_33_666*> contactlist_33_666;
-    std::list<ChContactSMC_33_33*> contactlist_33_33;
+    ChContactPool<ChContactSMC_33_3> contactlist_33_3;
+    ChContactPool<ChContactSMC_33_6> contactlist_33_6;
+    ChContactPool<ChContactSMC_33_333> contactlist_33_333;
+    ChContactPool<ChContactSMC_33_666> contactlist_33_666;
+    ChContactPool<ChContactSMC_33_33> contactlist_33_33;
 
-    std::list<ChContactSMC_66_3*> contactlist_66_3;
-    std::list<ChContactSMC_66_6*> contactlist_66_6;
-    std::list<ChContactSMC_66_333*> contactlist_66_333;
-    std::list<ChContactSMC_66_666*> contactlist_66_666;
-    std::list<ChContactSMC_66_33*> contactlist_66_33;
-    std::list<ChContactSMC_66_66*> contactlist_66_66;
-
-    int n_added_3_3;
-
-    int n_added_6_3;
-    int n_added_6_6;
-    
-    int n_added_333_3;
-    int n_added_333_6;
-    int n_added_333_333;
-    
-    int n_added_666_3;
-    int n_added_666_6;
-    int n_added_666_333;
-    int n_added_666_666;
-
-    int n_added_33_3;
-    int n_added_33_6;
-    int n_added_33_333;
-    int n_added_33_666;
-    int n_added_33_33;
-
-    int n_added_66_3;
-    int n_added_66_6;
-    int n_added_66_333;
-    int n_added_66_666;
-    int n_added_66_33;
-    int n_added_66_66;
-
-    std::list<ChContactSMC_3_3*>::iterator lastcontact_3_3;
-
-    std::list<ChContactSMC_6_3*>::iterator lastcontact_6_3;
-    std::list<ChContactSMC_6_6*>::iterator lastcontact_6_6;
-
-    std::list<ChContactSMC_333_3*>::iterator lastcontact_333_3;
-    std::list<ChContactSMC_333_6*>::iterator lastcontact_333_6;
-    std::list<ChContactSMC_333_333*>::iterator lastcontact_333_333;
-
-    std::list<ChContactSMC_666_3*>::iterator lastcontact_666_3;
-    std::list<ChContactSMC_666_6*>::iterator lastcontact_666_6;
-    std::list<ChContactSMC_666_333*>::iterator lastcontact_666_333;
-    std::list<ChContactSMC_666_666*>::iterator lastcontact_666_666;
-
-    std::list<ChContactSMC_33_3*>::iterator lastcontact_33_3;
-    std::list<ChContactSMC_33_6*>::iterator lastcontact_33_6;
-    std::list<ChContactSMC_33_333*>::iterator lastcontact_33_333;
-    std::list<ChContactSMC_33_666*>::iterator lastcontact_33_666;
-    std::list<ChContactSMC_33_33*>::iterator lastcontact_33_33;
-
-    std::list<ChContactSMC_66_3*>::iterator lastcontact_66_3;
-    std::list<ChContactSMC_66_6*>::iterator lastcontact_66_6;
-    std::list<ChContactSMC_66_333*>::iterator lastcontact_66_333;
-    std::list<ChContactSMC_66_666*>::iterator lastcontact_66_666;
-    std::list<ChContactSMC_66_33*>::iterator lastcontact_66_33;
-    std::list<ChContactSMC_66_66*>::iterator lastcontact_66_66;
+    ChContactPool<ChContactSMC_66_3> contactlist_66_3;
+    ChContactPool<ChContactSMC_66_6> contactlist_66_6;
+    ChContactPool<ChContactSMC_66_333> contactlist_66_333;
+    ChContactPool<ChContactSMC_66_666> contactlist_66_666;
+    ChContactPool<ChContactSMC_66_33> contactlist_66_33;
+    ChContactPool<ChContactSMC_66_66> contactlist_66_66;
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
@@ -150,21 +103,23 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     /// Report the number of added contacts.
     virtual unsigned int GetNumContacts() const override {
-        return n_added_3_3 +                                                                                   //
-               n_added_6_3 + n_added_6_6 +                                                                     //
-               n_added_333_3 + n_added_333_6 + n_added_333_333 +                                               //
-               n_added_666_3 + n_added_666_6 + n_added_666_333 + n_added_666_666 +                             //
-               n_added_33_3 + n_added_33_6 + n_added_33_333 + n_added_33_666 + n_added_33_33 +                 //
-               n_added_66_3 + n_added_66_6 + n_added_66_333 + n_added_66_666 + n_added_66_33 + n_added_66_66;  //
+        return contactlist_3_3.size() +                                                            //
+               contactlist_6_3.size() + contactlist_6_6.size() +                                   //
+               contactlist_333_3.size() + contactlist_333_6.size() + contactlist_333_333.size() +  //
+               contactlist_666_3.size() + contactlist_666_6.size() + contactlist_666_333.size() +  //
+               contactlist_666_666.size() +                                                        //
+               contactlist_33_3.size() + contactlist_33_6.size() + contactlist_33_333.size() +     //
+               contactlist_33_666.size() + contactlist_33_33.size() +                              //
+               contactlist_66_3.size() + contactlist_66_6.size() + contactlist_66_333.size() +     //
+               contactlist_66_666.size() + contactlist_66_33.size() + contactlist_66_66.size();    //
     }
 
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
-    /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
-    /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
-    /// allocation/deallocation.
+    /// similar). Instead of simply deleting all the previous contacts, this optimized implementation rewinds the contact
+    /// pools and tries to reuse previous contact objects until possible, to avoid construction and allocation.
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
@@ -180,7 +135,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
-    /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// similar). This optimized version destroys the contact objects that were not reused (if any), then evaluates the
+    /// forces of all contacts (in parallel, if multiple Chrono threads are used).
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -336,6 +336,12 @@ class ChContactNSC : public ChContactTuple<Ta, Tb> {
         react_force.x() = Nx.GetLagrangeMultiplier() * factor;
         react_force.y() = Tu.GetLagrangeMultiplier() * factor;
         react_force.z() = Tv.GetLagrangeMultiplier() * factor;
+
+        if (reactions_cache) {
+            reactions_cache[0] = (float)react_force.x();
+            reactions_cache[1] = (float)react_force.y();
+            reactions_cache[2] = (float)react_force.z();
+        }
     }
 };
 
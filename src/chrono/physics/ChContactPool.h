@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_physics
+/// @{
+
+/// Pooled storage for contact objects of a given type.
+/// Contacts are constructed in place in fixed-size chunks of contiguous memory. Chunks are never reallocated, so that
+/// contact objects (and the constraints they own, which are referenced by the solver) keep their address. Iteration
+/// over the contacts in the pool follows the storage order.
+///
+/// The pool supports the contact reuse scheme of the contact containers: at the beginning of the collision detection
+/// phase the pool is rewound, contact objects still available from a previous step are recycled (see Reuse), new ones
+/// are constructed in place only if needed (see Emplace), and any leftover objects are destroyed at the end (see Trim).
+/// Memory is released only by Clear.
+template <class Tcont>
+class ChContactPool {
+  public:
+    /// Forward iterator over the contacts in the pool.
+    /// Dereferencing returns a pointer to the contact object, as for a list of contact pointers.
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Tcont*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Tcont**;
+        using reference = Tcont*;
+
+        iterator(const ChContactPool* pool, unsigned int index) : m_pool(pool), m_index(index) {}
+
+        Tcont* operator*() const { return (*m_pool)[m_index]; }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator tmp(*this);
+            ++m_index;
+            return tmp;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        unsigned int m_index;
+    };
+
+    ChContactPool() : m_size(0), m_constructed(0) {}
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+    ~ChContactPool() { Clear(); }
+
+    /// Return the number of contacts currently in the pool.
+    unsigned int size() const { return m_size; }
+
+    /// Return true if there are no contacts in the pool.
+    bool empty() const { return m_size == 0; }
+
+    /// Access the i-th contact in the pool.
+    Tcont* operator[](unsigned int i) const { return m_chunks[i >> CHUNK_BITS] + (i & CHUNK_MASK); }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_size); }
+
+    /// Rewind the pool. Existing contact objects are kept, to be recycled through Reuse.
+    void Rewind() { m_size = 0; }
+
+    /// Return the next existing contact object, appending it to the pool.
+    /// If there are no more objects available for reuse, return nullptr (use Emplace to construct a new contact).
+    Tcont* Reuse() {
+        if (m_size == m_constructed)
+            return nullptr;
+        return (*this)[m_size++];
+    }
+
+    /// Construct a new contact object at the end of the pool, with the given constructor arguments.
+    /// A new chunk of storage is allocated only if all current chunks are full.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_size == m_constructed);
+        if (m_constructed == m_chunks.size() * CHUNK_SIZE)
+            m_chunks.push_back(m_allocator.allocate(CHUNK_SIZE));
+        Tcont* contact = (*this)[m_constructed];
+        ::new (static_cast<void*>(contact)) Tcont(std::forward<Args>(args)...);
+        m_constructed++;
+        m_size++;
+        return contact;
+    }
+
+    /// Destroy the contact objects which were not reused since the last call to Rewind.
+    /// The storage is kept for subsequent contacts.
+    void Trim() {
+        while (m_constructed > m_size) {
+            m_constructed--;
+            (*this)[m_constructed]->~Tcont();
+        }
+    }
+
+    /// Destroy all contact objects and release the storage.
+    void Clear() {
+        m_size = 0;
+        Trim();
+        for (auto chunk : m_chunks)
+            m_allocator.deallocate(chunk, CHUNK_SIZE);
+        m_chunks.clear();
+    }
+
+  private:
+    static const unsigned int CHUNK_BITS = 8;
+    static const unsigned int CHUNK_SIZE = 1u << CHUNK_BITS;
+    static const unsigned int CHUNK_MASK = CHUNK_SIZE - 1;
+
+    std::vector<Tcont*> m_chunks;                 ///< chunks of storage, each for CHUNK_SIZE contacts
+    unsigned int m_size;                          ///< number of contacts currently in the pool
+    unsigned int m_constructed;                   ///< number of constructed contact objects (in use or reusable)
+    Eigen::aligned_allocator<Tcont> m_allocator;  ///< allocator honoring the alignment of Eigen members
+};
+
+/// @} chrono_physics
+
+}  // end namespace chrono
+
+#endif
@@ -221,6 +221,9 @@ class ChDefaultContactForceTorqueSMC : public ChSystemSMC::ChContactForceTorqueS
 
         return {force, VNULL};  // zero torque anyway
     }
+
+    /// The default force calculation only reads the system settings and the contact data.
+    virtual bool IsThreadSafe() const override { return true; }
 };
 
 /// Class for smooth (penalty-based) contact between two generic contactable objects.
@@ -238,9 +241,10 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector3d m_force;        ///< contact force on objB
-    ChVector3d m_torque;       ///< contact torque on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector3d m_force;                   ///< contact force on objB
+    ChVector3d m_torque;                  ///< contact torque on objB
+    ChContactJacobian* m_Jac;             ///< contact Jacobian data
+    ChContactMaterialCompositeSMC m_mat;  ///< composite material for contact pair
 
   public:
     ChContactSMC() : m_Jac(NULL) {}
@@ -255,6 +259,13 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         Reset(obj_A, obj_B, cinfo, mat);
     }
 
+    /// Construct a contact without geometric information (to be provided through Setup).
+    ChContactSMC(ChContactContainer* contact_container,  ///< contact container
+                 Ta* obj_A,                              ///< contactable object A
+                 Tb* obj_B                               ///< contactable object B
+                 )
+        : ChContactTuple<Ta, Tb>(contact_container, obj_A, obj_B), m_Jac(NULL) {}
+
     ~ChContactSMC() { delete m_Jac; }
 
     /// Get the contact force, if computed, in contact coordinate system
@@ -282,6 +293,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
                Tb* obj_B,                                ///< contactable object B
                const ChCollisionInfo& cinfo,             ///< data for the collision pair
                const ChContactMaterialCompositeSMC& mat  ///< composite material
+    ) {
+        Setup(obj_A, obj_B, cinfo, mat);
+        Evaluate();
+    }
+
+    /// Reinitialize the geometric information and the composite material of this contact, without calculating the
+    /// contact force. Evaluate() must be called before using the contact force.
+    void Setup(Ta* obj_A,                                ///< contactable object A
+               Tb* obj_B,                                ///< contactable object B
+               const ChCollisionInfo& cinfo,             ///< data for the collision pair
+               const ChContactMaterialCompositeSMC& mat  ///< composite material
     ) {
         // Reset geometric information
         this->Reset_cinfo(obj_A, obj_B, cinfo);
@@ -289,13 +311,19 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+    }
+
+    /// Calculate the contact force (and the Jacobian matrices, for stiff contacts) for the current contact geometry.
+    /// Only data owned by this contact is modified, so that different contacts can be evaluated concurrently.
+    void Evaluate() {
         // Calculate contact force.
         auto wrench =
             CalculateForceTorque(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
             );
         m_force = wrench.force;
         m_torque = wrench.torque;
@@ -303,7 +331,7 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->IsContactStiff()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
         }
     }
 
@@ -0,0 +1,784 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/physics/ChParticleCloudSoA.h"
+#include "chrono/collision/ChCollisionSystem.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// CONTACTABLE HANDLE FOR A PARTICLE
+// -----------------------------------------------------------------------------
+
+ChCoordsys<> ChParticleSoA::GetCoordsys() const {
+    return ChCoordsys<>(container->m_pos.Get(index), container->m_rot.Get(index));
+}
+
+void ChParticleSoA::ContactableGetStateBlockPosLevel(ChState& x) {
+    x.segment(0, 3) = container->m_pos.Get(index).eigen();
+    x.segment(3, 4) = container->m_rot.Get(index).eigen();
+}
+
+void ChParticleSoA::ContactableGetStateBlockVelLevel(ChStateDelta& w) {
+    w.segment(0, 3) = container->m_vel.Get(index).eigen();
+    w.segment(3, 3) = container->m_wvel.Get(index).eigen();
+}
+
+void ChParticleSoA::ContactableIncrementState(const ChState& x, const ChStateDelta& dw, ChState& x_new) {
+    // Increment position
+    x_new(0) = x(0) + dw(0);
+    x_new(1) = x(1) + dw(1);
+    x_new(2) = x(2) + dw(2);
+
+    // Increment rotation: rot' = rot*delta  (local rotation increment)
+    ChQuaterniond q_old(x.segment(3, 4));
+    ChQuaterniond rel_q;
+    rel_q.SetFromRotVec(ChVector3d(dw.segment(3, 3)));
+    x_new.segment(3, 4) = (q_old * rel_q).eigen();
+}
+
+ChVector3d ChParticleSoA::GetContactPoint(const ChVector3d& loc_point, const ChState& state_x) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    return csys.TransformPointLocalToParent(loc_point);
+}
+
+ChVector3d ChParticleSoA::GetContactPointSpeed(const ChVector3d& loc_point,
+                                               const ChState& state_x,
+                                               const ChStateDelta& state_w) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    ChVector3d abs_vel(state_w.segment(0, 3));
+    ChVector3d loc_omg(state_w.segment(3, 3));
+    ChVector3d abs_omg = csys.TransformDirectionLocalToParent(loc_omg);
+
+    return abs_vel + Vcross(abs_omg, loc_point);
+}
+
+ChVector3d ChParticleSoA::GetContactPointSpeed(const ChVector3d& abs_point) {
+    ChCoordsys<> csys = GetCoordsys();
+    ChVector3d abs_omg = csys.TransformDirectionLocalToParent(container->m_wvel.Get(index));
+    return container->m_vel.Get(index) + Vcross(abs_omg, abs_point - csys.pos);
+}
+
+ChFrame<> ChParticleSoA::GetCollisionModelFrame() {
+    return ChFrame<>(GetCoordsys());
+}
+
+void ChParticleSoA::ContactForceLoadResidual_F(const ChVector3d& F,
+                                               const ChVector3d& T,
+                                               const ChVector3d& abs_point,
+                                               ChVectorDynamic<>& R) {
+    ChCoordsys<> csys = GetCoordsys();
+    ChVector3d m_p1_loc = csys.TransformPointParentToLocal(abs_point);
+    ChVector3d force1_loc = csys.TransformDirectionParentToLocal(F);
+    ChVector3d torque1_loc = Vcross(m_p1_loc, force1_loc);
+    if (!T.IsNull())
+        torque1_loc += csys.TransformDirectionParentToLocal(T);
+    R.segment(variables.GetOffset() + 0, 3) += F.eigen();
+    R.segment(variables.GetOffset() + 3, 3) += torque1_loc.eigen();
+}
+
+void ChParticleSoA::ContactComputeQ(const ChVector3d& F,
+                                    const ChVector3d& T,
+                                    const ChVector3d& point,
+                                    const ChState& state_x,
+                                    ChVectorDynamic<>& Q,
+                                    int offset) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    ChVector3d point_loc = csys.TransformPointParentToLocal(point);
+    ChVector3d force_loc = csys.TransformDirectionParentToLocal(F);
+    ChVector3d torque_loc = Vcross(point_loc, force_loc);
+    if (!T.IsNull())
+        torque_loc += csys.TransformDirectionParentToLocal(T);
+    Q.segment(offset + 0, 3) = F.eigen();
+    Q.segment(offset + 3, 3) = torque_loc.eigen();
+}
+
+void ChParticleSoA::ComputeJacobianForContactPart(const ChVector3d& abs_point,
+                                                  ChMatrix33<>& contact_plane,
+                                                  type_constraint_tuple& jacobian_tuple_N,
+                                                  type_constraint_tuple& jacobian_tuple_U,
+                                                  type_constraint_tuple& jacobian_tuple_V,
+                                                  bool second) {
+    ChCoordsys<> csys = GetCoordsys();
+    ChVector3d m_p1_loc = csys.TransformPointParentToLocal(abs_point);
+
+    ChMatrix33<> Jx1 = contact_plane.transpose();
+    if (!second)
+        Jx1 *= -1;
+
+    ChStarMatrix33<> Ps1(m_p1_loc);
+    ChMatrix33<> Jr1 = contact_plane.transpose() * ChMatrix33<>(csys.rot) * Ps1;
+    if (second)
+        Jr1 *= -1;
+
+    jacobian_tuple_N.Get_Cq().segment(0, 3) = Jx1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(0, 3) = Jx1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(0, 3) = Jx1.row(2);
+
+    jacobian_tuple_N.Get_Cq().segment(3, 3) = Jr1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(3, 3) = Jr1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(3, 3) = Jr1.row(2);
+}
+
+void ChParticleSoA::ComputeJacobianForRollingContactPart(const ChVector3d& abs_point,
+                                                         ChMatrix33<>& contact_plane,
+                                                         type_constraint_tuple& jacobian_tuple_N,
+                                                         type_constraint_tuple& jacobian_tuple_U,
+                                                         type_constraint_tuple& jacobian_tuple_V,
+                                                         bool second) {
+    ChMatrix33<> Jr1 = contact_plane.transpose() * ChMatrix33<>(container->m_rot.Get(index));
+    if (!second)
+        Jr1 *= -1;
+
+    jacobian_tuple_N.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_U.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_V.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_N.Get_Cq().segment(3, 3) = Jr1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(3, 3) = Jr1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(3, 3) = Jr1.row(2);
+}
+
+ChPhysicsItem* ChParticleSoA::GetPhysicsItem() {
+    return container;
+}
+
+// -----------------------------------------------------------------------------
+// PARTICLE CLOUD WITH STRUCTURE-OF-ARRAYS STATE
+// -----------------------------------------------------------------------------
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChParticleCloudSoA)
+
+ChParticleCloudSoA::ChParticleCloudSoA() : particle_collision_model(nullptr), fixed(false), collide(false) {
+    SetMass(1.0);
+    SetInertiaXX(ChVector3d(1.0, 1.0, 1.0));
+    SetInertiaXY(ChVector3d(0, 0, 0));
+}
+
+ChParticleCloudSoA::ChParticleCloudSoA(const ChParticleCloudSoA& other)
+    : ChPhysicsItem(other),
+      m_pos(other.m_pos),
+      m_rot(other.m_rot),
+      m_vel(other.m_vel),
+      m_wvel(other.m_wvel),
+      m_acc(other.m_acc),
+      m_wacc(other.m_wacc),
+      m_force(other.m_force),
+      m_torque(other.m_torque),
+      fixed(other.fixed),
+      collide(other.collide) {
+    SetMass(other.GetMass());
+    SetInertia(other.particle_mass.GetBodyInertia());
+
+    if (other.particle_collision_model)
+        particle_collision_model = chrono_types::make_shared<ChCollisionModel>(*other.particle_collision_model);
+    else
+        particle_collision_model = nullptr;
+
+    // create the contactable handles of the copied particles
+    ResizeArrays(other.GetNumParticles());
+}
+
+int ChParticleCloudSoA::GetNumThreads() const {
+    return GetSystem() ? (int)GetSystem()->GetNumThreadsChrono() : 1;
+}
+
+void ChParticleCloudSoA::AddCollisionShape(std::shared_ptr<ChCollisionShape> shape, const ChFrame<>& frame) {
+    if (!particle_collision_model) {
+        particle_collision_model = chrono_types::make_shared<ChCollisionModel>();
+    }
+    particle_collision_model->AddShape(shape, frame);
+}
+
+void ChParticleCloudSoA::Reserve(size_t n) {
+    m_pos.reserve(n);
+    m_rot.reserve(n);
+    m_vel.reserve(n);
+    m_wvel.reserve(n);
+    m_acc.reserve(n);
+    m_wacc.reserve(n);
+    m_force.reserve(n);
+    m_torque.reserve(n);
+}
+
+void ChParticleCloudSoA::ResizeArrays(size_t n) {
+    m_pos.resize(n);
+    m_rot.resize(n);
+    m_vel.resize(n);
+    m_wvel.resize(n);
+    m_acc.resize(n);
+    m_wacc.resize(n);
+    m_force.resize(n);
+    m_torque.resize(n);
+
+    if (m_particles.size() > n)
+        m_particles.resize(n);
+
+    while (m_particles.size() < n) {
+        m_particles.emplace_back();
+        auto& particle = m_particles.back();
+
+        particle.container = this;
+        particle.index = (unsigned int)(m_particles.size() - 1);
+        particle.variables.SetSharedMass(&particle_mass);
+        particle.variables.SetUserData((void*)this);
+
+        if (particle_collision_model) {
+            auto collision_model = chrono_types::make_shared<ChCollisionModel>();
+            collision_model->AddShapes(particle_collision_model);
+            particle.AddCollisionModel(collision_model);
+        }
+    }
+}
+
+void ChParticleCloudSoA::ResizeNparticles(int newsize) {
+    bool oldcoll = IsCollisionEnabled();
+    EnableCollision(false);
+
+    m_particles.clear();
+    ResizeArrays(0);
+    ResizeArrays(newsize);
+
+    EnableCollision(oldcoll);
+}
+
+void ChParticleCloudSoA::AddParticle(const ChCoordsys<>& initial_state, const ChVector3d& initial_vel) {
+    size_t n = m_particles.size();
+    ResizeArrays(n + 1);
+    m_pos.Set(n, initial_state.pos);
+    m_rot.Set(n, initial_state.rot);
+    m_vel.Set(n, initial_vel);
+}
+
+ChFrame<> ChParticleCloudSoA::GetVisualModelFrame(unsigned int nclone) const {
+    return ChFrame<>(m_pos.Get(nclone), m_rot.Get(nclone));
+}
+
+// STATE BOOKKEEPING FUNCTIONS
+
+void ChParticleCloudSoA::IntStateGather(const unsigned int off_x,  // offset in x state vector
+                                        ChState& x,                // state vector, position part
+                                        const unsigned int off_v,  // offset in v state vector
+                                        ChStateDelta& v,           // state vector, speed part
+                                        double& T                  // time
+) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        double* xj = x.data() + off_x + 7 * j;
+        double* vj = v.data() + off_v + 6 * j;
+        xj[0] = m_pos.x[j];
+        xj[1] = m_pos.y[j];
+        xj[2] = m_pos.z[j];
+        xj[3] = m_rot.e0[j];
+        xj[4] = m_rot.e1[j];
+        xj[5] = m_rot.e2[j];
+        xj[6] = m_rot.e3[j];
+        vj[0] = m_vel.x[j];
+        vj[1] = m_vel.y[j];
+        vj[2] = m_vel.z[j];
+        vj[3] = m_wvel.x[j];
+        vj[4] = m_wvel.y[j];
+        vj[5] = m_wvel.z[j];
+    }
+
+    T = GetChTime();
+}
+
+void ChParticleCloudSoA::IntStateScatter(const unsigned int off_x,  // offset in x state vector
+                                         const ChState& x,          // state vector, position part
+                                         const unsigned int off_v,  // offset in v state vector
+                                         const ChStateDelta& v,     // state vector, speed part
+                                         const double T,            // time
+                                         bool full_update           // perform complete update
+) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        const double* xj = x.data() + off_x + 7 * j;
+        const double* vj = v.data() + off_v + 6 * j;
+        m_pos.x[j] = xj[0];
+        m_pos.y[j] = xj[1];
+        m_pos.z[j] = xj[2];
+        m_rot.e0[j] = xj[3];
+        m_rot.e1[j] = xj[4];
+        m_rot.e2[j] = xj[5];
+        m_rot.e3[j] = xj[6];
+        m_vel.x[j] = vj[0];
+        m_vel.y[j] = vj[1];
+        m_vel.z[j] = vj[2];
+        m_wvel.x[j] = vj[3];
+        m_wvel.y[j] = vj[4];
+        m_wvel.z[j] = vj[5];
+    }
+
+    SetChTime(T);
+    Update(T, full_update);
+}
+
+void ChParticleCloudSoA::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        double* aj = a.data() + off_a + 6 * j;
+        aj[0] = m_acc.x[j];
+        aj[1] = m_acc.y[j];
+        aj[2] = m_acc.z[j];
+        aj[3] = m_wacc.x[j];
+        aj[4] = m_wacc.y[j];
+        aj[5] = m_wacc.z[j];
+    }
+}
+
+void ChParticleCloudSoA::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        const double* aj = a.data() + off_a + 6 * j;
+        m_acc.x[j] = aj[0];
+        m_acc.y[j] = aj[1];
+        m_acc.z[j] = aj[2];
+        m_wacc.x[j] = aj[3];
+        m_wacc.y[j] = aj[4];
+        m_wacc.z[j] = aj[5];
+    }
+}
+
+void ChParticleCloudSoA::IntStateIncrement(const unsigned int off_x,  // offset in x state vector
+                                           ChState& x_new,            // state vector, position part, incremented
+                                           const ChState& x,          // state vector, initial position part
+                                           const unsigned int off_v,  // offset in v state vector
+                                           const ChStateDelta& Dv     // state vector, increment
+) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        // ADVANCE POSITION:
+        x_new(off_x + 7 * j) = x(off_x + 7 * j) + Dv(off_v + 6 * j);
+        x_new(off_x + 7 * j + 1) = x(off_x + 7 * j + 1) + Dv(off_v + 6 * j + 1);
+        x_new(off_x + 7 * j + 2) = x(off_x + 7 * j + 2) + Dv(off_v + 6 * j + 2);
+
+        // ADVANCE ROTATION: q_new = q_old * Dq_l
+        ChQuaterniond q_old(x.segment(off_x + 7 * j + 3, 4));
+        ChQuaterniond rel_q;
+        rel_q.SetFromRotVec(ChVector3d(Dv.segment(off_v + 6 * j + 3, 3)));
+        x_new.segment(off_x + 7 * j + 3, 4) = (q_old * rel_q).eigen();
+    }
+}
+
+void ChParticleCloudSoA::IntStateGetIncrement(const unsigned int off_x,  // offset in x state vector
+                                              const ChState& x_new,      // state vector, position part, incremented
+                                              const ChState& x,          // state vector, initial position part
+                                              const unsigned int off_v,  // offset in v state vector
+                                              ChStateDelta& Dv           // state vector, increment
+) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        // POSITION:
+        Dv(off_v + 6 * j) = x_new(off_x + 7 * j) - x(off_x + 7 * j);
+        Dv(off_v + 6 * j + 1) = x_new(off_x + 7 * j + 1) - x(off_x + 7 * j + 1);
+        Dv(off_v + 6 * j + 2) = x_new(off_x + 7 * j + 2) - x(off_x + 7 * j + 2);
+
+        // ROTATION (quaternions): Dq_loc = q_old^-1 * q_new
+        ChQuaterniond q_old(x.segment(off_x + 7 * j + 3, 4));
+        ChQuaterniond q_new(x_new.segment(off_x + 7 * j + 3, 4));
+        ChQuaterniond rel_q = q_old.GetConjugate() * q_new;
+        Dv.segment(off_v + 6 * j + 3, 3) = rel_q.GetRotVec().eigen();
+    }
+}
+
+void ChParticleCloudSoA::IntLoadResidual_F(const unsigned int off,  // offset in R residual
+                                           ChVectorDynamic<>& R,    // result: the R residual, R += c*F
+                                           const double c           // a scaling factor
+) {
+    ChVector3d Gforce;
+    if (GetSystem())
+        Gforce = GetSystem()->GetGravitationalAcceleration() * particle_mass.GetBodyMass();
+    const ChMatrix33<>& J = particle_mass.GetBodyInertia();
+
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        // particle gyroscopic torque
+        ChVector3d Wvel(m_wvel.x[j], m_wvel.y[j], m_wvel.z[j]);
+        ChVector3d gyro = Vcross(Wvel, J * Wvel);
+
+        // applied forces and torques, gyroscopic torque, and gravity
+        double* Rj = R.data() + off + 6 * j;
+        Rj[0] += c * (m_force.x[j] + Gforce.x());
+        Rj[1] += c * (m_force.y[j] + Gforce.y());
+        Rj[2] += c * (m_force.z[j] + Gforce.z());
+        Rj[3] += c * (m_torque.x[j] - gyro.x());
+        Rj[4] += c * (m_torque.y[j] - gyro.y());
+        Rj[5] += c * (m_torque.z[j] - gyro.z());
+    }
+}
+
+void ChParticleCloudSoA::IntLoadResidual_Mv(const unsigned int off,      // offset in R residual
+                                            ChVectorDynamic<>& R,        // result: the R residual, R += c*M*v
+                                            const ChVectorDynamic<>& w,  // the w vector
+                                            const double c               // a scaling factor
+) {
+    double cm = c * particle_mass.GetBodyMass();
+    ChMatrix33<> cJ = c * particle_mass.GetBodyInertia();
+
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        double* Rj = R.data() + off + 6 * j;
+        const double* wj = w.data() + off + 6 * j;
+        Rj[0] += cm * wj[0];
+        Rj[1] += cm * wj[1];
+        Rj[2] += cm * wj[2];
+        ChVector3d Iw = cJ * ChVector3d(wj[3], wj[4], wj[5]);
+        Rj[3] += Iw.x();
+        Rj[4] += Iw.y();
+        Rj[5] += Iw.z();
+    }
+}
+
+void ChParticleCloudSoA::IntLoadLumpedMass_Md(const unsigned int off,
+                                              ChVectorDynamic<>& Md,
+                                              double& err,
+                                              const double c) {
+    const ChMatrix33<>& J = particle_mass.GetBodyInertia();
+    double cm = c * particle_mass.GetBodyMass();
+
+    int np = (int)m_particles.size();
+    for (int j = 0; j < np; j++) {
+        Md(off + 6 * j + 0) += cm;
+        Md(off + 6 * j + 1) += cm;
+        Md(off + 6 * j + 2) += cm;
+        Md(off + 6 * j + 3) += c * J(0, 0);
+        Md(off + 6 * j + 4) += c * J(1, 1);
+        Md(off + 6 * j + 5) += c * J(2, 2);
+    }
+    // if there is off-diagonal inertia, add to error, as lumping can give inconsistent results
+    err += np * (J(0, 1) + J(0, 2) + J(1, 2));
+}
+
+void ChParticleCloudSoA::IntToDescriptor(const unsigned int off_v,  // offset in v, R
+                                         const ChStateDelta& v,
+                                         const ChVectorDynamic<>& R,
+                                         const unsigned int off_L,  // offset in L, Qc
+                                         const ChVectorDynamic<>& L,
+                                         const ChVectorDynamic<>& Qc) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        m_particles[j].variables.State() = v.segment(off_v + 6 * j, 6);
+        m_particles[j].variables.Force() = R.segment(off_v + 6 * j, 6);
+    }
+}
+
+void ChParticleCloudSoA::IntFromDescriptor(const unsigned int off_v,  // offset in v
+                                           ChStateDelta& v,
+                                           const unsigned int off_L,  // offset in L
+                                           ChVectorDynamic<>& L) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        v.segment(off_v + 6 * j, 6) = m_particles[j].variables.State();
+    }
+}
+
+void ChParticleCloudSoA::InjectVariables(ChSystemDescriptor& descriptor) {
+    for (auto& particle : m_particles) {
+        particle.variables.SetDisabled(!IsActive());
+        descriptor.InsertVariables(&particle.variables);
+    }
+}
+
+void ChParticleCloudSoA::VariablesFbReset() {
+    for (auto& particle : m_particles)
+        particle.variables.Force().setZero();
+}
+
+void ChParticleCloudSoA::VariablesFbLoadForces(double factor) {
+    ChVector3d Gforce;
+    if (GetSystem())
+        Gforce = GetSystem()->GetGravitationalAcceleration() * particle_mass.GetBodyMass();
+    const ChMatrix33<>& J = particle_mass.GetBodyInertia();
+
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        ChVector3d Wvel(m_wvel.x[j], m_wvel.y[j], m_wvel.z[j]);
+        ChVector3d gyro = Vcross(Wvel, J * Wvel);
+
+        auto fb = m_particles[j].variables.Force();
+        fb(0) += factor * (m_force.x[j] + Gforce.x());
+        fb(1) += factor * (m_force.y[j] + Gforce.y());
+        fb(2) += factor * (m_force.z[j] + Gforce.z());
+        fb(3) += factor * (m_torque.x[j] - gyro.x());
+        fb(4) += factor * (m_torque.y[j] - gyro.y());
+        fb(5) += factor * (m_torque.z[j] - gyro.z());
+    }
+}
+
+void ChParticleCloudSoA::VariablesQbLoadSpeed() {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        // set current speed in 'qb', it can be used by the solver when working in incremental mode
+        auto qb = m_particles[j].variables.State();
+        qb(0) = m_vel.x[j];
+        qb(1) = m_vel.y[j];
+        qb(2) = m_vel.z[j];
+        qb(3) = m_wvel.x[j];
+        qb(4) = m_wvel.y[j];
+        qb(5) = m_wvel.z[j];
+    }
+}
+
+void ChParticleCloudSoA::VariablesFbIncrementMq() {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        auto& variables = m_particles[j].variables;
+        variables.AddMassTimesVector(variables.Force(), variables.State());
+    }
+}
+
+void ChParticleCloudSoA::VariablesQbSetSpeed(double step) {
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        auto qb = m_particles[j].variables.State();
+
+        // Compute accel. by BDF (approximate by differentiation)
+        if (step) {
+            m_acc.x[j] = (qb(0) - m_vel.x[j]) / step;
+            m_acc.y[j] = (qb(1) - m_vel.y[j]) / step;
+            m_acc.z[j] = (qb(2) - m_vel.z[j]) / step;
+            m_wacc.x[j] = (qb(3) - m_wvel.x[j]) / step;
+            m_wacc.y[j] = (qb(4) - m_wvel.y[j]) / step;
+            m_wacc.z[j] = (qb(5) - m_wvel.z[j]) / step;
+        }
+
+        // from 'qb' vector, set particle speed
+        m_vel.x[j] = qb(0);
+        m_vel.y[j] = qb(1);
+        m_vel.z[j] = qb(2);
+        m_wvel.x[j] = qb(3);
+        m_wvel.y[j] = qb(4);
+        m_wvel.z[j] = qb(5);
+    }
+}
+
+void ChParticleCloudSoA::VariablesQbIncrementPosition(double dt_step) {
+    if (!IsActive())
+        return;
+
+    int np = (int)m_particles.size();
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int j = 0; j < np; j++) {
+        // Update position with incremental action of speed contained in the 'qb' vector (as in an Euler step)
+        auto qb = m_particles[j].variables.State();
+
+        // ADVANCE POSITION: pos' = pos + dt * vel
+        m_pos.x[j] += qb(0) * dt_step;
+        m_pos.y[j] += qb(1) * dt_step;
+        m_pos.z[j] += qb(2) * dt_step;
+
+        // ADVANCE ROTATION: rot' = rot * [dt*wloc]
+        ChQuaterniond rel_q;
+        rel_q.SetFromRotVec(ChVector3d(qb(3), qb(4), qb(5)) * dt_step);
+        m_rot.Set(j, m_rot.Get(j) * rel_q);
+    }
+}
+
+void ChParticleCloudSoA::ForceToRest() {
+    m_vel.setZero();
+    m_wvel.setZero();
+    m_acc.setZero();
+    m_wacc.setZero();
+}
+
+// The inertia tensor functions
+
+void ChParticleCloudSoA::SetInertia(const ChMatrix33<>& newXInertia) {
+    particle_mass.SetBodyInertia(newXInertia);
+}
+
+void ChParticleCloudSoA::SetInertiaXX(const ChVector3d& iner) {
+    particle_mass.GetBodyInertia()(0, 0) = iner.x();
+    particle_mass.GetBodyInertia()(1, 1) = iner.y();
+    particle_mass.GetBodyInertia()(2, 2) = iner.z();
+    particle_mass.GetBodyInvInertia() = particle_mass.GetBodyInertia().inverse();
+}
+
+void ChParticleCloudSoA::SetInertiaXY(const ChVector3d& iner) {
+    particle_mass.GetBodyInertia()(0, 1) = iner.x();
+    particle_mass.GetBodyInertia()(0, 2) = iner.y();
+    particle_mass.GetBodyInertia()(1, 2) = iner.z();
+    particle_mass.GetBodyInertia()(1, 0) = iner.x();
+    particle_mass.GetBodyInertia()(2, 0) = iner.y();
+    particle_mass.GetBodyInertia()(2, 1) = iner.z();
+    particle_mass.GetBodyInvInertia() = particle_mass.GetBodyInertia().inverse();
+}
+
+ChVector3d ChParticleCloudSoA::GetInertiaXX() const {
+    const ChMatrix33<>& J = particle_mass.GetBodyInertia();
+    return ChVector3d(J(0, 0), J(1, 1), J(2, 2));
+}
+
+ChVector3d ChParticleCloudSoA::GetInertiaXY() const {
+    const ChMatrix33<>& J = particle_mass.GetBodyInertia();
+    return ChVector3d(J(0, 1), J(0, 2), J(1, 2));
+}
+
+// Collision functions
+
+void ChParticleCloudSoA::EnableCollision(bool state) {
+    // Nothing to do if no change in state
+    if (state == collide)
+        return;
+
+    collide = state;
+
+    // Nothing to do if there is no collision model, if not attached to a system, or if the collision system was not
+    // initialized (in the latter case, the collision models will be processed at initialization)
+    if (!particle_collision_model || !GetSystem())
+        return;
+    auto coll_sys = GetSystem()->GetCollisionSystem();
+    if (!coll_sys || !coll_sys->IsInitialized() || m_particles.empty())
+        return;
+
+    // If enabling collision, add to collision system if not already processed
+    if (collide && !m_particles[0].GetCollisionModel()->HasImplementation()) {
+        for (auto& particle : m_particles)
+            coll_sys->Add(particle.GetCollisionModel());
+        return;
+    }
+
+    // If disabling collision, remove from the collision system if already processed
+    if (!collide && m_particles[0].GetCollisionModel()->HasImplementation()) {
+        for (auto& particle : m_particles)
+            coll_sys->Remove(particle.GetCollisionModel());
+        return;
+    }
+}
+
+void ChParticleCloudSoA::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
+    if (collide && particle_collision_model) {
+        for (const auto& particle : m_particles)
+            coll_sys->Add(particle.GetCollisionModel());
+    }
+}
+
+void ChParticleCloudSoA::RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) const {
+    if (particle_collision_model) {
+        for (const auto& particle : m_particles)
+            coll_sys->Remove(particle.GetCollisionModel());
+    }
+}
+
+void ChParticleCloudSoA::SyncCollisionModels() {
+    if (!particle_collision_model)
+        return;
+
+    for (auto& particle : m_particles)
+        particle.GetCollisionModel()->SyncPosition();
+}
+
+// Serialization
+
+void ChParticleCloudSoA::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChParticleCloudSoA>();
+
+    // serialize parent class
+    ChPhysicsItem::ArchiveOut(archive_out);
+
+    // serialize all member data:
+    archive_out << CHNVP(particle_collision_model);
+    archive_out << CHNVP(fixed);
+    archive_out << CHNVP(collide);
+    archive_out << make_ChNameValue("pos_x", m_pos.x);
+    archive_out << make_ChNameValue("pos_y", m_pos.y);
+    archive_out << make_ChNameValue("pos_z", m_pos.z);
+    archive_out << make_ChNameValue("rot_e0", m_rot.e0);
+    archive_out << make_ChNameValue("rot_e1", m_rot.e1);
+    archive_out << make_ChNameValue("rot_e2", m_rot.e2);
+    archive_out << make_ChNameValue("rot_e3", m_rot.e3);
+    archive_out << make_ChNameValue("vel_x", m_vel.x);
+    archive_out << make_ChNameValue("vel_y", m_vel.y);
+    archive_out << make_ChNameValue("vel_z", m_vel.z);
+    archive_out << make_ChNameValue("wvel_x", m_wvel.x);
+    archive_out << make_ChNameValue("wvel_y", m_wvel.y);
+    archive_out << make_ChNameValue("wvel_z", m_wvel.z);
+}
+
+void ChParticleCloudSoA::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChParticleCloudSoA>();
+
+    // deserialize parent class:
+    ChPhysicsItem::ArchiveIn(archive_in);
+
+    // deserialize all member data:
+    archive_in >> CHNVP(particle_collision_model);
+    archive_in >> CHNVP(fixed);
+    archive_in >> CHNVP(collide);
+    archive_in >> make_ChNameValue("pos_x", m_pos.x);
+    archive_in >> make_ChNameValue("pos_y", m_pos.y);
+    archive_in >> make_ChNameValue("pos_z", m_pos.z);
+    archive_in >> make_ChNameValue("rot_e0", m_rot.e0);
+    archive_in >> make_ChNameValue("rot_e1", m_rot.e1);
+    archive_in >> make_ChNameValue("rot_e2", m_rot.e2);
+    archive_in >> make_ChNameValue("rot_e3", m_rot.e3);
+    archive_in >> make_ChNameValue("vel_x", m_vel.x);
+    archive_in >> make_ChNameValue("vel_y", m_vel.y);
+    archive_in >> make_ChNameValue("vel_z", m_vel.z);
+    archive_in >> make_ChNameValue("wvel_x", m_wvel.x);
+    archive_in >> make_ChNameValue("wvel_y", m_wvel.y);
+    archive_in >> make_ChNameValue("wvel_z", m_wvel.z);
+
+    // recreate the remaining arrays and the contactable handles
+    m_particles.clear();
+    ResizeArrays(m_pos.x.size());
+}
+
+}  // end namespace chrono
@@ -0,0 +1,378 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_PARTICLE_CLOUD_SOA_H
+#define CH_PARTICLE_CLOUD_SOA_H
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "chrono/collision/ChCollisionModel.h"
+#include "chrono/physics/ChContactable.h"
+#include "chrono/physics/ChPhysicsItem.h"
+#include "chrono/solver/ChVariablesBodySharedMass.h"
+
+namespace chrono {
+
+class ChParticleCloudSoA;
+
+/// Contactable handle for a single particle of a ChParticleCloudSoA.
+/// The particle state is not stored here but in the flat arrays of the owning cloud; this object only carries the
+/// particle index, the solver variables, and the collision model of the particle.
+class ChApi ChParticleSoA : public ChContactable_1vars<6> {
+  public:
+    ChParticleSoA() : container(nullptr), index(0) {}
+
+    /// Get the cloud containing this particle.
+    ChParticleCloudSoA* GetContainer() const { return container; }
+
+    /// Get the index of this particle in its cloud.
+    unsigned int GetIndex() const { return index; }
+
+    /// Access the solver variables of this particle.
+    ChVariablesBodySharedMass& Variables() { return variables; }
+
+    // INTERFACE TO ChContactable
+
+    virtual ChContactable::eChContactableType GetContactableType() const override { return CONTACTABLE_6; }
+    virtual ChVariables* GetVariables1() override { return &variables; }
+    virtual bool IsContactActive() override { return true; }
+    virtual int GetContactableNumCoordsPosLevel() override { return 7; }
+    virtual int GetContactableNumCoordsVelLevel() override { return 6; }
+    virtual void ContactableGetStateBlockPosLevel(ChState& x) override;
+    virtual void ContactableGetStateBlockVelLevel(ChStateDelta& w) override;
+    virtual void ContactableIncrementState(const ChState& x, const ChStateDelta& dw, ChState& x_new) override;
+    virtual ChVector3d GetContactPoint(const ChVector3d& loc_point, const ChState& state_x) override;
+    virtual ChVector3d GetContactPointSpeed(const ChVector3d& loc_point,
+                                            const ChState& state_x,
+                                            const ChStateDelta& state_w) override;
+    virtual ChVector3d GetContactPointSpeed(const ChVector3d& abs_point) override;
+    virtual ChFrame<> GetCollisionModelFrame() override;
+    virtual void ContactForceLoadResidual_F(const ChVector3d& F,
+                                            const ChVector3d& T,
+                                            const ChVector3d& abs_point,
+                                            ChVectorDynamic<>& R) override;
+    virtual void ContactComputeQ(const ChVector3d& F,
+                                 const ChVector3d& T,
+                                 const ChVector3d& point,
+                                 const ChState& state_x,
+                                 ChVectorDynamic<>& Q,
+                                 int offset) override;
+    virtual void ComputeJacobianForContactPart(const ChVector3d& abs_point,
+                                               ChMatrix33<>& contact_plane,
+                                               type_constraint_tuple& jacobian_tuple_N,
+                                               type_constraint_tuple& jacobian_tuple_U,
+                                               type_constraint_tuple& jacobian_tuple_V,
+                                               bool second) override;
+    virtual void ComputeJacobianForRollingContactPart(const ChVector3d& abs_point,
+                                                      ChMatrix33<>& contact_plane,
+                                                      type_constraint_tuple& jacobian_tuple_N,
+                                                      type_constraint_tuple& jacobian_tuple_U,
+                                                      type_constraint_tuple& jacobian_tuple_V,
+                                                      bool second) override;
+    virtual double GetContactableMass() override { return variables.GetBodyMass(); }
+    virtual ChPhysicsItem* GetPhysicsItem() override;
+
+  private:
+    ChCoordsys<> GetCoordsys() const;
+
+    ChParticleCloudSoA* container;
+    unsigned int index;
+    ChVariablesBodySharedMass variables;
+
+    friend class ChParticleCloudSoA;
+};
+
+/// Cluster of identical rigid particles, with state stored in a structure-of-arrays layout.
+/// Like ChParticleCloud, all particles share the same mass, inertia, and collision shape. Unlike ChParticleCloud,
+/// positions, rotations, velocities, accelerations, and applied forces of all particles are stored in separate flat
+/// arrays (one per component), so that state gather/scatter, state increments, and residual loads are tight loops over
+/// contiguous memory without per-particle virtual calls. These loops are executed on the Chrono threads of the system.
+/// Speed limits and sleeping are not supported.
+class ChApi ChParticleCloudSoA : public ChPhysicsItem {
+  public:
+    ChParticleCloudSoA();
+    ChParticleCloudSoA(const ChParticleCloudSoA& other);
+    ~ChParticleCloudSoA() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChParticleCloudSoA* Clone() const override { return new ChParticleCloudSoA(*this); }
+
+    /// Enable/disable the collision for this cluster of particles.
+    void EnableCollision(bool state);
+    virtual bool IsCollisionEnabled() const override { return collide; }
+
+    /// Set the state of all particles in the cluster to 'fixed' (default: false).
+    /// If true, the particles do not move.
+    void SetFixed(bool state) { fixed = state; }
+
+    /// Return true if the particle cluster is currently active and therefore included into the system solver.
+    /// A cluster is inactive if it is fixed to ground.
+    virtual bool IsActive() const override { return !fixed; }
+
+    /// Get the number of particles.
+    size_t GetNumParticles() const { return m_particles.size(); }
+
+    /// Add a collision model for particles in this cloud.
+    /// This is the "template" collision model that is used by all particles added afterwards.
+    void AddCollisionModel(std::shared_ptr<ChCollisionModel> model) { particle_collision_model = model; }
+
+    /// Add a collision shape for particles in this cloud.
+    /// If a collision model does not already exist, it is first created.
+    void AddCollisionShape(std::shared_ptr<ChCollisionShape> shape, const ChFrame<>& frame = ChFrame<>());
+
+    /// Reserve storage for the given number of particles.
+    void Reserve(size_t n);
+
+    /// Resize the particle cluster.
+    /// This first deletes all existing particles, if any. New particles are at rest, in the absolute frame.
+    void ResizeNparticles(int newsize);
+
+    /// Add a new particle to the particle cluster, passing a coordinate system as initial state.
+    void AddParticle(const ChCoordsys<>& initial_state = CSYSNORM, const ChVector3d& initial_vel = VNULL);
+
+    /// Access the contactable handle of the N-th particle.
+    ChParticleSoA& Particle(unsigned int n) { return m_particles[n]; }
+
+    /// Get the position of the N-th particle.
+    ChVector3d GetParticlePos(unsigned int n) const { return m_pos.Get(n); }
+
+    /// Set the position of the N-th particle.
+    void SetParticlePos(unsigned int n, const ChVector3d& pos) { m_pos.Set(n, pos); }
+
+    /// Get the rotation of the N-th particle.
+    ChQuaterniond GetParticleRot(unsigned int n) const { return m_rot.Get(n); }
+
+    /// Set the rotation of the N-th particle.
+    void SetParticleRot(unsigned int n, const ChQuaterniond& rot) { m_rot.Set(n, rot); }
+
+    /// Get the linear velocity of the N-th particle (in the absolute frame).
+    ChVector3d GetParticleVel(unsigned int n) const { return m_vel.Get(n); }
+
+    /// Set the linear velocity of the N-th particle (in the absolute frame).
+    void SetParticleVel(unsigned int n, const ChVector3d& vel) { m_vel.Set(n, vel); }
+
+    /// Get the angular velocity of the N-th particle (in the particle frame).
+    ChVector3d GetParticleAngVelLocal(unsigned int n) const { return m_wvel.Get(n); }
+
+    /// Set the angular velocity of the N-th particle (in the particle frame).
+    void SetParticleAngVelLocal(unsigned int n, const ChVector3d& wvel) { m_wvel.Set(n, wvel); }
+
+    /// Get the linear acceleration of the N-th particle (in the absolute frame).
+    ChVector3d GetParticleAcc(unsigned int n) const { return m_acc.Get(n); }
+
+    /// Get the angular acceleration of the N-th particle (in the particle frame).
+    ChVector3d GetParticleAngAccLocal(unsigned int n) const { return m_wacc.Get(n); }
+
+    /// Set the user force applied to the center of the N-th particle (in the absolute frame).
+    void SetParticleForce(unsigned int n, const ChVector3d& force) { m_force.Set(n, force); }
+
+    /// Get the user force applied to the N-th particle (in the absolute frame).
+    ChVector3d GetParticleForce(unsigned int n) const { return m_force.Get(n); }
+
+    /// Set the user torque applied to the N-th particle (in the particle frame).
+    void SetParticleTorque(unsigned int n, const ChVector3d& torque) { m_torque.Set(n, torque); }
+
+    /// Get the user torque applied to the N-th particle (in the particle frame).
+    ChVector3d GetParticleTorque(unsigned int n) const { return m_torque.Get(n); }
+
+    /// Mass of each particle. Must be positive.
+    void SetMass(double newmass) {
+        if (newmass > 0)
+            particle_mass.SetBodyMass(newmass);
+    }
+    double GetMass() const { return particle_mass.GetBodyMass(); }
+
+    /// Set the inertia tensor of each particle.
+    void SetInertia(const ChMatrix33<>& newXInertia);
+
+    /// Set the diagonal part of the inertia tensor of each particle.
+    void SetInertiaXX(const ChVector3d& iner);
+
+    /// Get the diagonal part of the inertia tensor of each particle.
+    ChVector3d GetInertiaXX() const;
+
+    /// Set the extra-diagonal part of the inertia tensor of each particle
+    /// (xy, yz, zx values, the rest is symmetric).
+    void SetInertiaXY(const ChVector3d& iner);
+
+    /// Get the extra-diagonal part of the inertia tensor of each particle
+    /// (xy, yz, zx values, the rest is symmetric).
+    ChVector3d GetInertiaXY() const;
+
+    /// Get the reference frame (expressed in and relative to the absolute frame) of the visual model.
+    /// For a particle cloud, this returns the frame of the corresponding particle.
+    virtual ChFrame<> GetVisualModelFrame(unsigned int nclone = 0) const override;
+
+    virtual unsigned int GetNumVisualModelClones() const override { return (unsigned int)GetNumParticles(); }
+
+    // STATE FUNCTIONS
+
+    virtual unsigned int GetNumCoordsPosLevel() override { return 7 * (unsigned int)GetNumParticles(); }
+    virtual unsigned int GetNumCoordsVelLevel() override { return 6 * (unsigned int)GetNumParticles(); }
+
+    // (override/implement interfaces for global state vectors, see ChPhysicsItem for comments.)
+    virtual void IntStateGather(const unsigned int off_x,
+                                ChState& x,
+                                const unsigned int off_v,
+                                ChStateDelta& v,
+                                double& T) override;
+    virtual void IntStateScatter(const unsigned int off_x,
+                                 const ChState& x,
+                                 const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const double T,
+                                 bool full_update) override;
+    virtual void IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) override;
+    virtual void IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) override;
+    virtual void IntStateIncrement(const unsigned int off_x,
+                                   ChState& x_new,
+                                   const ChState& x,
+                                   const unsigned int off_v,
+                                   const ChStateDelta& Dv) override;
+    virtual void IntStateGetIncrement(const unsigned int off_x,
+                                      const ChState& x_new,
+                                      const ChState& x,
+                                      const unsigned int off_v,
+                                      ChStateDelta& Dv) override;
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+    virtual void IntLoadResidual_Mv(const unsigned int off,
+                                    ChVectorDynamic<>& R,
+                                    const ChVectorDynamic<>& w,
+                                    const double c) override;
+    virtual void IntLoadLumpedMass_Md(const unsigned int off,
+                                      ChVectorDynamic<>& Md,
+                                      double& err,
+                                      const double c) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    // SOLVER FUNCTIONS
+
+    virtual void VariablesFbReset() override;
+    virtual void VariablesFbLoadForces(double factor = 1) override;
+    virtual void VariablesQbLoadSpeed() override;
+    virtual void VariablesFbIncrementMq() override;
+    virtual void VariablesQbSetSpeed(double step = 0) override;
+    virtual void VariablesQbIncrementPosition(double step) override;
+    virtual void InjectVariables(ChSystemDescriptor& descriptor) override;
+
+    // Other functions
+
+    /// Set no speed and no accelerations (but does not change the position).
+    virtual void ForceToRest() override;
+
+    /// Add collision models (if any) for all particles to the provided collision system.
+    virtual void AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const override;
+
+    /// Remove the collision models (if any) for all particles from the provided collision system.
+    virtual void RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) const override;
+
+    /// Synchronize the position and bounding box of all particle collision models (if any).
+    virtual void SyncCollisionModels() override;
+
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// Components of a 3D vector quantity of all particles, in separate contiguous arrays.
+    struct Vec3Array {
+        std::vector<double> x, y, z;
+
+        void resize(size_t n) {
+            x.resize(n, 0.0);
+            y.resize(n, 0.0);
+            z.resize(n, 0.0);
+        }
+        void reserve(size_t n) {
+            x.reserve(n);
+            y.reserve(n);
+            z.reserve(n);
+        }
+        void setZero() {
+            std::fill(x.begin(), x.end(), 0.0);
+            std::fill(y.begin(), y.end(), 0.0);
+            std::fill(z.begin(), z.end(), 0.0);
+        }
+        ChVector3d Get(size_t j) const { return ChVector3d(x[j], y[j], z[j]); }
+        void Set(size_t j, const ChVector3d& v) {
+            x[j] = v.x();
+            y[j] = v.y();
+            z[j] = v.z();
+        }
+    };
+
+    /// Components of the rotation quaternions of all particles, in separate contiguous arrays.
+    struct QuatArray {
+        std::vector<double> e0, e1, e2, e3;
+
+        void resize(size_t n) {
+            e0.resize(n, 1.0);
+            e1.resize(n, 0.0);
+            e2.resize(n, 0.0);
+            e3.resize(n, 0.0);
+        }
+        void reserve(size_t n) {
+            e0.reserve(n);
+            e1.reserve(n);
+            e2.reserve(n);
+            e3.reserve(n);
+        }
+        ChQuaterniond Get(size_t j) const { return ChQuaterniond(e0[j], e1[j], e2[j], e3[j]); }
+        void Set(size_t j, const ChQuaterniond& q) {
+            e0[j] = q.e0();
+            e1[j] = q.e1();
+            e2[j] = q.e2();
+            e3[j] = q.e3();
+        }
+    };
+
+    /// Resize the state arrays and create the contactable handles of any new particles.
+    void ResizeArrays(size_t n);
+
+    /// Get the number of threads for loops over particles.
+    int GetNumThreads() const;
+
+    Vec3Array m_pos;     ///< particle positions
+    QuatArray m_rot;     ///< particle rotations
+    Vec3Array m_vel;     ///< particle linear velocities (absolute frame)
+    Vec3Array m_wvel;    ///< particle angular velocities (local frame)
+    Vec3Array m_acc;     ///< particle linear accelerations (absolute frame)
+    Vec3Array m_wacc;    ///< particle angular accelerations (local frame)
+    Vec3Array m_force;   ///< user forces (absolute frame)
+    Vec3Array m_torque;  ///< user torques (local frame)
+
+    std::deque<ChParticleSoA> m_particles;  ///< contactable handles (stable addresses)
+    ChSharedMassBody particle_mass;         ///< shared mass of particles
+
+    std::shared_ptr<ChCollisionModel> particle_collision_model;  ///< sample collision model
+
+    bool fixed;
+    bool collide;
+
+    friend class ChParticleSoA;
+};
+
+CH_CLASS_VERSION(ChParticleCloudSoA, 0)
+
+}  // end namespace chrono
+
+#endif
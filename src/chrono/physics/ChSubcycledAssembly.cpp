@@ -0,0 +1,194 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSubcycledAssembly.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChSubcycledAssembly)
+
+ChSubcycledAssembly::ChSubcycledAssembly(ChContactMethod contact_method) : m_num_substeps(10) {
+    if (contact_method == ChContactMethod::NSC)
+        m_subsystem = chrono_types::make_shared<ChSystemNSC>();
+    else
+        m_subsystem = chrono_types::make_shared<ChSystemSMC>();
+}
+
+ChSubcycledAssembly::ChSubcycledAssembly(const ChSubcycledAssembly& other) : ChPhysicsItem(other) {
+    m_subsystem = other.m_subsystem;
+    m_num_substeps = other.m_num_substeps;
+    m_interface_bodies = other.m_interface_bodies;
+    m_interface_start = other.m_interface_start;
+    m_interface_forces = other.m_interface_forces;
+}
+
+void ChSubcycledAssembly::AddInterfaceBody(std::shared_ptr<ChBody> body) {
+    m_interface_bodies.push_back(body);
+    m_interface_start.resize(m_interface_bodies.size());
+    m_interface_forces.setZero(6 * m_interface_bodies.size());
+}
+
+ChVector3d ChSubcycledAssembly::GetInterfaceForce(unsigned int i) const {
+    return ChVector3d(m_interface_forces.segment(6 * i, 3));
+}
+
+ChVector3d ChSubcycledAssembly::GetInterfaceTorque(unsigned int i) const {
+    return ChVector3d(m_interface_forces.segment(6 * i + 3, 3));
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSubcycledAssembly::BeginStep() {
+    for (size_t i = 0; i < m_interface_bodies.size(); i++) {
+        const auto& body = m_interface_bodies[i];
+        m_interface_start[i] = {body->GetPos(), body->GetRot(), body->GetPosDt(), body->GetAngVelLocal()};
+    }
+}
+
+void ChSubcycledAssembly::SetInterfaceState(const InterfaceState& s0,
+                                            const InterfaceState& s1,
+                                            double alpha,
+                                            ChBody& body) {
+    // Linear interpolation of positions and velocities, normalized linear interpolation of rotations
+    ChQuaternion<> rot1 = (s0.rot.Dot(s1.rot) < 0) ? -s1.rot : s1.rot;
+    body.SetPos(s0.pos * (1 - alpha) + s1.pos * alpha);
+    body.SetRot((s0.rot * (1 - alpha) + rot1 * alpha).GetNormalized());
+    body.SetPosDt(s0.vel * (1 - alpha) + s1.vel * alpha);
+    body.SetAngVelLocal(s0.wvel * (1 - alpha) + s1.wvel * alpha);
+    body.Update(m_subsystem->GetChTime(), false);
+}
+
+void ChSubcycledAssembly::Subcycle(double step) {
+    size_t num_interface = m_interface_bodies.size();
+
+    // States of the interface bodies at the end of the step of the containing system
+    std::vector<InterfaceState> end_state(num_interface);
+    for (size_t i = 0; i < num_interface; i++) {
+        const auto& body = m_interface_bodies[i];
+        end_state[i] = {body->GetPos(), body->GetRot(), body->GetPosDt(), body->GetAngVelLocal()};
+    }
+
+    // Exclude the interface bodies from the subsystem solve (their motion is prescribed)
+    std::vector<bool> disabled(num_interface);
+    for (size_t i = 0; i < num_interface; i++) {
+        disabled[i] = m_interface_bodies[i]->Variables().IsDisabled();
+        m_interface_bodies[i]->Variables().SetDisabled(true);
+    }
+
+    m_subsystem->SetGravitationalAcceleration(GetSystem()->GetGravitationalAcceleration());
+    m_subsystem->SetChTime(GetSystem()->GetChTime() - step);
+    m_interface_accum.setZero(6 * num_interface);
+
+    double h = step / m_num_substeps;
+    for (unsigned int k = 0; k < m_num_substeps; k++) {
+        // Prescribe the interface bodies at the end of the substep
+        double alpha = (k + 1.0) / m_num_substeps;
+        for (size_t i = 0; i < num_interface; i++)
+            SetInterfaceState(m_interface_start[i], end_state[i], alpha, *m_interface_bodies[i]);
+
+        m_subsystem->DoStepDynamics(h);
+        AccumulateInterfaceForces();
+    }
+
+    // Restore the interface bodies
+    for (size_t i = 0; i < num_interface; i++) {
+        auto& body = m_interface_bodies[i];
+        body->SetPos(end_state[i].pos);
+        body->SetRot(end_state[i].rot);
+        body->SetPosDt(end_state[i].vel);
+        body->SetAngVelLocal(end_state[i].wvel);
+        body->Update(GetSystem()->GetChTime(), false);
+        body->Variables().SetDisabled(disabled[i]);
+    }
+
+    // Average the interface forces over the substeps (impulse-preserving)
+    m_interface_forces = m_interface_accum / m_num_substeps;
+}
+
+// Calculate the generalized forces exerted by the constraints of the subsystem on the interface bodies, Cq_i' * L.
+// The interface variables are temporarily activated, with offsets past the end of the subsystem velocity vector.
+void ChSubcycledAssembly::AccumulateInterfaceForces() {
+    size_t num_interface = m_interface_bodies.size();
+    if (num_interface == 0)
+        return;
+
+    unsigned int nv = m_subsystem->GetNumCoordsVelLevel();
+    unsigned int nc = m_subsystem->GetNumConstraints();
+
+    ChVectorDynamic<> L(nc);
+    m_subsystem->StateGatherReactions(L);
+    m_subsystem->LoadConstraintJacobians();
+
+    std::vector<unsigned int> offsets(num_interface);
+    for (size_t i = 0; i < num_interface; i++) {
+        auto& variables = m_interface_bodies[i]->Variables();
+        offsets[i] = variables.GetOffset();
+        variables.SetOffset(nv + 6 * (unsigned int)i);
+        variables.SetDisabled(false);
+    }
+
+    ChVectorDynamic<> R;
+    R.setZero(nv + 6 * num_interface);
+    m_subsystem->LoadResidual_CqL(R, L, 1.0);
+    m_interface_accum += R.tail(6 * num_interface);
+
+    for (size_t i = 0; i < num_interface; i++) {
+        auto& variables = m_interface_bodies[i]->Variables();
+        variables.SetOffset(offsets[i]);
+        variables.SetDisabled(true);
+    }
+}
+
+void ChSubcycledAssembly::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    for (size_t i = 0; i < m_interface_bodies.size(); i++) {
+        const auto& body = m_interface_bodies[i];
+        if (body->Variables().IsActive())
+            R.segment(body->GetOffset_w(), 6) += c * m_interface_forces.segment(6 * i, 6);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSubcycledAssembly::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChSubcycledAssembly>();
+
+    // serialize parent class
+    ChPhysicsItem::ArchiveOut(archive_out);
+
+    // serialize all member data:
+    archive_out << CHNVP(m_subsystem, "subsystem");
+    archive_out << CHNVP(m_num_substeps, "num_substeps");
+    archive_out << CHNVP(m_interface_bodies, "interface_bodies");
+    archive_out << CHNVP(m_interface_forces, "interface_forces");
+}
+
+void ChSubcycledAssembly::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChSubcycledAssembly>();
+
+    // deserialize parent class
+    ChPhysicsItem::ArchiveIn(archive_in);
+
+    // deserialize all member data:
+    archive_in >> CHNVP(m_subsystem, "subsystem");
+    archive_in >> CHNVP(m_num_substeps, "num_substeps");
+    archive_in >> CHNVP(m_interface_bodies, "interface_bodies");
+    archive_in >> CHNVP(m_interface_forces, "interface_forces");
+
+    m_interface_start.resize(m_interface_bodies.size());
+}
+
+}  // end namespace chrono
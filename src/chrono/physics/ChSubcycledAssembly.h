@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_SUBCYCLED_ASSEMBLY_H
+#define CH_SUBCYCLED_ASSEMBLY_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+/// Group of physics items integrated with a smaller step size than the containing system (multirate integration).
+///
+/// The items of the group (for example, a driveline made of ChShaft elements, or a hydraulic actuator) are kept in a
+/// separate assembly, with its own solver and integrator, and are hidden from the solver of the containing system.
+/// After each step of the containing system, the group is advanced over the same time interval with a given number of
+/// substeps.
+///
+/// The group is coupled to the rest of the system through interface bodies, i.e. bodies of the containing system that
+/// are referenced by links of the group (see AddInterfaceBody):
+/// - during the substeps, the motion of the interface bodies is prescribed, interpolating between their states at the
+///   beginning and at the end of the step of the containing system;
+/// - the reaction forces exerted by the links of the group on the interface bodies are averaged over the substeps
+///   (thus preserving the transferred impulse) and applied to the interface bodies during the next step of the
+///   containing system.
+///
+/// The coupling is therefore explicit: the interface forces acting on the containing system lag by one step. This is
+/// accurate and stable as long as the interface forces vary little over a step of the containing system, i.e. as long
+/// as that step is small compared to the period of the fastest mode coupling the group and the interface bodies
+/// (roughly, h < 2 / omega, with omega the corresponding natural frequency). Stiff couplings, or groups with
+/// significant inertia relative to the interface bodies, may require a smaller step of the containing system.
+///
+/// A group can be added to the containing system directly or to a nested assembly. Items of a subcycled group should
+/// not participate in collision detection.
+class ChApi ChSubcycledAssembly : public ChPhysicsItem {
+  public:
+    ChSubcycledAssembly(ChContactMethod contact_method = ChContactMethod::NSC);
+    ChSubcycledAssembly(const ChSubcycledAssembly& other);
+    ~ChSubcycledAssembly() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    /// Note that the copy shares the underlying subsystem with the original.
+    virtual ChSubcycledAssembly* Clone() const override { return new ChSubcycledAssembly(*this); }
+
+    /// Set the number of substeps taken for each step of the containing system.
+    void SetNumSubsteps(unsigned int num_substeps) { m_num_substeps = num_substeps; }
+
+    /// Get the number of substeps taken for each step of the containing system.
+    unsigned int GetNumSubsteps() const { return m_num_substeps; }
+
+    /// Add an item (body, shaft, link, mesh, or other physics item) to the group.
+    void Add(std::shared_ptr<ChPhysicsItem> item) { m_subsystem->Add(item); }
+
+    /// Declare a body of the containing system as an interface body for this group.
+    /// All bodies of the containing system referenced by links in this group must be declared as interface bodies.
+    void AddInterfaceBody(std::shared_ptr<ChBody> body);
+
+    /// Access the subsystem used to integrate this group.
+    /// Use this to set the solver and the integrator of the group, or to access its assembly.
+    ChSystem& GetSubsystem() const { return *m_subsystem; }
+
+    /// Get the averaged reaction force (in the absolute frame) exerted by the group on the specified interface body
+    /// over the last step.
+    ChVector3d GetInterfaceForce(unsigned int i) const;
+
+    /// Get the averaged reaction torque (in the body local frame) exerted by the group on the specified interface body
+    /// over the last step.
+    ChVector3d GetInterfaceTorque(unsigned int i) const;
+
+    /// Record the state of the interface bodies at the beginning of a step of the containing system.
+    /// This function is called automatically by the containing ChSystem.
+    void BeginStep();
+
+    /// Advance the group over the step just completed by the containing system, using the specified number of substeps.
+    /// This function is called automatically by the containing ChSystem.
+    void Subcycle(double step);
+
+    // PHYSICS ITEM INTERFACE
+
+    /// Add the averaged interface forces to the residual of the containing system.
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+
+    // SERIALIZATION
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow deserialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// State of an interface body.
+    struct InterfaceState {
+        ChVector3d pos;
+        ChQuaternion<> rot;
+        ChVector3d vel;
+        ChVector3d wvel;  ///< angular velocity, local frame
+    };
+
+    void SetInterfaceState(const InterfaceState& s0, const InterfaceState& s1, double alpha, ChBody& body);
+    void AccumulateInterfaceForces();
+
+    std::shared_ptr<ChSystem> m_subsystem;  ///< subsystem containing the items of the group
+    unsigned int m_num_substeps;            ///< number of substeps per step of the containing system
+
+    std::vector<std::shared_ptr<ChBody>> m_interface_bodies;  ///< bodies of the containing system
+    std::vector<InterfaceState> m_interface_start;            ///< interface states at the beginning of a step
+    ChVectorDynamic<> m_interface_forces;                     ///< averaged generalized interface forces (6 per body)
+    ChVectorDynamic<> m_interface_accum;                      ///< interface forces accumulated over the substeps
+};
+
+CH_CLASS_VERSION(ChSubcycledAssembly, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -13,8 +13,10 @@
 // =============================================================================
 
 #include <algorithm>
+#include <functional>
 #include <iomanip>
 #include <fstream>
+#include <unordered_map>
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
@@ -23,6 +25,7 @@
 #include "chrono/assets/ChVisualSystem.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/physics/ChSubcycledAssembly.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverBB.h"
 #include "chrono/solver/ChSolverPJacobi.h"
@@ -33,6 +36,7 @@
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChDisjointSets.h"
 #include "chrono/physics/ChLinkMate.h"
 
 namespace chrono {
@@ -54,6 +58,8 @@ ChSystem::ChSystem()
       m_RTF(0),
       step(0.04),
       use_sleeping(false),
+      use_islands(false),
+      nislands(1),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
       setupcount(0),
@@ -107,6 +113,8 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
     SetSolverType(other.GetSolverType());
     use_sleeping = other.use_sleeping;
+    use_islands = other.use_islands;
+    nislands = 1;
 
     ncontacts = other.ncontacts;
 
@@ -477,11 +485,31 @@ bool ChSystem::ManageSleepingBodies() {
     }
 
     // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one; if so, set to no sleep.
+    // Build the islands of bodies connected through links and contacts (union-find).
+    // Fixed bodies do not belong to any island, so that they do not connect the bodies resting on them.
+
+    int nbodies = (int)assembly.bodylist.size();
+    std::unordered_map<ChBody*, int> body_index;
+    body_index.reserve(nbodies);
+    for (int i = 0; i < nbodies; i++)
+        body_index[assembly.bodylist[i].get()] = i;
+
+    ChDisjointSets body_islands(nbodies);
+
+    auto connect = [&](ChBody* b1, ChBody* b2) {
+        if (!(b1 && b2) || b1->IsFixed() || b2->IsFixed())
+            return;
+        auto i1 = body_index.find(b1);
+        auto i2 = body_index.find(b2);
+        if (i1 != body_index.end() && i2 != body_index.end())
+            body_islands.Union(i1->second, i2->second);
+    };
 
     // Make this class for iterating through contacts
-    class _wakeup_reporter_class : public ChContactContainer::ReportContactCallback {
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
       public:
+        _island_reporter_class(const std::function<void(ChBody*, ChBody*)>& connect) : m_connect(connect) {}
+
         // Callback, used to report contact points already added to the container.
         // If returns false, the contact scanning will be stopped.
         virtual bool OnReportContact(
@@ -495,107 +523,113 @@ bool ChSystem::ManageSleepingBodies() {
             ChContactable* contactobjA,  // get model A (note: some containers may not support it and could be zero!)
             ChContactable* contactobjB   // get model B (note: some containers may not support it and could be zero!)
             ) override {
-            if (!(contactobjA && contactobjB))
-                return true;
-            ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
-            ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->IsSleeping();
-            bool sleep2 = b2->IsSleeping();
-            bool could_sleep1 = b1->candidate_sleeping;
-            bool could_sleep2 = b2->candidate_sleeping;
-            bool ground1 = b1->IsFixed();
-            bool ground2 = b2->IsFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->candidate_sleeping = false;
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->candidate_sleeping = false;
-            }
-            someone_sleeps = someone_sleeps || sleep1 || sleep2;
-
+            if (contactobjA && contactobjB)
+                m_connect(dynamic_cast<ChBody*>(contactobjA), dynamic_cast<ChBody*>(contactobjB));
             return true;  // to continue scanning contacts
         }
 
-        // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+        std::function<void(ChBody*, ChBody*)> m_connect;
     };
 
-    auto my_waker = chrono_types::make_shared<_wakeup_reporter_class>();
-    my_waker->need_Setup_A = false;
-
-    bool need_Setup_L = false;
-
-    for (int i = 0; i < 1; i++)  //// TODO  reconfigurable number of wakeup cycles
-    {
-        my_waker->someone_sleeps = false;
-
-        // scan all links and wake connected bodies
-        for (auto& link : assembly.linklist) {
-            if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
-                if (Lpointer->IsRequiringWaking()) {
-                    ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                    ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                    if (b1 && b2) {
-                        bool sleep1 = b1->IsSleeping();
-                        bool sleep2 = b2->IsSleeping();
-                        bool could_sleep1 = b1->candidate_sleeping;
-                        bool could_sleep2 = b2->candidate_sleeping;
-                        if (sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->candidate_sleeping = false;
-                        }
-                        if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->candidate_sleeping = false;
-                        }
-                    }
-                }
-            }
+    // scan all links and connect their bodies
+    for (auto& link : assembly.linklist) {
+        if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
+            if (Lpointer->IsRequiringWaking())
+                connect(dynamic_cast<ChBody*>(Lpointer->GetBody1()), dynamic_cast<ChBody*>(Lpointer->GetBody2()));
         }
+    }
 
-        // scan all contacts and wake neighboring bodies
-        contact_container->ReportAllContacts(my_waker);
+    // scan all contacts and connect the bodies in contact
+    contact_container->ReportAllContacts(chrono_types::make_shared<_island_reporter_class>(connect));
 
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker->someone_sleeps)
-            break;
+    // STEP 3:
+    // An island can sleep only if all its bodies are either sleeping or candidates for sleeping.
+    // Put to sleep, or wake up, whole islands.
+
+    std::vector<bool> island_at_rest(nbodies, true);
+    for (int i = 0; i < nbodies; i++) {
+        const auto& body = assembly.bodylist[i];
+        if (!body->IsFixed() && !(body->IsSleeping() || body->candidate_sleeping))
+            island_at_rest[body_islands.Find(i)] = false;
     }
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
-    for (auto& body : assembly.bodylist) {
-        if (body->candidate_sleeping) {
-            body->SetSleeping(true);
-            ++need_Setup_B;
+    bool need_Setup = false;
+    for (int i = 0; i < nbodies; i++) {
+        const auto& body = assembly.bodylist[i];
+        if (body->IsFixed())
+            continue;
+        bool sleep = island_at_rest[body_islands.Find(i)];
+        if (body->IsSleeping() != sleep) {
+            body->SetSleeping(sleep);
+            need_Setup = true;
         }
     }
 
     // if some body has been activated/deactivated because of sleep state changes,
     // the offsets and DOF counts must be updated:
-    if (my_waker->need_Setup_A || need_Setup_B || need_Setup_L) {
+    if (need_Setup) {
         Setup();
         return true;
     }
     return false;
 }
 
+void ChSystem::EnableIslandSolving(bool val) {
+    use_islands = val;
+
+    // Discard the cached solver copies, so that they are recreated from the current solver settings
+    island_solvers.clear();
+    island_solvers_source = nullptr;
+}
+
+bool ChSystem::SolveIslands() {
+    nislands = 1;
+
+    // Solver diagnostics are available only for a global solve
+    if (!use_islands || write_matrix)
+        return false;
+
+    // Each thread needs its own copy of the solver. Copies are cached and recreated only if the solver was replaced
+    // (the island problems are passed to ChSolver::Setup before each solve).
+    if (island_solvers_source != solver) {
+        island_solvers.clear();
+        island_solvers_source = solver;
+    }
+    if (island_solvers.empty()) {
+        island_solvers.emplace_back(solver->Clone());
+        if (!island_solvers[0]) {
+            island_solvers.clear();
+            return false;
+        }
+    }
+
+    if (!islands.Build(*descriptor))
+        return false;
+
+    if (islands.GetNumIslands() < 2) {
+        descriptor->UpdateCountsAndOffsets();
+        return false;
+    }
+
+    int nthreads = std::max(std::min(nthreads_chrono, (int)islands.GetNumIslands()), 1);
+    while ((int)island_solvers.size() < nthreads)
+        island_solvers.emplace_back(solver->Clone());
+
+    // Islands are sorted by decreasing size; solve them in this order for load balancing
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads)
+    for (int i = 0; i < (int)islands.GetNumIslands(); i++) {
+        ChSolver* island_solver = island_solvers[ChOMP::GetThreadNum()].get();
+        island_solver->Setup(islands.GetIsland(i));
+        island_solver->Solve(islands.GetIsland(i));
+    }
+
+    // Restore the global offsets of variables and constraints
+    descriptor->UpdateCountsAndOffsets();
+
+    nislands = islands.GetNumIslands();
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 //  DESCRIPTOR BOOKKEEPING
 // -----------------------------------------------------------------------------
@@ -1084,7 +1118,8 @@ bool ChSystem::StateSolveCorrection(
     // Solve the problem
     // The solution is scattered in the provided system descriptor
     timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
+    if (!SolveIslands())
+        GetSolver()->Solve(*descriptor);
     timer_ls_solve.stop();
 
     // Dv and Dl vectors  <-- sparse solver structures
@@ -1551,6 +1586,16 @@ unsigned int ChSystem::RemoveRedundantConstraints(bool remove_links, double qr_t
 //  Forward dynamics analysis
 // -----------------------------------------------------------------------------
 
+// Collect the subcycled groups in the given assembly, including those in nested assemblies.
+static void CollectSubcycledGroups(const ChAssembly& assembly, std::vector<ChSubcycledAssembly*>& groups) {
+    for (auto& item : assembly.GetOtherPhysicsItems()) {
+        if (auto group = dynamic_cast<ChSubcycledAssembly*>(item.get()))
+            groups.push_back(group);
+        else if (auto nested = dynamic_cast<ChAssembly*>(item.get()))
+            CollectSubcycledGroups(*nested, groups);
+    }
+}
+
 bool ChSystem::AdvanceDynamics() {
     CH_PROFILE("AdvanceDynamics");
 
@@ -1603,6 +1648,12 @@ bool ChSystem::AdvanceDynamics() {
         timestepper->Qc_do_clamp = false;
     }
 
+    // Record the interface states of the subcycled groups (if any)
+    std::vector<ChSubcycledAssembly*> subcycled;
+    CollectSubcycledGroups(assembly, subcycled);
+    for (auto group : subcycled)
+        group->BeginStep();
+
     // Advance system state by one step
     {
         CH_PROFILE("Advance");
@@ -1611,6 +1662,10 @@ bool ChSystem::AdvanceDynamics() {
         timer_advance.stop();
     }
 
+    // Advance the subcycled groups over the same step
+    for (auto group : subcycled)
+        group->Subcycle(step);
+
     // Executes custom processing at the end of step
     CustomEndOfStep();
 
@@ -31,6 +31,7 @@
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChIslands.h"
 #include "chrono/solver/ChSolver.h"
 #include "chrono/solver/ChIterativeSolver.h"
 #include "chrono/timestepper/ChAssemblyAnalysis.h"
@@ -477,6 +478,22 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool IsSleepingAllowed() const { return use_sleeping; }
 
+    /// Enable/disable solving independent islands concurrently (default: false).
+    /// If enabled, the problem passed to the solver is partitioned into islands of variables which are not coupled by
+    /// constraints or stiffness blocks (see ChIslands). The islands are solved in parallel, using the number of Chrono
+    /// threads (see SetNumThreads), each with a copy of the current solver. The problem is solved globally if the solver
+    /// cannot be copied (see ChSolver::Clone) or if there is a single island. Note that solver statistics (e.g., the
+    /// number of iterations) are not available for island solves.
+    /// The solver copies are reused across steps as long as the system solver is not replaced (see SetSolver); settings
+    /// of the system solver changed afterwards are picked up only after calling this function again.
+    void EnableIslandSolving(bool val);
+
+    /// Tell if independent islands are solved concurrently.
+    bool IsIslandSolvingEnabled() const { return use_islands; }
+
+    /// Get the number of islands in the last solver call (1 if the problem was solved globally).
+    unsigned int GetNumIslands() const { return nislands; }
+
     /// Get the visual system to which this ChSystem is attached (if any).
     ChVisualSystem* GetVisualSystem() const { return visual_system; }
 
@@ -785,11 +802,17 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     virtual ChVector3d GetBodyAppliedTorque(ChBody* body);
 
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
+    /// Bodies are grouped in islands, connected through links and contacts (fixed bodies do not connect islands).
+    /// An island is put to sleep when all its bodies have come to rest; otherwise, all its bodies are awakened.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case also performs Setup()
     /// since the system changed.
     bool ManageSleepingBodies();
 
+    /// Solve the current problem in the system descriptor by independent islands, if enabled and possible.
+    /// Returns false if the problem must be solved globally.
+    bool SolveIslands();
+
     /// Performs a single dynamics simulation step, advancing the system state by the current step size.
     virtual bool AdvanceDynamics();
 
@@ -813,6 +836,13 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    bool use_islands;       ///< if true, solve independent islands concurrently
+    unsigned int nislands;  ///< number of islands in the last solver call
+    ChIslands islands;      ///< partition of the system descriptor in islands
+
+    std::vector<std::unique_ptr<ChSolver>> island_solvers;  ///< cached copies of the solver, one per thread
+    std::shared_ptr<ChSolver> island_solvers_source;         ///< solver from which the cached copies were made
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
 
@@ -138,6 +138,10 @@ class ChApi ChSystemSMC : public ChSystem {
             ChContactable* objA,                       ///< pointer to contactable obj1
             ChContactable* objB                        ///< pointer to contactable obj2
         ) const = 0;
+
+        /// Return true if CalculateForceTorque can be called concurrently for different contacts.
+        /// Otherwise (default), the SMC contact forces are evaluated sequentially, even with multiple Chrono threads.
+        virtual bool IsThreadSafe() const { return false; }
     };
 
     /// Change the default SMC contact force calculation (and torque, too, if needed).
@@ -21,6 +21,8 @@
 
 namespace chrono {
 
+class ChVariables;
+
 /// Base class for representing constraints (bilateral or unilateral).
 /// These constraints are used with variational inequality or DAE solvers for problems including equalities,
 /// inequalities, nonlinearities, etc.
@@ -226,6 +228,12 @@ class ChApi ChConstraint {
                                              unsigned int start_row,
                                              unsigned int start_col) const = 0;
 
+    /// Append to the given list the ChVariables objects referenced by this constraint.
+    /// This connectivity information is used by solvers which need to know which constraints share variables (e.g., for
+    /// graph coloring in parallel sweeps). The default implementation appends nothing, in which case the constraint is
+    /// assumed to possibly interact with all others.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const {}
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(unsigned int off) { offset = off; }
 
@@ -12,6 +12,7 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <iomanip>
 
 #include "chrono/core/ChSparsityPatternLearner.h"
@@ -26,6 +27,7 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_reuse_symbolic(true),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -33,11 +35,17 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_analysis_call(0),
+      m_direct_krm(false),
+      m_krm_threads(1),
+      m_used_krm_map(false) {}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
     m_timer_setup_solvercall.reset();
+    m_timer_setup_analysis.reset();
+    m_timer_setup_factorization.reset();
     m_timer_solve_assembly.reset();
     m_timer_solve_solvercall.reset();
 }
@@ -80,21 +88,35 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.BuildSystemMatrix(&m_mat, nullptr);
+    // With a locked pattern and an unchanged matrix structure, the KRM blocks can be added directly into the values of
+    // the compressed matrix, at cached positions. The positions are (re)computed after a regular assembly.
+    bool direct_krm = m_direct_krm && m_lock && !call_learner && !call_reserve && m_mat.rows() == m_dim;
+    m_used_krm_map = direct_krm && m_krm_map.IsValid(sysd, m_mat);
+
+    if (m_used_krm_map) {
+        sysd.BuildSystemMatrix(m_mat, m_krm_map, m_krm_threads);
+    } else {
+        // Let the system descriptor load the current matrix
+        sysd.BuildSystemMatrix(&m_mat, nullptr);
+    }
 
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
 
+    if (!m_used_krm_map) {
+        if (m_direct_krm && m_lock)
+            m_krm_map.Build(sysd, m_mat);
+        else
+            m_krm_map.Clear();
+    }
+
     m_timer_setup_assembly.stop();
 
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_A.dat", m_mat);
 
     // Let the concrete solver perform the facorization
-    m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
-    m_timer_setup_solvercall.stop();
+    bool result = AnalyzeAndFactorize();
 
     if (write_matrix)
         WriteMatrix("LS_" + frame_id + "_F.dat", m_mat);
@@ -103,8 +125,8 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         std::cout << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
                   << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << "  analyze:           " << m_timer_setup_analysis.GetTimeSeconds() << "s\n"
+                  << "  factorize:         " << m_timer_setup_factorization.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -168,16 +190,14 @@ bool ChDirectSolverLS::SetupCurrent() {
     m_timer_setup_assembly.stop();
 
     // Let the concrete solver perform the factorization
-    m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
-    m_timer_setup_solvercall.stop();
+    bool result = AnalyzeAndFactorize();
 
     if (verbose) {
         std::cout << " Solver SetupCurrent() [" << m_setup_call << "] n = " << m_dim
                   << "  nnz = " << (int)m_mat.nonZeros() << std::endl;
         std::cout << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSeconds() << "s\n"
-                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSeconds() << "s"
-                  << std::endl;
+                  << "  analyze:           " << m_timer_setup_analysis.GetTimeSeconds() << "s\n"
+                  << "  factorize:         " << m_timer_setup_factorization.GetTimeSeconds() << "s" << std::endl;
     }
 
     m_setup_call++;
@@ -222,6 +242,47 @@ double ChDirectSolverLS::SolveCurrent() {
 
 // ---------------------------------------------------------------------------
 
+bool ChDirectSolverLS::AnalyzeAndFactorize() {
+    m_timer_setup_solvercall.start();
+
+    // The symbolic analysis can be reused only if the sparsity pattern is locked and did not actually change
+    bool analyze = !SupportsSymbolicReuse() || !m_reuse_symbolic || !m_lock || PatternChanged();
+
+    bool result = true;
+    if (analyze) {
+        m_timer_setup_analysis.start();
+        result = AnalyzeMatrix();
+        m_timer_setup_analysis.stop();
+        m_analysis_call++;
+
+        // Cache the pattern of the analyzed matrix (discard it if the analysis failed)
+        m_pattern_outer.clear();
+        m_pattern_inner.clear();
+        if (result && SupportsSymbolicReuse()) {
+            m_pattern_outer.assign(m_mat.outerIndexPtr(), m_mat.outerIndexPtr() + m_mat.outerSize() + 1);
+            m_pattern_inner.assign(m_mat.innerIndexPtr(), m_mat.innerIndexPtr() + m_mat.nonZeros());
+        }
+    }
+
+    if (result) {
+        m_timer_setup_factorization.start();
+        result = FactorizeMatrix();
+        m_timer_setup_factorization.stop();
+    }
+
+    m_timer_setup_solvercall.stop();
+
+    return result;
+}
+
+bool ChDirectSolverLS::PatternChanged() const {
+    // The matrix is always compressed before factorization
+    if (m_pattern_outer.size() != (size_t)m_mat.outerSize() + 1 || m_pattern_inner.size() != (size_t)m_mat.nonZeros())
+        return true;
+    return !std::equal(m_pattern_outer.begin(), m_pattern_outer.end(), m_mat.outerIndexPtr()) ||
+           !std::equal(m_pattern_inner.begin(), m_pattern_inner.end(), m_mat.innerIndexPtr());
+}
+
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
     std::ofstream file(filename);
     file << std::setprecision(12) << std::scientific;
@@ -274,8 +335,13 @@ void ChDirectSolverLS::ArchiveIn(ChArchiveIn& archive_in) {
 
 // ---------------------------------------------------------------------------
 
+bool ChSolverSparseLU::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -303,8 +369,13 @@ void ChSolverSparseLU::PrintErrorMessage() {
 
 // ---------------------------------------------------------------------------
 
+bool ChSolverSparseQR::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return true;
+}
+
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -18,6 +18,10 @@
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
+#include "chrono/solver/ChKRMSlotMap.h"
+
+#include <algorithm>
+#include <vector>
 
 #include <Eigen/SparseLU>
 
@@ -56,6 +60,16 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+With a locked sparsity pattern, concrete solvers which separate the symbolic analysis (e.g., fill-reducing ordering and
+elimination tree) from the numeric factorization reuse the symbolic analysis from call to call and only refactorize the
+matrix. The analysis is redone if the matrix pattern does change.\n
+See #EnableSymbolicFactorizationReuse();
+
+With a locked sparsity pattern, the KRM blocks (e.g., FEA element stiffness and damping matrices) can also be assembled
+directly into the values of the compressed matrix, at positions cached on the first call to Setup. KRM blocks which do
+not share variables are then pasted concurrently.\n
+See #EnableDirectKRMAssembly();
+
 <br>
 
 <div class="ce-warning">
@@ -83,10 +97,29 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// Enable this option whenever possible to improve performance.
     void LockSparsityPattern(bool val) { m_lock = val; }
 
+    /// Enable/disable reuse of the symbolic factorization (default: true).\n
+    /// If enabled and the sparsity pattern is locked, the symbolic analysis of the matrix is performed only when the
+    /// matrix pattern changes; otherwise, Setup only performs a numeric factorization. This option has no effect for
+    /// concrete solvers that do not separate the two phases.
+    void EnableSymbolicFactorizationReuse(bool val) { m_reuse_symbolic = val; }
+
     /// Enable/disable use of the sparsity pattern learner (default: enabled).\n
     /// Disable for smaller problems where the overhead may be too large.
     void UseSparsityPatternLearner(bool val) { m_use_learner = val; }
 
+    /// Enable/disable direct assembly of the KRM blocks in the locked matrix pattern (default: false).\n
+    /// If enabled and the sparsity pattern is locked, the positions of the KRM block entries in the compressed matrix
+    /// are cached (see ChKRMSlotMap) and the KRM blocks are added directly into the matrix values, using the specified
+    /// number of OpenMP threads. The cached positions are rebuilt whenever the KRM blocks, their variables, or the
+    /// matrix pattern change.
+    void EnableDirectKRMAssembly(bool val, int num_threads = 1) {
+        m_direct_krm = val;
+        m_krm_threads = std::max(1, num_threads);
+    }
+
+    /// Return true if the KRM blocks were assembled through the cached positions at the last call to Setup.
+    bool UsedDirectKRMAssembly() const { return m_used_krm_map; }
+
     /// Force a call to the sparsity pattern learner to update sparsity pattern on the underlying matrix.\n
     /// Such a call may be needed in a situation where the sparsity pattern is locked, but a change in the problem size
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
@@ -122,11 +155,19 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     double GetTimeSetup_Assembly() const { return m_timer_setup_assembly(); }
     /// Get cumulative time for Pardiso calls in Setup phase.
     double GetTimeSetup_SolverCall() const { return m_timer_setup_solvercall(); }
+    /// Get cumulative time for symbolic analysis in Setup phase (included in GetTimeSetup_SolverCall).
+    double GetTimeSetup_SolverAnalysis() const { return m_timer_setup_analysis(); }
+    /// Get cumulative time for numeric factorization in Setup phase (included in GetTimeSetup_SolverCall).
+    /// For concrete solvers which do not separate symbolic analysis and numeric factorization, this is the entire
+    /// solver call time.
+    double GetTimeSetup_SolverFactorization() const { return m_timer_setup_factorization(); }
 
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     unsigned int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses performed during calls to the solver's Setup function.
+    unsigned int GetNumAnalysisCalls() const { return m_analysis_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -176,7 +217,17 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     virtual bool IsDirect() const override { return true; }
     virtual ChDirectSolverLS* AsDirect() override { return this; }
 
+    /// Indicate whether the concrete solver separates symbolic analysis (AnalyzeMatrix) and numeric factorization
+    /// (FactorizeMatrix). By default, FactorizeMatrix is assumed to perform both phases.
+    virtual bool SupportsSymbolicReuse() const { return false; }
+
+    /// Perform the symbolic analysis of the current sparse matrix and return true if successful.
+    /// Only relevant for concrete solvers which support reuse of the symbolic factorization.
+    virtual bool AnalyzeMatrix() { return true; }
+
     /// Factorize the current sparse matrix and return true if successful.
+    /// For concrete solvers which support reuse of the symbolic factorization, this performs only the numeric
+    /// factorization, using the result of the last call to AnalyzeMatrix.
     virtual bool FactorizeMatrix() = 0;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -198,23 +249,41 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChVectorDynamic<double> m_rhs;  ///< right-hand side vector
     ChVectorDynamic<double> m_sol;  ///< solution vector
 
-    unsigned int m_solve_call;  ///< counter for calls to Solve
-    unsigned int m_setup_call;  ///< counter for calls to Setup
+    unsigned int m_solve_call;     ///< counter for calls to Solve
+    unsigned int m_setup_call;     ///< counter for calls to Setup
+    unsigned int m_analysis_call;  ///< counter for symbolic analyses
 
-    bool m_lock;          ///< is the matrix sparsity pattern locked?
-    bool m_use_learner;   ///< use the sparsity pattern learner?
-    bool m_force_update;  ///< force a call to the sparsity pattern learner?
+    bool m_lock;            ///< is the matrix sparsity pattern locked?
+    bool m_use_learner;     ///< use the sparsity pattern learner?
+    bool m_force_update;    ///< force a call to the sparsity pattern learner?
+    bool m_reuse_symbolic;  ///< reuse symbolic factorization if pattern locked?
 
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
-    ChTimer m_timer_setup_assembly;    ///< timer for matrix assembly
-    ChTimer m_timer_setup_solvercall;  ///< timer for factorization
-    ChTimer m_timer_solve_assembly;    ///< timer for RHS assembly
-    ChTimer m_timer_solve_solvercall;  ///< timer for solution
+    ChTimer m_timer_setup_assembly;       ///< timer for matrix assembly
+    ChTimer m_timer_setup_solvercall;     ///< timer for factorization
+    ChTimer m_timer_setup_analysis;       ///< timer for symbolic analysis
+    ChTimer m_timer_setup_factorization;  ///< timer for numeric factorization
+    ChTimer m_timer_solve_assembly;       ///< timer for RHS assembly
+    ChTimer m_timer_solve_solvercall;     ///< timer for solution
 
   private:
+    /// Perform the symbolic analysis (if needed) and the numeric factorization of the current matrix.
+    bool AnalyzeAndFactorize();
+
+    /// Check whether the current matrix pattern differs from that at the last symbolic analysis.
+    bool PatternChanged() const;
+
+    std::vector<int> m_pattern_outer;  ///< outer indices of the matrix at the last symbolic analysis
+    std::vector<int> m_pattern_inner;  ///< inner indices of the matrix at the last symbolic analysis
+
+    bool m_direct_krm;       ///< assemble KRM blocks directly in the locked pattern?
+    int m_krm_threads;       ///< number of OpenMP threads for direct KRM assembly
+    bool m_used_krm_map;     ///< were KRM blocks assembled through the slot map at the last Setup?
+    ChKRMSlotMap m_krm_map;  ///< positions of the KRM block entries in the compressed matrix
+
     void WriteMatrix(const std::string& filename, const ChSparseMatrix& M);
     void WriteVector(const std::string& filename, const ChVectorDynamic<double>& v);
 };
@@ -232,7 +301,13 @@ class ChApi ChSolverSparseLU : public ChDirectSolverLS {
     virtual Type GetType() const override { return Type::SPARSE_LU; }
 
   private:
-    /// Factorize the current sparse matrix and return true if successful.
+    /// The Eigen solver separates symbolic analysis and numeric factorization.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+
+    /// Perform the symbolic analysis (fill-reducing ordering) of the current sparse matrix.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -257,7 +332,13 @@ class ChApi ChSolverSparseQR : public ChDirectSolverLS {
     virtual Type GetType() const override { return Type::SPARSE_QR; }
 
   private:
-    /// Factorize the current sparse matrix and return true if successful.
+    /// The Eigen solver separates symbolic analysis and numeric factorization.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+
+    /// Perform the symbolic analysis (fill-reducing ordering) of the current sparse matrix.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChIslands.h"
+
+namespace chrono {
+
+// Variables which can couple constraints (active and with at least one degree of freedom).
+// Such variables are identified by their offset in the global vector of unknowns.
+static inline bool IsCoupling(const ChVariables* var) {
+    return var->IsActive() && var->GetDOF() > 0;
+}
+
+bool ChIslands::Build(ChSystemDescriptor& sysd) {
+    m_num_islands = 0;
+
+    auto& variables = sysd.GetVariables();
+    auto& constraints = sysd.GetConstraints();
+    auto& KRMblocks = sysd.GetKRMBlocks();
+
+    // Make sure the offsets of variables are the global ones
+    sysd.UpdateCountsAndOffsets();
+    int n_q = (int)sysd.CountActiveVariables();
+    if (n_q == 0)
+        return false;
+
+    m_sets.Reset(n_q);
+
+    // Merge the sets of variables coupled by active constraints
+    for (auto constr : constraints) {
+        if (!constr->IsActive())
+            continue;
+        m_vars.clear();
+        constr->AppendVariables(m_vars);
+        if (m_vars.empty())
+            return false;
+        int root = -1;
+        for (auto var : m_vars) {
+            if (IsCoupling(var))
+                root = (root < 0) ? (int)var->GetOffset() : m_sets.Union(root, var->GetOffset());
+        }
+    }
+
+    // Merge the sets of variables coupled by KRM blocks
+    for (auto block : KRMblocks) {
+        int root = -1;
+        for (unsigned int m = 0; m < block->GetNumVariables(); m++) {
+            auto var = block->GetVariable(m);
+            if (IsCoupling(var))
+                root = (root < 0) ? (int)var->GetOffset() : m_sets.Union(root, var->GetOffset());
+        }
+    }
+
+    // Collect the sets (indexed by their representative) and their number of scalar variables
+    std::vector<int> island_of(n_q, -1);
+    std::vector<std::pair<unsigned int, int>> sizes;  // (number of scalar variables, representative)
+    for (auto var : variables) {
+        if (!IsCoupling(var))
+            continue;
+        int root = m_sets.Find(var->GetOffset());
+        if (island_of[root] < 0) {
+            island_of[root] = (int)sizes.size();
+            sizes.push_back({0, root});
+        }
+        sizes[island_of[root]].first += var->GetDOF();
+    }
+
+    // Number the islands by decreasing size (for better load balancing when solving them concurrently)
+    std::stable_sort(sizes.begin(), sizes.end(),
+                     [](const std::pair<unsigned int, int>& a, const std::pair<unsigned int, int>& b) {
+                         return a.first > b.first;
+                     });
+    for (int i = 0; i < (int)sizes.size(); i++)
+        island_of[sizes[i].second] = i;
+
+    m_num_islands = (unsigned int)sizes.size();
+    while (m_islands.size() < m_num_islands)
+        m_islands.push_back(std::unique_ptr<ChSystemDescriptor>(new ChSystemDescriptor));
+
+    for (unsigned int i = 0; i < m_num_islands; i++) {
+        m_islands[i]->BeginInsertion();
+        m_islands[i]->SetMassFactor(sysd.GetMassFactor());
+    }
+
+    // Distribute the items, preserving their order in the global descriptor (so that, for example, the constraints of
+    // a friction contact remain consecutive)
+    for (auto var : variables) {
+        if (IsCoupling(var))
+            m_islands[island_of[m_sets.Find(var->GetOffset())]]->InsertVariables(var);
+    }
+
+    for (auto constr : constraints) {
+        // constraints which do not couple any variable do not affect the solution; keep them in the first island
+        int island = 0;
+        m_vars.clear();
+        constr->AppendVariables(m_vars);
+        for (auto var : m_vars) {
+            if (IsCoupling(var)) {
+                island = island_of[m_sets.Find(var->GetOffset())];
+                break;
+            }
+        }
+        m_islands[island]->InsertConstraint(constr);
+    }
+
+    for (auto block : KRMblocks) {
+        for (unsigned int m = 0; m < block->GetNumVariables(); m++) {
+            auto var = block->GetVariable(m);
+            if (IsCoupling(var)) {
+                m_islands[island_of[m_sets.Find(var->GetOffset())]]->InsertKRMBlock(block);
+                break;
+            }
+        }
+    }
+
+    // Set the island-local offsets of variables and constraints
+    for (unsigned int i = 0; i < m_num_islands; i++)
+        m_islands[i]->EndInsertion();
+
+    return true;
+}
+
+}  // end namespace chrono
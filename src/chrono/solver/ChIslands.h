@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_ISLANDS_H
+#define CH_ISLANDS_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/utils/ChDisjointSets.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Partition of a system descriptor in independent islands.
+/// Two active variables belong to the same island if they are coupled, directly or through other variables, by
+/// constraints or KRM blocks. Inactive variables (e.g., those of fixed or sleeping bodies) do not couple islands.
+/// Each island is described by a separate system descriptor which references the variables, constraints, and KRM
+/// blocks of the partitioned descriptor; islands can therefore be solved independently (and concurrently).
+///
+/// Note that building the island descriptors overwrites the offsets of variables and constraints. Call
+/// ChSystemDescriptor::UpdateCountsAndOffsets on the partitioned descriptor to restore the global offsets.
+class ChApi ChIslands {
+  public:
+    ChIslands() {}
+
+    /// Partition the given system descriptor.
+    /// Return false if the descriptor cannot be partitioned, because it contains active constraints that do not
+    /// report their variables (see ChConstraint::AppendVariables). In that case, no islands are built.
+    bool Build(ChSystemDescriptor& sysd);
+
+    /// Get the number of islands found by the last call to Build.
+    unsigned int GetNumIslands() const { return m_num_islands; }
+
+    /// Access the descriptor of the i-th island.
+    /// Islands are sorted by decreasing number of scalar variables.
+    ChSystemDescriptor& GetIsland(unsigned int i) { return *m_islands[i]; }
+
+  private:
+    std::vector<std::unique_ptr<ChSystemDescriptor>> m_islands;  ///< island descriptors (some may be unused)
+    unsigned int m_num_islands = 0;                              ///< number of islands
+    ChDisjointSets m_sets;                                       ///< union-find over the active variables
+    std::vector<ChVariables*> m_vars;                            ///< scratch list of constraint variables
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a diagonal or a block-diagonal preconditioner.
 //
 // Available solvers:
 //   GMRES
@@ -80,7 +80,7 @@ class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
     chrono::ChVectorDynamic<> m_vect;    // workspace for the result of the SPMV operation
 };
 
-/// Simple diagonal preconditioner
+/// Simple diagonal preconditioner, optionally using inverse diagonal blocks (block-Jacobi) for some of the unknowns.
 class ChDiagonalPreconditioner {
     typedef double Scalar;
 
@@ -88,12 +88,18 @@ class ChDiagonalPreconditioner {
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChDiagonalPreconditioner()
+        : m_N(0), m_diag_precond(false), m_invdiag(nullptr), m_block_offsets(nullptr), m_invblocks(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
+    void Setup(Eigen::Index N,
+               const ChVectorDynamic<>& invdiag,
+               const std::vector<unsigned int>& block_offsets,
+               const std::vector<ChMatrixDynamic<>>& invblocks) {
         m_N = N;
         m_invdiag = &invdiag;
         m_diag_precond = (invdiag.size() > 0);
+        m_block_offsets = &block_offsets;
+        m_invblocks = &invblocks;
     }
 
     Eigen::Index rows() const { return m_N; }
@@ -116,6 +122,13 @@ class ChDiagonalPreconditioner {
     void _solve_impl(const Rhs& b, Dest& x) const {
         if (m_diag_precond) {
             x = m_invdiag->array() * b.array();
+            for (size_t k = 0; k < m_invblocks->size(); k++) {
+                const auto& invblock = (*m_invblocks)[k];
+                if (invblock.rows() > 0) {
+                    auto offset = (*m_block_offsets)[k];
+                    x.segment(offset, invblock.rows()) = invblock * b.segment(offset, invblock.rows());
+                }
+            }
         } else {
             x = b;
         }
@@ -132,6 +145,9 @@ class ChDiagonalPreconditioner {
     Eigen::Index m_N;                    // problem dimension
     const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
     bool m_diag_precond;                 // if false, no preconditioning
+
+    const std::vector<unsigned int>* m_block_offsets;  // pointer to offsets of diagonal blocks
+    const std::vector<ChMatrixDynamic<>>* m_invblocks;  // pointer to inverse diagonal blocks (empty if singular)
 };
 
 }  // namespace chrono
@@ -172,7 +188,7 @@ CH_FACTORY_REGISTER(ChSolverGMRES)
 CH_FACTORY_REGISTER(ChSolverBiCGSTAB)
 CH_FACTORY_REGISTER(ChSolverMINRES)
 
-ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
+ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false), m_use_block_precond(false) {
     m_spmv = new ChMatrixSPMV();
 }
 
@@ -199,6 +215,20 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
         }
     }
 
+    // If needed, evaluate the inverse diagonal blocks
+    m_block_offsets.clear();
+    m_invblocks.clear();
+    if (m_use_precond && m_use_block_precond) {
+        sysd.BuildDiagonalBlocks(m_block_offsets, m_invblocks);
+        for (auto& block : m_invblocks) {
+            Eigen::FullPivLU<ChMatrixDynamic<>> lu(block);
+            if (lu.isInvertible())
+                block = lu.inverse();
+            else
+                block.resize(0, 0);
+        }
+    }
+
     // If needed, evaluate the initial guess
     if (m_warm_start) {
         m_initguess.resize(dim);
@@ -251,7 +281,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, m_block_offsets, m_invblocks);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -296,7 +326,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, m_block_offsets, m_invblocks);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -342,7 +372,7 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, m_block_offsets, m_invblocks);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
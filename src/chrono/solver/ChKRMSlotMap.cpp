@@ -0,0 +1,232 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdint>
+
+#include "chrono/solver/ChKRMSlotMap.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+ChKRMSlotMap::ChKRMSlotMap() : m_rows(-1), m_nnz(-1) {}
+
+void ChKRMSlotMap::Clear() {
+    m_blocks.clear();
+    m_var_offsets.clear();
+    m_slot_start.clear();
+    m_slots.clear();
+    m_order.clear();
+    m_color_start.clear();
+    m_rows = -1;
+    m_nnz = -1;
+}
+
+bool ChKRMSlotMap::Build(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) {
+    Clear();
+
+    if (!Z.isCompressed())
+        return false;
+
+    const int* outer = Z.outerIndexPtr();
+    const int* inner = Z.innerIndexPtr();
+
+    auto& blocks = sysd.GetKRMBlocks();
+    m_slot_start.reserve(blocks.size() + 1);
+    m_slot_start.push_back(0);
+
+    for (const auto& block : blocks) {
+        auto n = block->GetMatrix().rows();
+
+        for (unsigned int iv = 0; iv < block->GetNumVariables(); iv++) {
+            auto var = block->GetVariable(iv);
+            m_var_offsets.push_back(var->IsActive() ? (int)var->GetOffset() : -1);
+        }
+
+        // Locate the KRM entries in the matrix, in the row-major order of the block (as in ChKRMBlock::PasteMatrixInto)
+        m_slots.resize(m_slot_start.back() + n * n, -1);
+        if (n == 0) {
+            m_slot_start.push_back(m_slots.size());
+            continue;
+        }
+        int* slots = m_slots.data() + m_slot_start.back();
+
+        unsigned int kio = 0;
+        for (unsigned int iv = 0; iv < block->GetNumVariables(); iv++) {
+            auto var_i = block->GetVariable(iv);
+            unsigned int in = var_i->GetDOF();
+
+            if (var_i->IsActive()) {
+                unsigned int kjo = 0;
+                for (unsigned int jv = 0; jv < block->GetNumVariables(); jv++) {
+                    auto var_j = block->GetVariable(jv);
+                    unsigned int jn = var_j->GetDOF();
+
+                    if (var_j->IsActive()) {
+                        for (unsigned int i = 0; i < in; i++) {
+                            int row = (int)(var_i->GetOffset() + i);
+                            if (row >= Z.rows()) {
+                                Clear();
+                                return false;
+                            }
+                            const int* row_begin = inner + outer[row];
+                            const int* row_end = inner + outer[row + 1];
+                            for (unsigned int j = 0; j < jn; j++) {
+                                int col = (int)(var_j->GetOffset() + j);
+                                const int* pos = std::lower_bound(row_begin, row_end, col);
+                                if (pos == row_end || *pos != col) {
+                                    Clear();
+                                    return false;
+                                }
+                                slots[(kio + i) * n + kjo + j] = (int)(pos - inner);
+                            }
+                        }
+                    }
+
+                    kjo += jn;
+                }
+            }
+
+            kio += in;
+        }
+
+        m_slot_start.push_back(m_slots.size());
+    }
+
+    m_blocks = blocks;
+    m_rows = (int)Z.rows();
+    m_nnz = (int)Z.nonZeros();
+
+    ColorBlocks(sysd.CountActiveVariables());
+
+    return true;
+}
+
+bool ChKRMSlotMap::IsValid(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) const {
+    if (m_rows < 0 || !Z.isCompressed() || Z.rows() != m_rows || Z.nonZeros() != m_nnz)
+        return false;
+
+    auto& blocks = sysd.GetKRMBlocks();
+    if (blocks != m_blocks)
+        return false;
+
+    size_t k = 0;
+    for (size_t ib = 0; ib < blocks.size(); ib++) {
+        auto n = (size_t)blocks[ib]->GetMatrix().rows();
+        if (n * n != m_slot_start[ib + 1] - m_slot_start[ib])
+            return false;
+
+        for (unsigned int iv = 0; iv < blocks[ib]->GetNumVariables(); iv++) {
+            auto var = blocks[ib]->GetVariable(iv);
+            if (k >= m_var_offsets.size() || m_var_offsets[k++] != (var->IsActive() ? (int)var->GetOffset() : -1))
+                return false;
+        }
+    }
+
+    return k == m_var_offsets.size();
+}
+
+void ChKRMSlotMap::ColorBlocks(unsigned int n_q) {
+    const int max_colors = 64;
+
+    // Bitmask of the colors already used by blocks acting on each active variable (indexed by variable offset).
+    std::vector<uint64_t> var_colors(n_q, 0);
+
+    // Greedy coloring of the blocks, in descriptor order (color -1 for blocks which cannot be colored).
+    // Blocks without active variables have no entries in the matrix and are skipped.
+    std::vector<unsigned int> block_index;
+    std::vector<int> block_color;
+    std::vector<unsigned int> color_count(max_colors + 1, 0);
+
+    for (unsigned int ib = 0; ib < (unsigned int)m_blocks.size(); ib++) {
+        auto block = m_blocks[ib];
+
+        uint64_t used = 0;
+        bool active = false;
+        for (unsigned int iv = 0; iv < block->GetNumVariables(); iv++) {
+            auto var = block->GetVariable(iv);
+            if (var->IsActive()) {
+                used |= var_colors[var->GetOffset()];
+                active = true;
+            }
+        }
+        if (!active)
+            continue;
+
+        int color = -1;
+        if (used != ~uint64_t(0)) {
+            color = 0;
+            while (used & (uint64_t(1) << color))
+                color++;
+            for (unsigned int iv = 0; iv < block->GetNumVariables(); iv++) {
+                auto var = block->GetVariable(iv);
+                if (var->IsActive())
+                    var_colors[var->GetOffset()] |= (uint64_t(1) << color);
+            }
+        }
+
+        block_index.push_back(ib);
+        block_color.push_back(color);
+        color_count[color < 0 ? max_colors : color]++;
+    }
+
+    // Sort blocks by color (stable, so that the descriptor order is preserved within each color).
+    int num_colors = 0;
+    while (num_colors < max_colors && color_count[num_colors] > 0)
+        num_colors++;
+
+    m_color_start.assign(num_colors + 1, 0);
+    for (int color = 0; color < num_colors; color++)
+        m_color_start[color + 1] = m_color_start[color] + color_count[color];
+
+    std::vector<unsigned int> next(m_color_start.begin(), m_color_start.end());
+    m_order.resize(block_index.size());
+    for (size_t k = 0; k < block_index.size(); k++) {
+        int color = block_color[k];
+        m_order[next[color < 0 ? num_colors : color]++] = block_index[k];
+    }
+}
+
+void ChKRMSlotMap::PasteBlock(unsigned int ib, double* values) const {
+    auto K = m_blocks[ib]->GetMatrix();
+    const int* slots = m_slots.data() + m_slot_start[ib];
+    auto n = K.rows();
+
+    for (Eigen::Index i = 0; i < n; i++) {
+        for (Eigen::Index j = 0; j < n; j++) {
+            int slot = slots[i * n + j];
+            if (slot >= 0)
+                values[slot] += K(i, j);
+        }
+    }
+}
+
+void ChKRMSlotMap::PasteMatrixInto(ChSparseMatrix& Z, int num_threads) const {
+    double* values = Z.valuePtr();
+
+    // Blocks of the same color do not share any active variable and write to disjoint matrix entries.
+    int num_colors = GetNumColors();
+    for (int color = 0; color < num_colors; color++) {
+        int start = (int)m_color_start[color];
+        int end = (int)m_color_start[color + 1];
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int k = start; k < end; k++)
+            PasteBlock(m_order[k], values);
+    }
+
+    // Blocks which could not be colored are pasted sequentially.
+    for (size_t k = m_color_start.empty() ? 0 : m_color_start.back(); k < m_order.size(); k++)
+        PasteBlock(m_order[k], values);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,82 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_KRM_SLOT_MAP_H
+#define CH_KRM_SLOT_MAP_H
+
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/solver/ChKRMBlock.h"
+
+namespace chrono {
+
+class ChSystemDescriptor;
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Map from the entries of the KRM blocks of a system descriptor to the nonzeros of a compressed sparse matrix.
+///
+/// With a locked sparsity pattern, the position of each KRM block entry in the value array of the system matrix does
+/// not change from call to call. This map caches these positions, so that the KRM blocks can be added directly into
+/// the matrix values, without searching for the matrix entries. KRM blocks are also colored, such that blocks with the
+/// same color do not share any active variable; blocks of the same color write to disjoint matrix entries and are
+/// pasted concurrently.
+///
+/// The map must be rebuilt if the set of KRM blocks, their variables, or the matrix sparsity pattern change (see
+/// IsValid).
+class ChApi ChKRMSlotMap {
+  public:
+    ChKRMSlotMap();
+
+    /// Build the map for the KRM blocks of the given descriptor and the sparsity pattern of the given matrix.
+    /// The matrix must be compressed and its pattern must include all KRM block entries of active variables (as is
+    /// the case after a call to ChSystemDescriptor::BuildSystemMatrix). Returns false (and clears the map) otherwise.
+    bool Build(ChSystemDescriptor& sysd, const ChSparseMatrix& Z);
+
+    /// Check whether the map is consistent with the KRM blocks of the given descriptor and with the given matrix.
+    bool IsValid(ChSystemDescriptor& sysd, const ChSparseMatrix& Z) const;
+
+    /// Clear the map.
+    void Clear();
+
+    /// Add the KRM blocks into the values of the given matrix, using the cached positions.
+    /// The matrix must have the same sparsity pattern used to build the map.
+    void PasteMatrixInto(ChSparseMatrix& Z, int num_threads = 1) const;
+
+    /// Return the number of colors used to partition the KRM blocks (0 if the map is not built).
+    int GetNumColors() const { return m_color_start.empty() ? 0 : (int)m_color_start.size() - 1; }
+
+  private:
+    /// Add the given KRM block into the matrix values.
+    void PasteBlock(unsigned int ib, double* values) const;
+
+    /// Greedy coloring of the KRM blocks with at least one active variable.
+    void ColorBlocks(unsigned int n_q);
+
+    std::vector<ChKRMBlock*> m_blocks;        ///< KRM blocks of the descriptor at the time the map was built
+    std::vector<int> m_var_offsets;           ///< offsets of the block variables (-1 if inactive), for validation
+    std::vector<size_t> m_slot_start;         ///< start of each KRM block in m_slots
+    std::vector<int> m_slots;                 ///< position in matrix values of each KRM entry (-1 if not assembled)
+    std::vector<unsigned int> m_order;        ///< KRM block indices, sorted by color
+    std::vector<unsigned int> m_color_start;  ///< start of each color in m_order (uncolored blocks at the end)
+    int m_rows;                               ///< number of matrix rows
+    int m_nnz;                                ///< number of matrix nonzeros
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -62,6 +62,11 @@ class ChApi ChSolver {
     /// Return type of the solver.
     virtual Type GetType() const { return Type::CUSTOM; }
 
+    /// "Virtual" copy constructor.
+    /// A solver which supports copying returns a new object with the same settings. This is required for solving
+    /// independent islands concurrently (see ChSystem::EnableIslandSolving). The default implementation returns nullptr.
+    virtual ChSolver* Clone() const { return nullptr; }
+
     /// Return true if iterative solver.
     virtual bool IsIterative() const = 0;
 
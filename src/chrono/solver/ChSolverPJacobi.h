@@ -35,6 +35,9 @@ class ChApi ChSolverPJacobi : public ChIterativeSolverVI {
 
     virtual Type GetType() const override { return Type::PJACOBI; }
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPJacobi* Clone() const override { return new ChSolverPJacobi(*this); }
+
     /// Performs the solution of the problem.
     /// \return  the maximum constraint violation after termination.
     virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
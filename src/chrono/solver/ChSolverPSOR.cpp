@@ -12,8 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <cstdint>
+
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/utils/ChConstants.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -21,7 +24,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChSolverPSOR)
 CH_UPCASTING(ChSolverPSOR, ChIterativeSolverVI)
 
-ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
+ChSolverPSOR::ChSolverPSOR() : maxviolation(0), m_coloring(false), m_num_threads(1) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
@@ -30,8 +33,6 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     m_iterations = 0;
     maxviolation = 0;
     double maxdeltalambda = 0.;
-    int i_friction_comp = 0;
-    double old_lambda_friction[3];
 
     // 1)  Update auxiliary data in all constraints before starting,
     //     that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
@@ -82,119 +83,66 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     std::fill(violation_history.begin(), violation_history.end(), 0.0);
     std::fill(dlambda_history.begin(), dlambda_history.end(), 0.0);
 
+    if (m_coloring) {
+        ColorBlocks(sysd);
+    } else {
+        m_blocks.clear();
+        m_color_start.clear();
+    }
+
+    std::vector<double> thread_maxviolation(m_num_threads);
+    std::vector<double> thread_maxdeltalambda(m_num_threads);
+
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // The iteration on all constraints
         //
 
         maxviolation = 0;
         maxdeltalambda = 0;
-        i_friction_comp = 0;
-
-        for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
-            // skip computations if constraint not active.
-            if (mconstraints[ic]->IsActive()) {
-                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                double mresidual = mconstraints[ic]->ComputeJacobianTimesState() + mconstraints[ic]->GetRightHandSide() +
-                                   mconstraints[ic]->GetComplianceTerm() * mconstraints[ic]->GetLagrangeMultiplier();
-
-                // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
-
-                // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                double deltal = (m_omega / mconstraints[ic]->GetSchurComplement()) * (-mresidual);
-
-                if (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) {
-                    candidate_violation = 0;
-
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[i_friction_comp] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[i_friction_comp] + deltal);
-                    i_friction_comp++;
-
-                    if (i_friction_comp == 1)
-                        candidate_violation = fabs(std::min(0.0, mresidual));
-
-                    if (i_friction_comp == 3) {
-                        mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
-                        double new_lambda_0 = mconstraints[ic - 2]->GetLagrangeMultiplier();
-                        double new_lambda_1 = mconstraints[ic - 1]->GetLagrangeMultiplier();
-                        double new_lambda_2 = mconstraints[ic - 0]->GetLagrangeMultiplier();
-                        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                        if (m_shlambda != 1.0) {
-                            new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                            new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
-                            new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
-                            mconstraints[ic - 2]->SetLagrangeMultiplier(new_lambda_0);
-                            mconstraints[ic - 1]->SetLagrangeMultiplier(new_lambda_1);
-                            mconstraints[ic - 0]->SetLagrangeMultiplier(new_lambda_2);
-                        }
-                        double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                        double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
-                        double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                        mconstraints[ic - 2]->IncrementState(true_delta_0);
-                        mconstraints[ic - 1]->IncrementState(true_delta_1);
-                        mconstraints[ic - 0]->IncrementState(true_delta_2);
-
-                        if (this->record_violation_history) {
-                            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
-                            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_1));
-                            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_2));
-                        }
-                        i_friction_comp = 0;
-                    }
-                } else if (mconstraints[ic]->GetMode() == ChConstraint::Mode::UNILATERAL) {
-                    // update:   lambda += delta_lambda;
-                    old_lambda_friction[0] = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda_friction[0] + deltal);
-
-                    candidate_violation = fabs(std::min(0.0, mresidual));
-                    mconstraints[ic]->Project();
-                    double new_lambda_0 = mconstraints[ic]->GetLagrangeMultiplier();
-                    if (m_shlambda != 1.0) {
-                        new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda_0);
-                    }
-
-                    double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                    mconstraints[ic]->IncrementState(true_delta_0);
-
-                    if (this->record_violation_history) {
-                        maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
-                    }
-
-                } else {
-                    // update:   lambda += delta_lambda;
-                    double old_lambda = mconstraints[ic]->GetLagrangeMultiplier();
-                    mconstraints[ic]->SetLagrangeMultiplier(old_lambda + deltal);
-
-                    // If new lagrangian multiplier does not satisfy inequalities, project
-                    // it into an admissible orthant (or, in general, onto an admissible set)
-                    mconstraints[ic]->Project();
-
-                    // After projection, the lambda may have changed a bit..
-                    double new_lambda = mconstraints[ic]->GetLagrangeMultiplier();
-
-                    // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                    if (m_shlambda != 1.0) {
-                        new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
-                        mconstraints[ic]->SetLagrangeMultiplier(new_lambda);
-                    }
-
-                    double true_delta = new_lambda - old_lambda;
-
-                    // For all items with variables, add the effect of incremented
-                    // (and projected) lagrangian reactions:
-                    mconstraints[ic]->IncrementState(true_delta);
-
-                    if (this->record_violation_history)
-                        maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
-                }
 
-                maxviolation = std::max(maxviolation, fabs(candidate_violation));
+        if (!m_coloring) {
+            for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
+                // skip computations if constraint not active.
+                if (!mconstraints[ic]->IsActive())
+                    continue;
+
+                // the N normal component of a friction triplet is followed by its U,V tangential components
+                bool triplet = mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION;
+                maxviolation = std::max(maxviolation, RelaxBlock(&mconstraints[ic], triplet, maxdeltalambda));
+                if (triplet)
+                    ic += 2;
+            }
+        } else {
+            // Blocks of the same color do not share any active variable and can be relaxed concurrently.
+            int num_colors = (int)m_color_start.size() - 1;
+            for (int color = 0; color < num_colors; color++) {
+                int start = (int)m_color_start[color];
+                int end = (int)m_color_start[color + 1];
+                std::fill(thread_maxviolation.begin(), thread_maxviolation.end(), 0.0);
+                std::fill(thread_maxdeltalambda.begin(), thread_maxdeltalambda.end(), 0.0);
+
+#pragma omp parallel for schedule(static) num_threads(m_num_threads)
+                for (int ib = start; ib < end; ib++) {
+                    int tid = ChOMP::GetThreadNum();
+                    ChConstraint** block = &mconstraints[m_blocks[ib]];
+                    bool triplet = block[0]->GetMode() == ChConstraint::Mode::FRICTION;
+                    double violation = RelaxBlock(block, triplet, thread_maxdeltalambda[tid]);
+                    thread_maxviolation[tid] = std::max(thread_maxviolation[tid], violation);
+                }
 
-            }  // end IsActive()
+                for (int tid = 0; tid < m_num_threads; tid++) {
+                    maxviolation = std::max(maxviolation, thread_maxviolation[tid]);
+                    maxdeltalambda = std::max(maxdeltalambda, thread_maxdeltalambda[tid]);
+                }
+            }
 
-        }  // end loop on constraints
+            // Blocks which could not be colored are relaxed sequentially.
+            for (size_t ib = m_color_start.back(); ib < m_blocks.size(); ib++) {
+                ChConstraint** block = &mconstraints[m_blocks[ib]];
+                bool triplet = block[0]->GetMode() == ChConstraint::Mode::FRICTION;
+                maxviolation = std::max(maxviolation, RelaxBlock(block, triplet, maxdeltalambda));
+            }
+        }
 
         // For recording into violation history, if debugging
         if (this->record_violation_history)
@@ -211,4 +159,216 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     return maxviolation;
 }
 
+double ChSolverPSOR::RelaxBlock(ChConstraint** block, bool triplet, double& maxdeltalambda) const {
+    if (triplet) {
+        double old_lambda_friction[3];
+        double candidate_violation = 0;
+
+        for (int i = 0; i < 3; i++) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = block[i]->ComputeJacobianTimesState() + block[i]->GetRightHandSide() +
+                               block[i]->GetComplianceTerm() * block[i]->GetLagrangeMultiplier();
+
+            // only the N normal component contributes to the violation
+            if (i == 0)
+                candidate_violation = fabs(std::min(0.0, mresidual));
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (m_omega / block[i]->GetSchurComplement()) * (-mresidual);
+
+            // update:   lambda += delta_lambda;
+            old_lambda_friction[i] = block[i]->GetLagrangeMultiplier();
+            block[i]->SetLagrangeMultiplier(old_lambda_friction[i] + deltal);
+        }
+
+        block[0]->Project();  // the N normal component will take care of N,U,V
+        double new_lambda_0 = block[0]->GetLagrangeMultiplier();
+        double new_lambda_1 = block[1]->GetLagrangeMultiplier();
+        double new_lambda_2 = block[2]->GetLagrangeMultiplier();
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda_0 = m_shlambda * new_lambda_0 + (1.0 - m_shlambda) * old_lambda_friction[0];
+            new_lambda_1 = m_shlambda * new_lambda_1 + (1.0 - m_shlambda) * old_lambda_friction[1];
+            new_lambda_2 = m_shlambda * new_lambda_2 + (1.0 - m_shlambda) * old_lambda_friction[2];
+            block[0]->SetLagrangeMultiplier(new_lambda_0);
+            block[1]->SetLagrangeMultiplier(new_lambda_1);
+            block[2]->SetLagrangeMultiplier(new_lambda_2);
+        }
+        double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
+        double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
+        double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
+        block[0]->IncrementState(true_delta_0);
+        block[1]->IncrementState(true_delta_1);
+        block[2]->IncrementState(true_delta_2);
+
+        if (this->record_violation_history) {
+            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_0));
+            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_1));
+            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta_2));
+        }
+
+        return candidate_violation;
+    }
+
+    ChConstraint* constraint = block[0];
+
+    // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+    double mresidual = constraint->ComputeJacobianTimesState() + constraint->GetRightHandSide() +
+                       constraint->GetComplianceTerm() * constraint->GetLagrangeMultiplier();
+
+    // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+    double candidate_violation = fabs(constraint->Violation(mresidual));
+
+    // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+    double deltal = (m_omega / constraint->GetSchurComplement()) * (-mresidual);
+
+    if (constraint->GetMode() == ChConstraint::Mode::UNILATERAL) {
+        // update:   lambda += delta_lambda;
+        double old_lambda = constraint->GetLagrangeMultiplier();
+        constraint->SetLagrangeMultiplier(old_lambda + deltal);
+
+        candidate_violation = fabs(std::min(0.0, mresidual));
+        constraint->Project();
+        double new_lambda = constraint->GetLagrangeMultiplier();
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+            constraint->SetLagrangeMultiplier(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda;
+        constraint->IncrementState(true_delta);
+
+        if (this->record_violation_history)
+            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
+    } else {
+        // update:   lambda += delta_lambda;
+        double old_lambda = constraint->GetLagrangeMultiplier();
+        constraint->SetLagrangeMultiplier(old_lambda + deltal);
+
+        // If new lagrangian multiplier does not satisfy inequalities, project
+        // it into an admissible orthant (or, in general, onto an admissible set)
+        constraint->Project();
+
+        // After projection, the lambda may have changed a bit..
+        double new_lambda = constraint->GetLagrangeMultiplier();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda;
+            constraint->SetLagrangeMultiplier(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda;
+
+        // For all items with variables, add the effect of incremented
+        // (and projected) lagrangian reactions:
+        constraint->IncrementState(true_delta);
+
+        if (this->record_violation_history)
+            maxdeltalambda = std::max(maxdeltalambda, fabs(true_delta));
+    }
+
+    return candidate_violation;
+}
+
+void ChSolverPSOR::ColorBlocks(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    const unsigned int nConstr = (unsigned int)mconstraints.size();
+    const int max_colors = 64;
+
+    // Bitmask of the colors already used by blocks acting on each active variable (indexed by variable offset).
+    std::vector<uint64_t> var_colors(sysd.CountActiveVariables(), 0);
+
+    // Greedy coloring of the active blocks, in constraint order (color -1 for blocks which cannot be colored).
+    std::vector<unsigned int> block_start;
+    std::vector<int> block_color;
+    std::vector<unsigned int> color_count(max_colors + 1, 0);
+    std::vector<ChVariables*> vars;
+
+    for (unsigned int ic = 0; ic < nConstr; ic++) {
+        if (!mconstraints[ic]->IsActive())
+            continue;
+
+        unsigned int nb = (mconstraints[ic]->GetMode() == ChConstraint::Mode::FRICTION) ? 3 : 1;
+        nb = std::min(nb, nConstr - ic);
+
+        // A constraint which does not report its variables cannot be safely colored.
+        vars.clear();
+        bool known_vars = true;
+        for (unsigned int k = 0; k < nb; k++) {
+            size_t num_vars = vars.size();
+            mconstraints[ic + k]->AppendVariables(vars);
+            if (vars.size() == num_vars)
+                known_vars = false;
+        }
+
+        // Inactive variables (e.g., fixed bodies) are never modified and do not induce conflicts.
+        int color = -1;
+        if (known_vars) {
+            uint64_t used = 0;
+            bool valid = true;
+            for (auto var : vars) {
+                if (!var || !var->IsActive())
+                    continue;
+                if (var->GetOffset() >= var_colors.size()) {
+                    valid = false;
+                    break;
+                }
+                used |= var_colors[var->GetOffset()];
+            }
+            if (valid && used != ~uint64_t(0)) {
+                color = 0;
+                while (used & (uint64_t(1) << color))
+                    color++;
+                for (auto var : vars) {
+                    if (var && var->IsActive())
+                        var_colors[var->GetOffset()] |= (uint64_t(1) << color);
+                }
+            }
+        }
+
+        block_start.push_back(ic);
+        block_color.push_back(color);
+        color_count[color < 0 ? max_colors : color]++;
+
+        ic += nb - 1;
+    }
+
+    // Sort blocks by color (stable, so that the constraint order is preserved within each color).
+    int num_colors = 0;
+    while (num_colors < max_colors && color_count[num_colors] > 0)
+        num_colors++;
+
+    m_color_start.assign(num_colors + 1, 0);
+    for (int color = 0; color < num_colors; color++)
+        m_color_start[color + 1] = m_color_start[color] + color_count[color];
+
+    std::vector<unsigned int> next(m_color_start.begin(), m_color_start.end());
+    m_blocks.resize(block_start.size());
+    for (size_t ib = 0; ib < block_start.size(); ib++) {
+        int color = block_color[ib];
+        m_blocks[next[color < 0 ? num_colors : color]++] = block_start[ib];
+    }
+}
+
+void ChSolverPSOR::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChSolverPSOR>();
+    // serialize parent class
+    ChIterativeSolverVI::ArchiveOut(archive_out);
+    // serialize all member data:
+    archive_out << CHNVP(m_coloring);
+    archive_out << CHNVP(m_num_threads);
+}
+
+void ChSolverPSOR::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChSolverPSOR>();
+    // deserialize parent class
+    ChIterativeSolverVI::ArchiveIn(archive_in);
+    // stream in all member data:
+    archive_in >> CHNVP(m_coloring);
+    archive_in >> CHNVP(m_num_threads);
+}
+
 }  // end namespace chrono
@@ -25,7 +25,9 @@ namespace chrono {
 /// An iterative solver based on projective fixed point method, with overrelaxation and immediate variable update as in
 /// SOR methods.\n
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
-/// solver.
+/// solver.\n
+/// Optionally, the constraints can be graph-colored based on the ChVariables they act upon, in which case all
+/// constraints of a given color are relaxed concurrently (see EnableParallelColoring).
 
 class ChApi ChSolverPSOR : public ChIterativeSolverVI {
   public:
@@ -35,6 +37,9 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
 
     virtual Type GetType() const override { return Type::PSOR; }
 
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChSolverPSOR* Clone() const override { return new ChSolverPSOR(*this); }
+
     /// Performs the solution of the problem.
     /// \return  the maximum constraint violation after termination.
     virtual double Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
@@ -44,8 +49,44 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable the graph-colored parallel sweep (default: false).
+    /// If enabled, constraint blocks (single constraints or friction triplets) are colored at each solve so that no two
+    /// blocks of the same color act on the same active ChVariables. Colors are then processed in sequence, with all
+    /// blocks of a color relaxed concurrently. The sweep order differs from the sequential one, but the results are
+    /// deterministic and independent of the number of threads.
+    void EnableParallelColoring(bool val) { m_coloring = val; }
+
+    /// Set the number of OpenMP threads used in the graph-colored sweep (default: 1).
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(1, num_threads); }
+
+    /// Return true if the graph-colored parallel sweep is enabled.
+    bool IsParallelColoringEnabled() const { return m_coloring; }
+
+    /// Return the number of colors used in the last solve (0 if the graph-colored sweep is disabled).
+    /// Constraint blocks which could not be colored (too many colors or no connectivity information) are not counted
+    /// here; these are relaxed sequentially, after all colors.
+    int GetNumColors() const { return m_color_start.empty() ? 0 : (int)m_color_start.size() - 1; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
   private:
+    /// Relax the constraint block (a single constraint or a friction triplet) starting at the specified constraint.
+    /// Return the constraint violation and update the maximum change in Lagrange multipliers.
+    double RelaxBlock(ChConstraint** block, bool triplet, double& maxdeltalambda) const;
+
+    /// Partition the active constraint blocks into colors, based on the active variables they act upon.
+    void ColorBlocks(ChSystemDescriptor& sysd);
+
     double maxviolation;
+
+    bool m_coloring;                          ///< use the graph-colored parallel sweep
+    int m_num_threads;                        ///< number of OpenMP threads for the colored sweep
+    std::vector<unsigned int> m_blocks;       ///< first constraint index of each block, sorted by color
+    std::vector<unsigned int> m_color_start;  ///< start of each color in m_blocks (uncolored blocks at the end)
 };
 
 /// @} chrono_solver
@@ -181,6 +181,28 @@ void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix* Z, ChVectorDynamic<>*
     }
 }
 
+void ChSystemDescriptor::BuildSystemMatrix(ChSparseMatrix& Z, const ChKRMSlotMap& krm_map, int num_threads) const {
+    n_q = CountActiveVariables();
+
+    n_c = CountActiveConstraints();
+
+    Z.setZeroValues();
+
+    for (const auto& var : m_variables) {
+        if (var->IsActive()) {
+            var->PasteMassInto(Z, 0, 0, c_a);
+        }
+    }
+
+    krm_map.PasteMatrixInto(Z, num_threads);
+
+    PasteConstraintsJacobianMatrixInto(Z, n_q, 0);
+
+    PasteConstraintsJacobianMatrixTransposedInto(Z, 0, n_q);
+
+    PasteComplianceMatrixInto(Z, n_q, n_q);
+}
+
 unsigned int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector, unsigned int start_row) const {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -258,6 +280,93 @@ unsigned int ChSystemDescriptor::BuildDiagonalVector(ChVectorDynamic<>& Diagonal
     return n_q + n_c;
 }
 
+unsigned int ChSystemDescriptor::BuildDiagonalBlocks(std::vector<unsigned int>& offsets,
+                                                     std::vector<ChMatrixDynamic<>>& blocks) const {
+    n_q = CountActiveVariables();
+    offsets.clear();
+    blocks.clear();
+
+    // List of the ChKRMBlock objects referencing each variable, addressed by the variable offset
+    std::vector<std::vector<int>> krm_lists(n_q);
+    for (int k = 0; k < (int)m_KRMblocks.size(); k++) {
+        for (unsigned int iv = 0; iv < m_KRMblocks[k]->GetNumVariables(); iv++) {
+            auto var = m_KRMblocks[k]->GetVariable(iv);
+            if (var->IsActive())
+                krm_lists[var->GetOffset()].push_back(k);
+        }
+    }
+
+    // Group consecutive variables with contiguous offsets which are referenced by the same (non-empty) list of
+    // ChKRMBlock objects, such as the position and slope variables of an ANCF node.
+    // Index of the block associated with each variable, addressed by the variable offset
+    std::vector<int> index(n_q, -1);
+    ChVariables* prev = nullptr;
+    for (const auto& var : m_variables) {
+        if (!var->IsActive())
+            continue;
+        auto offset = var->GetOffset();
+        bool same_block = prev && prev->GetOffset() + prev->GetDOF() == offset && !krm_lists[offset].empty() &&
+                          krm_lists[offset] == krm_lists[prev->GetOffset()];
+        if (same_block) {
+            auto n = blocks.back().rows() + var->GetDOF();
+            blocks.back().conservativeResize(n, n);
+        } else {
+            offsets.push_back(offset);
+            blocks.push_back(ChMatrixDynamic<>(var->GetDOF(), var->GetDOF()));
+        }
+        index[offset] = (int)blocks.size() - 1;
+        prev = var;
+    }
+    for (auto& block : blocks)
+        block.setZero();
+
+    // Get the 'M' blocks given by ChVariables objects, one column at a time
+    ChVectorDynamic<> e;
+    ChVectorDynamic<> Me;
+    for (const auto& var : m_variables) {
+        if (var->IsActive()) {
+            unsigned int in = var->GetDOF();
+            unsigned int io = var->GetOffset() - offsets[index[var->GetOffset()]];
+            auto& block = blocks[index[var->GetOffset()]];
+            e.setZero(in);
+            for (unsigned int c = 0; c < in; c++) {
+                e(c) = 1;
+                Me.setZero(in);
+                var->AddMassTimesVector(Me, e);
+                block.block(io, io + c, in, 1) = c_a * Me;
+                e(c) = 0;
+            }
+        }
+    }
+
+    // Add the blocks given by ChKRMBlock objects, if any, which couple variables in the same diagonal block
+    for (const auto& krm_block : m_KRMblocks) {
+        const auto& KRM = krm_block->GetMatrix();
+        unsigned int kio = 0;
+        for (unsigned int iv = 0; iv < krm_block->GetNumVariables(); iv++) {
+            auto var_i = krm_block->GetVariable(iv);
+            unsigned int in = var_i->GetDOF();
+            if (var_i->IsActive()) {
+                int b = index[var_i->GetOffset()];
+                unsigned int io = var_i->GetOffset() - offsets[b];
+                unsigned int kjo = 0;
+                for (unsigned int jv = 0; jv < krm_block->GetNumVariables(); jv++) {
+                    auto var_j = krm_block->GetVariable(jv);
+                    unsigned int jn = var_j->GetDOF();
+                    if (var_j->IsActive() && index[var_j->GetOffset()] == b) {
+                        unsigned int jo = var_j->GetOffset() - offsets[b];
+                        blocks[b].block(io, jo, in, jn) += KRM.block(kio, kjo, in, jn);
+                    }
+                    kjo += jn;
+                }
+            }
+            kio += in;
+        }
+    }
+
+    return (unsigned int)blocks.size();
+}
+
 unsigned int ChSystemDescriptor::FromVariablesToVector(ChVectorDynamic<>& mvector, bool resize_vector) const {
     // Count active variables and resize vector if necessary
     if (resize_vector) {
@@ -19,6 +19,7 @@
 
 #include "chrono/solver/ChConstraint.h"
 #include "chrono/solver/ChKRMBlock.h"
+#include "chrono/solver/ChKRMSlotMap.h"
 #include "chrono/solver/ChVariables.h"
 
 namespace chrono {
@@ -154,6 +155,18 @@ class ChApi ChSystemDescriptor {
         ChVectorDynamic<>& Diagonal_vect  ///< system-level vector of terms on M and E diagonal
     ) const;
 
+    /// Get the diagonal blocks of the [c_a*M + KRM] part of the Z system matrix.
+    /// Each block couples the coordinates of a single ChVariables object (e.g., a rigid body or an FEA node), or of
+    /// consecutive ChVariables objects referenced by the same ChKRMBlock objects (e.g., the position and slope
+    /// variables of an ANCF node). Blocks include the masses and the corresponding entries of all ChKRMBlock objects.
+    /// Constraint terms are not included.
+    /// On return, 'offsets' contains the offset of each block in the system-level vector of unknowns.
+    /// Returns the number of blocks.
+    virtual unsigned int BuildDiagonalBlocks(
+        std::vector<unsigned int>& offsets,     ///< offsets of the diagonal blocks
+        std::vector<ChMatrixDynamic<>>& blocks  ///< diagonal blocks
+    ) const;
+
     /// Using this function, one may get a vector with all the variables 'q'
     /// ordered into a column vector. The column vector must be passed as a ChMatrix<>
     /// object, which will be automatically reset and resized to the proper length if necessary
@@ -321,6 +334,12 @@ class ChApi ChSystemDescriptor {
                                    ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     ) const;
 
+    /// Assemble the system matrix in a compressed matrix with a locked sparsity pattern.
+    /// The KRM blocks are added directly into the matrix values, at the positions cached in the given map (which must
+    /// be valid for this descriptor and matrix; see ChKRMSlotMap::IsValid). All other terms are pasted as in
+    /// BuildSystemMatrix.
+    virtual void BuildSystemMatrix(ChSparseMatrix& Z, const ChKRMSlotMap& krm_map, int num_threads = 1) const;
+
     /// Write the current system matrix blocks and right-hand side components.
     /// The system matrix is formed by calling BuildSystemMatrix() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
@@ -12,9 +12,11 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChUtils.h"
 
 namespace chrono {
 
@@ -99,6 +101,205 @@ std::string ChTimestepper::GetTypeAsString(Type type) {
 
 // -----------------------------------------------------------------------------
 
+class ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper : public ChImplicitIterativeTimestepper {
+  public:
+    CH_ENUM_MAPPER_BEGIN(JacobianUpdate);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_ITERATION);
+    CH_ENUM_VAL(JacobianUpdate::EVERY_STEP);
+    CH_ENUM_VAL(JacobianUpdate::AUTOMATIC);
+    CH_ENUM_MAPPER_END(JacobianUpdate);
+};
+
+ChImplicitIterativeTimestepper::ChImplicitIterativeTimestepper()
+    : maxiters(6),
+      reltol(1e-4),
+      abstolS(1e-10),
+      abstolL(1e-10),
+      numiters(0),
+      numsetups(0),
+      numsolves(0),
+      jacobian_update(JacobianUpdate::EVERY_ITERATION),
+      jacobian_max_rate(0.5),
+      jacobian_max_age(0),
+      error_control(false),
+      err_rtol(1e-3),
+      err_atol(1e-6),
+      err_safety(0.9),
+      err_fac_min(0.2),
+      err_fac_max(5),
+      err_prev(1),
+      h(1e6),
+      h_min(1e-10),
+      num_accepted(0),
+      num_rejected(0),
+      jac_valid(false),
+      jac_refresh(false),
+      jac_iter(0),
+      jac_age(0),
+      jac_step_updated(false),
+      jac_c_a(0),
+      jac_c_v(0),
+      jac_c_x(0),
+      jac_nv(0),
+      jac_nc(0),
+      jac_prev_norm(0),
+      jac_tot_iters(0),
+      jac_tot_setups(0),
+      jac_rate_updates(0) {}
+
+void ChImplicitIterativeTimestepper::ResetJacobianStatistics() {
+    jac_tot_iters = 0;
+    jac_tot_setups = 0;
+    jac_rate_updates = 0;
+}
+
+void ChImplicitIterativeTimestepper::JacobianStepStart() {
+    jac_iter = 0;
+    jac_prev_norm = 0;
+    jac_step_updated = false;
+}
+
+bool ChImplicitIterativeTimestepper::JacobianNeedsUpdate(double c_a,
+                                                         double c_v,
+                                                         double c_x,
+                                                         unsigned int nv,
+                                                         unsigned int nc) {
+    // The current matrix cannot be used if none is available, if a refresh was requested, or if it was evaluated for
+    // a different problem size or with different coefficients (e.g., a different step size)
+    bool update = !jac_valid || jac_refresh;
+    update = update || nv != jac_nv || nc != jac_nc;
+    update = update || c_a != jac_c_a || c_v != jac_c_v || c_x != jac_c_x;
+
+    switch (jacobian_update) {
+        case JacobianUpdate::EVERY_ITERATION:
+            update = true;
+            break;
+        case JacobianUpdate::EVERY_STEP:
+            update = update || jac_iter == 0;
+            break;
+        case JacobianUpdate::AUTOMATIC:
+            update = update || (jac_iter == 0 && jacobian_max_age > 0 && jac_age >= jacobian_max_age);
+            break;
+    }
+
+    if (update) {
+        jac_valid = true;
+        jac_refresh = false;
+        jac_age = 0;
+        jac_step_updated = true;
+        jac_c_a = c_a;
+        jac_c_v = c_v;
+        jac_c_x = c_x;
+        jac_nv = nv;
+        jac_nc = nc;
+    }
+
+    return update;
+}
+
+void ChImplicitIterativeTimestepper::JacobianIterationDone(bool setup_called, double correction_norm) {
+    numiters++;
+    numsolves++;
+    jac_tot_iters++;
+    if (setup_called) {
+        numsetups++;
+        jac_tot_setups++;
+    }
+
+    // With an out-of-date matrix, request a refresh if the Newton iteration does not contract fast enough
+    if (jacobian_update == JacobianUpdate::AUTOMATIC && !setup_called && jac_prev_norm > 0 &&
+        correction_norm > jacobian_max_rate * jac_prev_norm) {
+        if (!jac_refresh)
+            jac_rate_updates++;
+        jac_refresh = true;
+    }
+
+    jac_prev_norm = correction_norm;
+    jac_iter++;
+}
+
+void ChImplicitIterativeTimestepper::JacobianStepEnd(bool converged) {
+    jac_age++;
+
+    // Do not carry an out-of-date matrix past a step that did not converge
+    if (jacobian_update == JacobianUpdate::AUTOMATIC && !converged)
+        jac_refresh = true;
+}
+
+double ChImplicitIterativeTimestepper::ErrorNorm(const ChStateDelta& err, const ChState& x) const {
+    ChVectorDynamic<> ewt;
+    if (x.size() == err.size()) {
+        ewt = (err_rtol * x.cwiseAbs()).array() + err_atol;
+    } else {
+        double x_rms = x.size() > 0 ? x.norm() / std::sqrt((double)x.size()) : 0;
+        ewt.setConstant(err.size(), err_rtol * x_rms + err_atol);
+    }
+    return err.wrmsNorm(ewt.cwiseInverse());
+}
+
+double ChImplicitIterativeTimestepper::StepSizeFactor(double err, int order, bool accepted) {
+    // PI step size controller (Gustafsson):  fac = safety * err^(-kI/order) * err_prev^(kP/order)
+    const double kI = 0.7;
+    const double kP = 0.4;
+    err = std::max(err, 1e-10);
+
+    if (!accepted) {
+        // After a rejection, only use the integral term and never increase the step size
+        double fac = err_safety * std::pow(err, -1.0 / order);
+        return ChClamp(fac, err_fac_min, 1.0);
+    }
+
+    double fac = err_safety * std::pow(err, -kI / order) * std::pow(err_prev, kP / order);
+    err_prev = err;
+    return ChClamp(fac, err_fac_min, err_fac_max);
+}
+
+void ChImplicitIterativeTimestepper::ArchiveOut(ChArchiveOut& archive) {
+    // version number
+    archive.VersionWrite(3);
+    // serialize all member data:
+    archive << CHNVP(maxiters);
+    archive << CHNVP(reltol);
+    archive << CHNVP(abstolS);
+    archive << CHNVP(abstolL);
+    ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper::JacobianUpdate_mapper updatemapper;
+    archive << CHNVP(updatemapper(jacobian_update), "jacobian_update");
+    archive << CHNVP(jacobian_max_rate);
+    archive << CHNVP(jacobian_max_age);
+    archive << CHNVP(error_control);
+    archive << CHNVP(err_rtol);
+    archive << CHNVP(err_atol);
+    archive << CHNVP(err_fac_min);
+    archive << CHNVP(err_fac_max);
+    archive << CHNVP(h_min);
+}
+
+void ChImplicitIterativeTimestepper::ArchiveIn(ChArchiveIn& archive) {
+    // version number
+    int version = archive.VersionRead();
+    // stream in all member data:
+    archive >> CHNVP(maxiters);
+    archive >> CHNVP(reltol);
+    archive >> CHNVP(abstolS);
+    archive >> CHNVP(abstolL);
+    if (version > 1) {
+        ChImplicitIterativeTimestepper_JacobianUpdate_enum_mapper::JacobianUpdate_mapper updatemapper;
+        archive >> CHNVP(updatemapper(jacobian_update), "jacobian_update");
+        archive >> CHNVP(jacobian_max_rate);
+        archive >> CHNVP(jacobian_max_age);
+    }
+    if (version > 2) {
+        archive >> CHNVP(error_control);
+        archive >> CHNVP(err_rtol);
+        archive >> CHNVP(err_atol);
+        archive >> CHNVP(err_fac_min);
+        archive >> CHNVP(err_fac_max);
+        archive >> CHNVP(h_min);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 CH_UPCASTING(ChTimestepperEulerExpl, ChTimestepperIorder)
@@ -462,6 +663,81 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
 
     mintegrable->StateGather(X, V, T);  // state <- system
 
+    numiters = 0;
+    numsetups = 0;
+    numsolves = 0;
+    num_accepted = 0;
+    num_rejected = 0;
+
+    double tfinal = T + dt;
+    double h_step = dt;
+
+    // Take internal steps until reaching the final time (a single step if not using error control)
+    while (true) {
+        if (error_control)
+            h_step = std::min(h, tfinal - T);
+
+        bool converged = SolveStep(h_step);
+
+        if (error_control) {
+            // Local truncation error in positions: x_BE - x_exact = -h^2/2 * a  ~  -h/2 * (v_new - v_old)
+            double err = converged ? ErrorNorm((Vnew - V) * (h_step / 2), Xnew) : 1e10;
+
+            // Newton failed and the step size cannot be reduced any further
+            if (!converged && h_step <= h_min)
+                throw std::runtime_error("Euler implicit: Reached minimum allowable step size.");
+
+            if (err > 1 && h_step > h_min) {
+                // reject the step, retry with a smaller step size
+                num_rejected++;
+                h = h_step * StepSizeFactor(err, 2, false);
+                if (verbose)
+                    std::cout << " ---Euler reject step (err = " << err << "), reduce stepsize to " << h << std::endl;
+                if (h < h_min)
+                    throw std::runtime_error("Euler implicit: Reached minimum allowable step size.");
+                mintegrable->StateScatter(X, V, T, false);
+                L.setZero();
+                continue;
+            }
+
+            // accept the step and select the size of the next one (do not shrink it because of a short last step)
+            double h_next = h_step * StepSizeFactor(err, 2, true);
+            h = (h_step < h) ? std::max(h, h_next) : h_next;
+            if (verbose)
+                std::cout << " Euler accept step (err = " << err << "), next stepsize " << h << std::endl;
+        }
+
+        num_accepted++;
+
+        mintegrable->StateScatterAcceleration(
+            (Vnew - V) * (1 / h_step));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
+
+        X = Xnew;
+        V = Vnew;
+        T += h_step;
+
+        if (!error_control)
+            break;
+
+        // Stop when reaching the final time (clamp to tfinal if close enough)
+        if (tfinal - T < std::min(h_min, 1e-6 * dt)) {
+            T = tfinal;
+            break;
+        }
+
+        // Scatter state -> system and prepare the next internal step
+        mintegrable->StateScatter(X, V, T, false);
+        L.setZero();
+    }
+
+    mintegrable->StateScatter(X, V, T, true);  // state -> system
+    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+}
+
+bool ChTimestepperEulerImplicit::SolveStep(double dt) {
+    // downcast
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
     // Extrapolate a prediction as warm start
 
     Xnew = X + V * dt;
@@ -472,9 +748,8 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
     // [ M - dt*dF/dv - dt^2*dF/dx    Cq' ] [ Dv     ] = [ M*(v_old - v_new) + dt*f + dt*Cq'*l ]
     // [ Cq                           0   ] [ -dt*Dl ] = [ -C/dt  ]
 
-    numiters = 0;
-    numsetups = 0;
-    numsolves = 0;
+    JacobianStepStart();
+    bool converged = false;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -490,8 +765,13 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             std::cout << " Euler iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        bool call_setup = JacobianNeedsUpdate(1.0, -dt, -dt * dt, mintegrable->GetNumCoordsVelLevel(),
+                                              mintegrable->GetNumConstraints());
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -501,12 +781,10 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always call the solver's Setup
+            call_setup                      // call the solver's Setup?
         );
 
-        numiters++;
-        numsetups++;
-        numsolves++;
+        JacobianIterationDone(call_setup, Dv.norm());
 
         Dl *= (1.0 / dt);  // Note it is not -(1.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -516,15 +794,9 @@ void ChTimestepperEulerImplicit::Advance(const double dt) {
         Xnew = X + Vnew * dt;
     }
 
-    mintegrable->StateScatterAcceleration(
-        (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
-
-    X = Xnew;
-    V = Vnew;
-    T += dt;
+    JacobianStepEnd(converged);
 
-    mintegrable->StateScatter(X, V, T, true);  // state -> system
-    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+    return converged;
 }
 
 void ChTimestepperEulerImplicit::ArchiveOut(ChArchiveOut& archive) {
@@ -793,6 +1065,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
+    JacobianStepStart();
+    bool converged = false;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -808,8 +1082,13 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             std::cout << " Trapezoidal iteration=" << i << "  |R|=" << R.lpNorm<Eigen::Infinity>()
                       << "  |Qc|=" << Qc.lpNorm<Eigen::Infinity>() << std::endl;
 
-        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL))
+        if ((R.lpNorm<Eigen::Infinity>() < abstolS) && (Qc.lpNorm<Eigen::Infinity>() < abstolL)) {
+            converged = true;
             break;
+        }
+
+        bool call_setup = JacobianNeedsUpdate(1.0, -dt * 0.5, -dt * dt * 0.25, mintegrable->GetNumCoordsVelLevel(),
+                                              mintegrable->GetNumConstraints());
 
         mintegrable->StateSolveCorrection(  //
             Dv, Dl, R, Qc,                  //
@@ -819,12 +1098,10 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
             Xnew, Vnew, T + dt,             // not used here (scatter = false)
             false,                          // do not scatter update to Xnew Vnew T+dt before computing correction
             false,                          // full update? (not used, since no scatter)
-            true                            // always force a call to the solver's Setup() function
+            call_setup                      // force a call to the solver's Setup() function?
         );
 
-        numiters++;
-        numsetups++;
-        numsolves++;
+        JacobianIterationDone(call_setup, Dv.norm());
 
         Dl *= (2.0 / dt);  // Note it is not -(2.0/dt) because we assume StateSolveCorrection already flips sign of Dl
         L += Dl;
@@ -834,6 +1111,8 @@ void ChTimestepperTrapezoidal::Advance(const double dt) {
         Xnew = X + ((Vnew + V) * (dt * 0.5));  // Xnew = Xold + h/2(Vnew+Vold)
     }
 
+    JacobianStepEnd(converged);
+
     mintegrable->StateScatterAcceleration(
         (Vnew - V) * (1 / dt));  // -> system auxiliary data (i.e acceleration as measure, fits DVI/MDI)
 
@@ -1108,7 +1387,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
     numiters = 0;
     numsetups = 0;
     numsolves = 0;
-    bool call_setup = true;
+    JacobianStepStart();
+    bool converged = false;
 
     for (int i = 0; i < this->GetMaxIters(); ++i) {
         mintegrable->StateScatter(Xnew, Vnew, T + dt, false);  // state -> system
@@ -1131,10 +1411,14 @@ void ChTimestepperNewmark::Advance(const double dt) {
                 std::cout << " Newmark NR converged (" << i << ")."
                           << "  T = " << T + dt << "  h = " << dt << std::endl;
             }
+            converged = true;
             break;
         }
 
-        if (verbose && modified_Newton && call_setup)
+        bool call_setup = JacobianNeedsUpdate(1.0, -dt * gamma, -dt * dt * beta, mintegrable->GetNumCoordsVelLevel(),
+                                              mintegrable->GetNumConstraints());
+
+        if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
             std::cout << " Newmark call Setup." << std::endl;
 
         mintegrable->StateSolveCorrection(  //
@@ -1148,14 +1432,7 @@ void ChTimestepperNewmark::Advance(const double dt) {
             call_setup                      // force a call to the solver's Setup() function
         );
 
-        numiters++;
-        numsolves++;
-        if (call_setup) {
-            numsetups++;
-        }
-
-        // If using modified Newton, do not call Setup again
-        call_setup = !modified_Newton;
+        JacobianIterationDone(call_setup, Da.norm());
 
         L += Dl;  // Note it is not -= Dl because we assume StateSolveCorrection flips sign of Dl
         Anew += Da;
@@ -1165,6 +1442,8 @@ void ChTimestepperNewmark::Advance(const double dt) {
         Vnew = V + A * (dt * (1.0 - gamma)) + Anew * (dt * gamma);
     }
 
+    JacobianStepEnd(converged);
+
     X = Xnew;
     V = Vnew;
     A = Anew;
@@ -234,7 +234,19 @@ class ChApi ChImplicitTimestepper {};
 /// Such integrators require solution of a nonlinear problem, typically solved
 /// using an iterative process, up to a desired tolerance. At each iteration,
 /// a linear system must be solved.
+///
+/// This class also implements a common policy for reusing the Newton (Jacobian) matrix, i.e. for deciding at which
+/// Newton iterations the solver's Setup function (matrix assembly and, for direct solvers, factorization) is invoked.
+/// See SetJacobianUpdateMethod.
 class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
+  public:
+    /// Strategy for updating the Newton matrix.
+    enum class JacobianUpdate {
+        EVERY_ITERATION,  ///< full Newton: update the matrix at every iteration
+        EVERY_STEP,       ///< modified Newton: update the matrix only at the first iteration of each step
+        AUTOMATIC         ///< reuse the matrix across iterations and steps, refresh it only when needed
+    };
+
   protected:
     unsigned int maxiters;  ///< maximum number of iterations
     double reltol;          ///< relative tolerance
@@ -245,9 +257,24 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     unsigned int numsetups;  ///< number of calls to the solver's Setup function
     unsigned int numsolves;  ///< number of calls to the solver's Solve function
 
+    JacobianUpdate jacobian_update;  ///< Newton matrix update strategy
+    double jacobian_max_rate;        ///< maximum contraction rate with an out-of-date matrix (AUTOMATIC)
+    unsigned int jacobian_max_age;   ///< maximum number of steps between matrix updates (AUTOMATIC, 0: no limit)
+
+    bool error_control;         ///< local error control enabled?
+    double err_rtol;            ///< relative tolerance for the local error estimate
+    double err_atol;            ///< absolute tolerance for the local error estimate
+    double err_safety;          ///< safety factor of the step size controller
+    double err_fac_min;         ///< minimum step size change factor
+    double err_fac_max;         ///< maximum step size change factor
+    double err_prev;            ///< error estimate of the last accepted step
+    double h;                   ///< internal step size
+    double h_min;               ///< minimum allowable step size
+    unsigned int num_accepted;  ///< number of accepted internal steps in the last call to Advance
+    unsigned int num_rejected;  ///< number of rejected internal steps in the last call to Advance
+
   public:
-    ChImplicitIterativeTimestepper()
-        : maxiters(6), reltol(1e-4), abstolS(1e-10), abstolL(1e-10), numiters(0), numsetups(0), numsolves(0) {}
+    ChImplicitIterativeTimestepper();
     virtual ~ChImplicitIterativeTimestepper() {}
 
     /// Set the max number of iterations using the Newton Raphson procedure
@@ -278,6 +305,71 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
         abstolL = abs_tol;
     }
 
+    /// Set the strategy for updating the Newton matrix.
+    /// With AUTOMATIC, the matrix (and its factorization, if using a direct linear solver) is kept across Newton
+    /// iterations and across steps, and it is refreshed only if:
+    /// - the problem size or the matrix coefficients (i.e., the step size) changed,
+    /// - the Newton iteration with an out-of-date matrix contracts slower than the rate set with SetJacobianMaxRate,
+    /// - the previous step did not converge,
+    /// - the matrix is older than the number of steps set with SetJacobianMaxAge,
+    /// - an update was explicitly requested with ForceJacobianUpdate.
+    /// Note that reusing the matrix across steps assumes that the structure of the problem does not change between
+    /// steps without a change in the problem size; call ForceJacobianUpdate after modifying the system topology.
+    void SetJacobianUpdateMethod(JacobianUpdate method) { jacobian_update = method; }
+
+    /// Get the current strategy for updating the Newton matrix.
+    JacobianUpdate GetJacobianUpdateMethod() const { return jacobian_update; }
+
+    /// Set the maximum contraction rate of the Newton iteration with an out-of-date matrix (AUTOMATIC only).
+    /// If the ratio of the norms of two successive Newton corrections exceeds this value, the matrix is refreshed at
+    /// the next iteration. Default: 0.5.
+    void SetJacobianMaxRate(double rate) { jacobian_max_rate = rate; }
+
+    /// Set the maximum number of steps a Newton matrix can be reused for (AUTOMATIC only).
+    /// Default: 0 (no limit).
+    void SetJacobianMaxAge(unsigned int steps) { jacobian_max_age = steps; }
+
+    /// Force an update of the Newton matrix at the next iteration.
+    void ForceJacobianUpdate() { jac_valid = false; }
+
+    /// Enable/disable adaptive step size control based on an estimate of the local truncation error.
+    /// If enabled, a call to Advance(dt) takes as many internal steps as needed to reach the end of the (macro) step
+    /// dt. An internal step is rejected and re-attempted with a smaller step size if the WRMS norm of its local error
+    /// estimate, weighted with the tolerances set with SetErrorTolerances, is larger than 1. The size of the next
+    /// internal step is selected with a PI controller and it is kept across calls to Advance. Only supported by
+    /// integrators that provide an error estimate (Euler implicit and HHT).
+    /// Default: false.
+    void SetErrorControl(bool enable) { error_control = enable; }
+
+    /// Set the relative and absolute tolerances for the local error estimate.
+    /// The local error in the positions is scaled with the position increment over the step.
+    /// Default: rtol = 1e-3, atol = 1e-6.
+    void SetErrorTolerances(double rtol, double atol) {
+        err_rtol = rtol;
+        err_atol = atol;
+    }
+
+    /// Set the limits of the factor by which the step size can change after an internal step.
+    /// Default: fac_min = 0.2, fac_max = 5.
+    void SetStepSizeChangeLimits(double fac_min, double fac_max) {
+        err_fac_min = fac_min;
+        err_fac_max = fac_max;
+    }
+
+    /// Set the minimum step size.
+    /// An exception is thrown if the internal step size decreases below this limit.
+    /// Default: 1e-10.
+    void SetMinStepSize(double step) { h_min = step; }
+
+    /// Return the current internal step size.
+    double GetStepSize() const { return h; }
+
+    /// Return the number of accepted internal steps in the last call to Advance.
+    unsigned int GetNumAcceptedSteps() const { return num_accepted; }
+
+    /// Return the number of rejected internal steps in the last call to Advance.
+    unsigned int GetNumRejectedSteps() const { return num_rejected; }
+
     /// Return the number of iterations.
     unsigned int GetNumIterations() const { return numiters; }
 
@@ -287,27 +379,67 @@ class ChApi ChImplicitIterativeTimestepper : public ChImplicitTimestepper {
     /// Return the number of calls to the solver's Solve function.
     unsigned int GetNumSolveCalls() const { return numsolves; }
 
+    /// Return the cumulative number of iterations since the last call to ResetJacobianStatistics.
+    unsigned long GetTotalNumIterations() const { return jac_tot_iters; }
+
+    /// Return the cumulative number of calls to the solver's Setup function since the last call to
+    /// ResetJacobianStatistics.
+    unsigned long GetTotalNumSetupCalls() const { return jac_tot_setups; }
+
+    /// Return the number of Newton matrix updates triggered by a slow convergence rate (AUTOMATIC only) since the last
+    /// call to ResetJacobianStatistics.
+    unsigned long GetNumJacobianRateUpdates() const { return jac_rate_updates; }
+
+    /// Reset the cumulative Newton matrix statistics.
+    void ResetJacobianStatistics();
+
     /// Method to allow serialization of transient data to archives.
-    virtual void ArchiveOut(ChArchiveOut& archive) {
-        // version number
-        archive.VersionWrite(1);
-        // serialize all member data:
-        archive << CHNVP(maxiters);
-        archive << CHNVP(reltol);
-        archive << CHNVP(abstolS);
-        archive << CHNVP(abstolL);
-    }
+    virtual void ArchiveOut(ChArchiveOut& archive);
 
     /// Method to allow de-serialization of transient data from archives.
-    virtual void ArchiveIn(ChArchiveIn& archive) {
-        // version number
-        /*int version =*/archive.VersionRead();
-        // stream in all member data:
-        archive >> CHNVP(maxiters);
-        archive >> CHNVP(reltol);
-        archive >> CHNVP(abstolS);
-        archive >> CHNVP(abstolL);
-    }
+    virtual void ArchiveIn(ChArchiveIn& archive);
+
+  protected:
+    /// Initialize the Newton matrix monitor for a new step (or a new attempt at a step).
+    void JacobianStepStart();
+
+    /// Return true if the solver's Setup function must be called at the current Newton iteration.
+    /// The arguments are the factors of M, dF/dv, and dF/dx in the Newton matrix and the problem size.
+    bool JacobianNeedsUpdate(double c_a, double c_v, double c_x, unsigned int nv, unsigned int nc);
+
+    /// Register a completed Newton iteration, given whether the Setup function was called and the norm of the
+    /// resulting state correction. This also increments the iteration, setup, and solve counters.
+    void JacobianIterationDone(bool setup_called, double correction_norm);
+
+    /// Register the end of the Newton iteration for the current step.
+    void JacobianStepEnd(bool converged);
+
+    /// Return true if the Newton matrix was updated since the last call to JacobianStepStart.
+    bool JacobianUpdatedInStep() const { return jac_step_updated; }
+
+    /// Return the WRMS norm of the local error estimate err (a position-level error), using error weights
+    /// 1 / (rtol * |x| + atol) based on the position state x. If x has more coordinates than err (e.g., rotations
+    /// parametrized by quaternions), a uniform weight based on the RMS value of x is used instead.
+    double ErrorNorm(const ChStateDelta& err, const ChState& x) const;
+
+    /// Return the factor for the size of the next step (PI controller), given the norm of the local error estimate of
+    /// the current step and the order of that estimate (i.e. err = O(h^order)). Use accepted = false for a rejected
+    /// step; in that case, only a step size decrease is allowed. On an accepted step, the error is recorded for the
+    /// next call.
+    double StepSizeFactor(double err, int order, bool accepted);
+
+  private:
+    bool jac_valid;                    ///< a Newton matrix is available
+    bool jac_refresh;                  ///< the Newton matrix must be refreshed at the next iteration
+    unsigned int jac_iter;             ///< Newton iteration counter within the current step
+    unsigned int jac_age;              ///< number of steps since the last matrix update
+    bool jac_step_updated;             ///< was the matrix updated during the current step?
+    double jac_c_a, jac_c_v, jac_c_x;  ///< coefficients of the current Newton matrix
+    unsigned int jac_nv, jac_nc;       ///< problem size for the current Newton matrix
+    double jac_prev_norm;              ///< norm of the previous Newton correction
+    unsigned long jac_tot_iters;       ///< cumulative number of iterations
+    unsigned long jac_tot_setups;      ///< cumulative number of Setup calls
+    unsigned long jac_rate_updates;    ///< cumulative number of updates triggered by the convergence rate
 };
 
 /// Euler explicit timestepper.
@@ -469,9 +601,17 @@ class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChI
     virtual Type GetType() const override { return Type::EULER_IMPLICIT; }
 
     /// Performs an integration timestep
+    /// If error control is enabled (see SetErrorControl), this may take several internal steps.
     virtual void Advance(const double dt  ///< timestep to advance
                          ) override;
 
+  protected:
+    /// Solve the nonlinear system for a step of size dt from the state (X, V, T), with a Newton iteration.
+    /// The new state is returned in Xnew, Vnew, and L. Return true if the Newton iteration converged.
+    bool SolveStep(double dt);
+
+  public:
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive) override;
 
@@ -640,14 +780,13 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     ChVectorDynamic<> R;
     ChVectorDynamic<> Rold;
     ChVectorDynamic<> Qc;
-    bool modified_Newton;
 
   public:
     /// Constructors (default empty)
     ChTimestepperNewmark(ChIntegrableIIorder* intgr = nullptr)
         : ChTimestepperIIorder(intgr), ChImplicitIterativeTimestepper() {
         SetGammaBeta(0.6, 0.3);  // default values with some damping, and that works also with DAE constraints
-        modified_Newton = true;  // default use modified Newton with jacobian factorization only at beginning
+        jacobian_update = JacobianUpdate::EVERY_STEP;  // default use modified Newton
     }
 
     virtual Type GetType() const override { return Type::NEWMARK; }
@@ -670,7 +809,10 @@ class ChApi ChTimestepperNewmark : public ChTimestepperIIorder, public ChImplici
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once per step.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
     /// Modified Newton iteration is enabled by default.
-    void SetModifiedNewton(bool val) { modified_Newton = val; }
+    /// This is equivalent to SetJacobianUpdateMethod with EVERY_STEP (enabled) or EVERY_ITERATION (disabled).
+    void SetModifiedNewton(bool val) {
+        jacobian_update = val ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Performs an integration timestep
     virtual void Advance(const double dt  ///< timestep to advance
@@ -31,11 +31,10 @@ ChTimestepperHHT::ChTimestepperHHT(ChIntegrableIIorder* intgr)
       req_successful_steps(5),
       step_increase_factor(2),
       step_decrease_factor(0.5),
-      h_min(1e-10),
-      h(1e6),
       num_successful_steps(0),
-      modified_Newton(true) {
+      call_setup(true) {
     SetAlpha(-0.2);  // default: some dissipation
+    jacobian_update = JacobianUpdate::EVERY_STEP;
 }
 
 void ChTimestepperHHT::SetAlpha(double val) {
@@ -78,11 +77,16 @@ void ChTimestepperHHT::Advance(const double dt) {
     numiters = 0;            // total number of NR iterations for this step
     numsetups = 0;
     numsolves = 0;
+    num_accepted = 0;
+    num_rejected = 0;
 
     // If we had a streak of successful steps, consider a stepsize increase.
     // Note that we never attempt a step larger than the specified dt value.
     // If step size control is disabled, always use h = dt.
-    if (!step_control) {
+    // With error control, the stepsize is selected based on the local error estimate of the previous step.
+    if (error_control) {
+        num_successful_steps = 0;
+    } else if (!step_control) {
         h = dt;
         num_successful_steps = 0;
     } else if (num_successful_steps >= req_successful_steps) {
@@ -97,41 +101,42 @@ void ChTimestepperHHT::Advance(const double dt) {
         h = std::min(h, dt);
     }
 
-    // Monitor flags controlling whther or not the Newton matrix must be updated.
-    // If using modified Newton, a matrix update occurs:
+    // The Newton matrix update is controlled by the Jacobian update policy (see ChImplicitIterativeTimestepper).
+    // With modified Newton (EVERY_STEP), a matrix update occurs:
     //   - at the beginning of a step
     //   - on a stepsize decrease
-    //   - if the Newton iteration does not converge with an out-of-date matrix
+    // With AUTOMATIC, the matrix is also reused across steps and a step that does not converge with an out-of-date
+    // matrix is re-attempted with an updated matrix before decreasing the stepsize.
     // Otherwise, the matrix is updated at each iteration.
-    matrix_is_current = false;
-    call_setup = true;
 
     // Loop until reaching final time
     while (true) {
+        // With error control, do not step past the final time
+        double h_desired = h;
+        if (error_control)
+            h = std::min(h, tfinal - T);
+
         Prepare(integrable2);
 
         // Newton for state at T+h
         Da_nrm_hist.fill(0.0);
         Dl_nrm_hist.fill(0.0);
+        JacobianStepStart();
         bool converged = false;
         unsigned int it;
 
         for (it = 0; it < maxiters; it++) {
-            if (verbose && modified_Newton && call_setup)
+            call_setup = JacobianNeedsUpdate(1 / (1 + alpha), -h * gamma, -h * h * beta,
+                                             integrable2->GetNumCoordsVelLevel(), integrable2->GetNumConstraints());
+
+            if (verbose && jacobian_update != JacobianUpdate::EVERY_ITERATION && call_setup)
                 std::cout << " HHT call Setup." << std::endl;
 
             // Solve linear system and increment state
             Increment(integrable2);
 
-            // Increment counters
-            numiters++;
-            numsolves++;
-            if (call_setup) {
-                numsetups++;
-            }
-
-            // If using modified Newton, do not call Setup again
-            call_setup = !modified_Newton;
+            // Increment counters and monitor the convergence rate
+            JacobianIterationDone(call_setup, Da.norm());
 
             // Check convergence
             converged = CheckConvergence(it);
@@ -139,7 +144,33 @@ void ChTimestepperHHT::Advance(const double dt) {
                 break;
         }
 
-        if (converged) {
+        bool matrix_was_reused = !JacobianUpdatedInStep();
+        JacobianStepEnd(converged);
+
+        // Estimate the local error and decide whether to reject the step
+        double err = 0;
+        if (converged && error_control)
+            err = EstimateError();
+
+        if (converged && err > 1 && h > h_min) {
+            // ------ NR converged but the local error is too large
+
+            num_rejected++;
+
+            // decrease stepsize
+            h *= StepSizeFactor(err, 3, false);
+
+            if (verbose)
+                std::cout << " ---HHT reject step (err = " << err << "), reduce stepsize to " << h << std::endl;
+
+            // bail out if stepsize reaches minimum allowable
+            if (h < h_min) {
+                if (verbose)
+                    std::cerr << " HHT at minimum stepsize. Exiting..." << std::endl;
+                throw std::runtime_error("HHT: Reached minimum allowable step size.");
+            }
+
+        } else if (converged) {
             // ------ NR converged
 
             // if the number of iterations was low enough, increase the count of successive
@@ -166,22 +197,28 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
-            /*
-            } else if (!matrix_is_current) {
-                // ------ NR did not converge but the matrix was out-of-date
+            num_accepted++;
 
-                // reset the count of successive successful steps
-                num_successful_steps = 0;
+            // With error control, select the next stepsize (do not shrink it because of a short last step)
+            if (error_control) {
+                double h_next = h * StepSizeFactor(err, 3, true);
+                h = (h < h_desired) ? std::max(h_desired, h_next) : h_next;
+                if (verbose)
+                    std::cout << " HHT accept step (err = " << err << "), next stepsize " << h << std::endl;
+            }
+
+        } else if (jacobian_update == JacobianUpdate::AUTOMATIC && matrix_was_reused) {
+            // ------ NR did not converge but the matrix was out-of-date
 
-                // re-attempt step with updated matrix
-                if (verbose) {
-                    std::cout << " HHT re-attempt step with updated matrix." << std::endl;
-                }
+            // reset the count of successive successful steps
+            num_successful_steps = 0;
 
-                call_setup = true;
-            */
+            // re-attempt step with updated matrix (forced by JacobianStepEnd)
+            if (verbose) {
+                std::cout << " HHT re-attempt step with updated matrix." << std::endl;
+            }
 
-        } else if (!step_control) {
+        } else if (!step_control && !error_control) {
             // ------ NR did not converge and we do not control stepsize
 
             // reset the count of successive successful steps
@@ -199,6 +236,8 @@ void ChTimestepperHHT::Advance(const double dt) {
             A = Anew;
             L = Lnew;
 
+            num_accepted++;
+
         } else {
             // ------ NR did not converge
 
@@ -218,8 +257,7 @@ void ChTimestepperHHT::Advance(const double dt) {
                 throw std::runtime_error("HHT: Reached minimum allowable step size.");
             }
 
-            // force a matrix re-evaluation (due to change in stepsize)
-            call_setup = true;
+            // a matrix re-evaluation is forced by the change in stepsize
         }
 
         if (T >= tfinal) {
@@ -306,9 +344,6 @@ void ChTimestepperHHT::Increment(ChIntegrableIIorder* integrable2) {
     Anew += Da;
     Xnew = X + V * h + A * (h * h * (0.5 - beta)) + Anew * (h * h * beta);
     Vnew = V + A * (h * (1.0 - gamma)) + Anew * (h * gamma);
-
-    // If Setup was called at this iteration, mark the Newton matrix as up-to-date
-    matrix_is_current = call_setup;
 }
 
 // Convergence test
@@ -350,6 +385,14 @@ bool ChTimestepperHHT::CheckConvergence(int it) {
     return converged;
 }
 
+// Estimate the local truncation error in positions for the step just completed (Zienkiewicz & Xie, 1991):
+//    e = (beta - 1/6) * h^2 * (a_new - a_old)
+// and return its WRMS norm, with error weights based on the new positions.
+double ChTimestepperHHT::EstimateError() {
+    ChStateDelta err = (Anew - A) * ((beta - 1.0 / 6.0) * h * h);
+    return ErrorNorm(err, Xnew);
+}
+
 // Calculate the error weight vector corresponding to the specified solution vector x,
 // using the given relative and absolute tolerances.
 void ChTimestepperHHT::CalcErrorWeights(const ChVectorDynamic<>& x, double rtol, double atol, ChVectorDynamic<>& ewt) {
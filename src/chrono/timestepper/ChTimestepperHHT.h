@@ -45,14 +45,11 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     double GetAlpha() { return alpha; }
 
     /// Turn on/off the internal step size control.
+    /// This controls the step size based on the Newton iteration count and convergence failures only. For step size
+    /// control based on the local truncation error, see SetErrorControl.
     /// Default: true.
     void SetStepControl(bool enable) { step_control = enable; }
 
-    /// Set the minimum step size.
-    /// An exception is thrown if the internal step size decreases below this limit.
-    /// Default: 1e-10.
-    void SetMinStepSize(double step) { h_min = step; }
-
     /// Set the maximum allowable number of iterations for counting a step towards a stepsize increase.
     /// Default: 3.
     void SetMaxItersSuccess(int iters) { maxiters_success = iters; }
@@ -74,8 +71,11 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// If enabled, the Newton matrix is evaluated, assembled, and factorized only once
     /// per step or if the Newton iteration does not converge with an out-of-date matrix.
     /// If disabled, the Newton matrix is evaluated at every iteration of the nonlinear solver.
+    /// This is equivalent to SetJacobianUpdateMethod with EVERY_STEP (enabled) or EVERY_ITERATION (disabled).
     /// Default: true.
-    void SetModifiedNewton(bool enable) { modified_Newton = enable; }
+    void SetModifiedNewton(bool enable) {
+        jacobian_update = enable ? JacobianUpdate::EVERY_STEP : JacobianUpdate::EVERY_ITERATION;
+    }
 
     /// Perform an integration timestep, by advancing the state by the specified time step.
     virtual void Advance(const double dt) override;
@@ -95,6 +95,7 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     void Prepare(ChIntegrableIIorder* integrable2);
     void Increment(ChIntegrableIIorder* integrable2);
     bool CheckConvergence(int it);
+    double EstimateError();
     void CalcErrorWeights(const ChVectorDynamic<>& x, double rtol, double atol, ChVectorDynamic<>& ewt);
 
   private:
@@ -121,13 +122,9 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     unsigned int req_successful_steps;  ///< required number of successive successful steps for a stepsize increase
     double step_increase_factor;        ///< factor used in increasing stepsize (>1)
     double step_decrease_factor;        ///< factor used in decreasing stepsize (<1)
-    double h_min;                       ///< minimum allowable stepsize
-    double h;                           ///< internal stepsize
     unsigned int num_successful_steps;  ///< number of successful steps
 
-    bool modified_Newton;    ///< use modified Newton?
-    bool matrix_is_current;  ///< is the Newton matrix up-to-date?
-    bool call_setup;         ///< should the solver's Setup function be called?
+    bool call_setup;  ///< should the solver's Setup function be called?
 
     ChVectorDynamic<> ewtS;  ///< vector of error weights (states)
     ChVectorDynamic<> ewtL;  ///< vector of error weights (Lagrange multipliers)
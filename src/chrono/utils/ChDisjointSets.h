@@ -0,0 +1,76 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CH_DISJOINT_SETS_H
+#define CH_DISJOINT_SETS_H
+
+#include <numeric>
+#include <vector>
+
+namespace chrono {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Disjoint-set forest (union-find) over the integers 0...n-1.
+/// Uses union by size and path halving, for nearly constant amortized cost of Find and Union.
+class ChDisjointSets {
+  public:
+    ChDisjointSets() {}
+    ChDisjointSets(int n) { Reset(n); }
+
+    /// Reset to n singleton sets.
+    void Reset(int n) {
+        m_parent.resize(n);
+        std::iota(m_parent.begin(), m_parent.end(), 0);
+        m_size.assign(n, 1);
+    }
+
+    /// Return the number of elements.
+    int GetNumElements() const { return (int)m_parent.size(); }
+
+    /// Return the representative element of the set containing element i.
+    int Find(int i) {
+        while (m_parent[i] != i) {
+            m_parent[i] = m_parent[m_parent[i]];
+            i = m_parent[i];
+        }
+        return i;
+    }
+
+    /// Merge the sets containing elements i and j.
+    /// Return the representative of the merged set.
+    int Union(int i, int j) {
+        i = Find(i);
+        j = Find(j);
+        if (i == j)
+            return i;
+        if (m_size[i] < m_size[j])
+            std::swap(i, j);
+        m_parent[j] = i;
+        m_size[i] += m_size[j];
+        return i;
+    }
+
+    /// Return the number of elements in the set containing element i.
+    int GetSetSize(int i) { return m_size[Find(i)]; }
+
+  private:
+    std::vector<int> m_parent;
+    std::vector<int> m_size;
+};
+
+/// @} chrono_utils
+
+}  // end namespace chrono
+
+#endif
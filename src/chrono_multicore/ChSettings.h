@@ -45,7 +45,9 @@ class collision_settings {
           bin_size(real3(1, 1, 1)),
           grid_density(5),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
-          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
+          incremental_broadphase(false),
+          narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID),
+          deterministic_narrowphase(false) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
     /// large a value will slow down the narrowphase collision detection). The envelope is the amount by which each
@@ -78,14 +80,22 @@ class collision_settings {
     real3 bin_size;
 
     /// Broadphase collision grid density. This value is used for dynamic tuning of the number of collision bins if the
-    /// `broadphase_grid` type is set to FIXED_DENSITY.
+    /// `broadphase_grid` type is set to FIXED_DENSITY or ADAPTIVE.
     real grid_density;
 
+    /// Reuse the broadphase grid and bin lists across steps, updating only shapes that moved to different bins.
+    bool incremental_broadphase;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     ChNarrowphase::Algorithm narrowphase_algorithm;
+
+    /// Flag controlling deterministic generation of rigid-rigid contacts.
+    /// If enabled, the narrowphase generates contacts in canonical order (sorted by shape IDs), independent of the
+    /// number of threads, thus producing bitwise reproducible results.
+    bool deterministic_narrowphase;
 };
 
 /// Chrono::Multicore solver_settings.
@@ -104,6 +114,7 @@ class solver_settings {
         bilateral_clamp_speed = .6;
         clamp_bilaterals = true;
         compute_N = false;
+        matrix_free_schur = false;
         use_full_inertia_tensor = true;
         max_iteration = 100;
         max_iteration_normal = 0;
@@ -160,6 +171,12 @@ class solver_settings {
     /// It is possible to disable clamping for bilaterals entirely. When set to true
     /// bilateral_clamp_speed is ignored.
     bool clamp_bilaterals;
+    /// If true, the NSC solver does not assemble the rigid-rigid contact rows of the constraint Jacobian
+    /// (D_T, D, M_invD). The Schur complement product, the RHS, and the velocity update are instead computed
+    /// directly from per-contact Jacobian blocks. This reduces memory use for problems with many contacts.
+    /// Ignored if compute_N is set or if the solver type is JACOBI or GAUSS_SEIDEL (which require the assembled
+    /// Schur matrix).
+    bool matrix_free_schur;
     /// Experimental options that probably don't work for all solvers.
     bool update_rhs;
     bool compute_N;
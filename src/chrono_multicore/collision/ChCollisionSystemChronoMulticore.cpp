@@ -37,8 +37,9 @@ ChCollisionSystemChronoMulticore::ChCollisionSystemChronoMulticore(ChMulticoreDa
 ChCollisionSystemChronoMulticore::~ChCollisionSystemChronoMulticore() {}
 
 void ChCollisionSystemChronoMulticore::SetNumThreads(int nthreads) {
-    // Nothing to do here.
+    // Only cache the number of threads (for batched ray-hit tests).
     // The Chrono::Multicore collision system uses the number of threads set by ChSystemMulticore.
+    ChCollisionSystem::SetNumThreads(nthreads);
 }
 
 void ChCollisionSystemChronoMulticore::PreProcess() {
@@ -74,7 +75,9 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.incremental = settings.incremental_broadphase;
     narrowphase.algorithm = settings.narrowphase_algorithm;
+    narrowphase.deterministic = settings.deterministic_narrowphase;
 }
 
 void ChCollisionSystemChronoMulticore::PostProcess() {
@@ -32,7 +32,30 @@ using namespace chrono;
 // -----------------------------------------------------------------------------
 
 ChConstraintRigidRigid::ChConstraintRigidRigid()
-    : data_manager(nullptr), offset(3), inv_h(0), inv_hpa(0), inv_hhpa(0) {}
+    : data_manager(nullptr), offset(3), matrix_free(false), inv_h(0), inv_hpa(0), inv_hhpa(0) {}
+
+// Number of Jacobian rows per contact for the given solver mode.
+static inline int NumContactRows(SolverMode mode) {
+    switch (mode) {
+        case SolverMode::NORMAL:
+            return 1;
+        case SolverMode::SLIDING:
+            return 3;
+        case SolverMode::SPINNING:
+            return 6;
+        default:
+            return 0;
+    }
+}
+
+// Index of the k-th row of a contact (0: normal, 1-2: tangential, 3-5: spinning).
+static inline int ContactRow(int index, int k, int num_contacts) {
+    if (k == 0)
+        return index;
+    if (k < 3)
+        return num_contacts + index * 2 + (k - 1);
+    return 3 * num_contacts + index * 3 + (k - 3);
+}
 
 void ChConstraintRigidRigid::func_Project_normal(int index, const vec2* ids, const real* cohesion, real* gamma) {
     const auto num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
@@ -195,6 +218,11 @@ void ChConstraintRigidRigid::Setup(ChMulticoreDataManager* dm) {
     quat_a.resize(num_rigid_contacts);
     quat_b.resize(num_rigid_contacts);
 
+    if (matrix_free) {
+        jac_rot_a.resize(num_rigid_contacts * offset);
+        jac_rot_b.resize(num_rigid_contacts * offset);
+    }
+
     // Readability replacements
     auto& bids = data_manager->cd_data->bids_rigid_rigid;  // global IDs of bodies in contact
     auto& abody = data_manager->host_data.active_rigid;    // flags for active bodies
@@ -333,6 +361,25 @@ void ChConstraintRigidRigid::Build_s() {
 
     v_new = M_invk + M_invD * gamma;
 
+    if (matrix_free) {
+        const SolverMode solver_mode = data_manager->settings.solver.solver_mode;
+        DynamicVector<real> Dg(data_manager->num_dof, 0);
+        Dx(gamma, Dg, solver_mode);
+        v_new += data_manager->host_data.M_inv * Dg;
+
+        DynamicVector<real> D_Tv(3 * num_rigid_contacts, 0);
+        D_Tx(v_new, D_Tv, SolverMode::SLIDING);
+
+#pragma omp parallel for
+        for (int index = 0; index < (signed)num_rigid_contacts; index++) {
+            real fric = data_manager->host_data.fric_rigid_rigid[index].x;
+            real s_v = D_Tv[num_rigid_contacts + index * 2 + 0];
+            real s_w = D_Tv[num_rigid_contacts + index * 2 + 1];
+            data_manager->host_data.s[index * 1 + 0] = std::sqrt(s_v * s_v + s_w * s_w) * fric;
+        }
+        return;
+    }
+
 #pragma omp parallel for
     for (int index = 0; index < (signed)num_rigid_contacts; index++) {
         real fric = data_manager->host_data.fric_rigid_rigid[index].x;
@@ -442,8 +489,13 @@ void ChConstraintRigidRigid::Build_D() {
         real3 U_B = Rotate(U, q_b);
         T6 = Cross(U_B, sbar_b.v);
 
-        SetRow6Check(D_T, off + row * 1 + 0, body_id.x * 6, -U, T3);
-        SetRow6Check(D_T, off + row * 1 + 0, body_id.y * 6, U, -T6);
+        if (matrix_free) {
+            jac_rot_a[index * offset + 0] = T3;
+            jac_rot_b[index * offset + 0] = -T6;
+        } else {
+            SetRow6Check(D_T, off + row * 1 + 0, body_id.x * 6, -U, T3);
+            SetRow6Check(D_T, off + row * 1 + 0, body_id.y * 6, U, -T6);
+        }
 
         if (solver_mode == SolverMode::SLIDING || solver_mode == SolverMode::SPINNING) {
             off = num_rigid_contacts;
@@ -458,22 +510,38 @@ void ChConstraintRigidRigid::Build_D() {
             T7 = Cross(V_B, sbar_b.v);
             T8 = Cross(W_B, sbar_b.v);
 
-            SetRow6Check(D_T, off + row * 2 + 0, body_id.x * 6, -V, T4);
-            SetRow6Check(D_T, off + row * 2 + 1, body_id.x * 6, -W, T5);
+            if (matrix_free) {
+                jac_rot_a[index * offset + 1] = T4;
+                jac_rot_a[index * offset + 2] = T5;
+                jac_rot_b[index * offset + 1] = -T7;
+                jac_rot_b[index * offset + 2] = -T8;
+            } else {
+                SetRow6Check(D_T, off + row * 2 + 0, body_id.x * 6, -V, T4);
+                SetRow6Check(D_T, off + row * 2 + 1, body_id.x * 6, -W, T5);
 
-            SetRow6Check(D_T, off + row * 2 + 0, body_id.y * 6, V, -T7);
-            SetRow6Check(D_T, off + row * 2 + 1, body_id.y * 6, W, -T8);
+                SetRow6Check(D_T, off + row * 2 + 0, body_id.y * 6, V, -T7);
+                SetRow6Check(D_T, off + row * 2 + 1, body_id.y * 6, W, -T8);
+            }
 
             if (solver_mode == SolverMode::SPINNING) {
                 off = 3 * num_rigid_contacts;
 
-                SetRow3Check(D_T, off + row * 3 + 0, body_id.x * 6 + 3, -U_A);
-                SetRow3Check(D_T, off + row * 3 + 1, body_id.x * 6 + 3, -V_A);
-                SetRow3Check(D_T, off + row * 3 + 2, body_id.x * 6 + 3, -W_A);
-
-                SetRow3Check(D_T, off + row * 3 + 0, body_id.y * 6 + 3, U_B);
-                SetRow3Check(D_T, off + row * 3 + 1, body_id.y * 6 + 3, V_B);
-                SetRow3Check(D_T, off + row * 3 + 2, body_id.y * 6 + 3, W_B);
+                if (matrix_free) {
+                    jac_rot_a[index * offset + 3] = -U_A;
+                    jac_rot_a[index * offset + 4] = -V_A;
+                    jac_rot_a[index * offset + 5] = -W_A;
+                    jac_rot_b[index * offset + 3] = U_B;
+                    jac_rot_b[index * offset + 4] = V_B;
+                    jac_rot_b[index * offset + 5] = W_B;
+                } else {
+                    SetRow3Check(D_T, off + row * 3 + 0, body_id.x * 6 + 3, -U_A);
+                    SetRow3Check(D_T, off + row * 3 + 1, body_id.x * 6 + 3, -V_A);
+                    SetRow3Check(D_T, off + row * 3 + 2, body_id.x * 6 + 3, -W_A);
+
+                    SetRow3Check(D_T, off + row * 3 + 0, body_id.y * 6 + 3, U_B);
+                    SetRow3Check(D_T, off + row * 3 + 1, body_id.y * 6 + 3, V_B);
+                    SetRow3Check(D_T, off + row * 3 + 2, body_id.y * 6 + 3, W_B);
+                }
             }
         }
     }
@@ -489,6 +557,13 @@ void ChConstraintRigidRigid::GenerateSparsity() {
 
     CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
 
+    // In matrix-free mode, the contact rows are left empty
+    if (matrix_free) {
+        for (int row = 0; row < (signed)num_rigid_contacts * offset; row++)
+            D_T.finalize(row);
+        return;
+    }
+
     const vec2* ids = data_manager->cd_data->bids_rigid_rigid.data();
 
     for (int index = 0; index < (signed)num_rigid_contacts; index++) {
@@ -558,152 +633,90 @@ void ChConstraintRigidRigid::GenerateSparsity() {
     }
 }
 
-void ChConstraintRigidRigid::Dx(const DynamicVector<real>& gam, DynamicVector<real>& XYZUVW) {
-    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
-    real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
-    ////custom_vector<char>& active_rigid = data_manager->host_data.active_rigid;
-    ////vec2* bids_rigid_rigid = data_manager->host_data.bids_rigid_rigid.data();
+void ChConstraintRigidRigid::Dx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode) {
+    const auto num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+    const int num_rows = NumContactRows(mode);
 
-#pragma omp parallel for
-    for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-        const real3& U = real3(norm[i]);
-        real3 V, W;
-        Orthogonalize(U, V, W);
-        ////int id_a = bids_rigid_rigid[i].x;
-        ////int id_b = bids_rigid_rigid[i].y;
+    if (num_rigid_contacts <= 0 || num_rows == 0)
+        return;
 
-        real3 T3, T4, T5, T6, T7, T8;
-        real3 g = real3(gam[i], gam[num_rigid_contacts + i * 2 + 0], gam[num_rigid_contacts + i * 2 + 1]);
-        {
-            const real3_int& sbar = rotated_point_a[i];
-            const quaternion& q_a = quat_a[i];
-            T3 = Cross(Rotate(U, q_a), sbar.v);
-            T4 = Cross(Rotate(V, q_a), sbar.v);
-            T5 = Cross(Rotate(W, q_a), sbar.v);
+    const real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
 
-            ////if (active_rigid[id_a] != 0)
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_rigid_contacts; index++) {
+        real3 dir[3];
+        dir[0] = norm[index];
+        Orthogonalize(dir[0], dir[1], dir[2]);
+
+        real3 force(0);
+        real3 torque_a(0);
+        real3 torque_b(0);
+        for (int k = 0; k < num_rows; k++) {
+            real g = x[ContactRow(index, k, num_rigid_contacts)];
+            if (k < 3)
+                force += dir[k] * g;
+            torque_a += jac_rot_a[index * offset + k] * g;
+            torque_b += jac_rot_b[index * offset + k] * g;
+        }
 
-            real3 res = -U * g.x - V * g.y - W * g.z;
+        int id_a = rotated_point_a[index].i * 6;
+        int id_b = rotated_point_b[index].i * 6;
 
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 0] += res.x;
+        output[id_a + 0] -= force.x;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 1] += res.y;
+        output[id_a + 1] -= force.y;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 2] += res.z;
-
-            res = T3 * g.x + T4 * g.y + T5 * g.z;
-
+        output[id_a + 2] -= force.z;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 3] += res.x;
+        output[id_a + 3] += torque_a.x;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 4] += res.y;
+        output[id_a + 4] += torque_a.y;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 5] += res.z;
-        }
-
-        {
-            const real3_int& sbar = rotated_point_b[i];
-            const quaternion& q_b = quat_b[i];
-            T6 = Cross(Rotate(U, q_b), sbar.v);
-            T7 = Cross(Rotate(V, q_b), sbar.v);
-            T8 = Cross(Rotate(W, q_b), sbar.v);
-
-            // if (active_rigid[id_b] != 0)
-
-            real3 res = U * g.x + V * g.y + W * g.z;
+        output[id_a + 5] += torque_a.z;
 
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 0] += res.x;
+        output[id_b + 0] += force.x;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 1] += res.y;
+        output[id_b + 1] += force.y;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 2] += res.z;
-
-            res = -T6 * g.x - T7 * g.y - T8 * g.z;
-
+        output[id_b + 2] += force.z;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 3] += res.x;
+        output[id_b + 3] += torque_b.x;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 4] += res.y;
+        output[id_b + 4] += torque_b.y;
 #pragma omp atomic
-            XYZUVW[sbar.i * 6 + 5] += res.z;
-        }
+        output[id_b + 5] += torque_b.z;
     }
 }
 
-void ChConstraintRigidRigid::D_Tx(const DynamicVector<real>& XYZUVW, DynamicVector<real>& out_vector) {
-    const auto num_rigid_contacts = data_manager->cd_data->num_rigid_contacts;
-    real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
-    ////custom_vector<char>& active_rigid = data_manager->host_data.active_rigid;
-    ////real3* ptA = data_manager->cd_data->cpta_rigid_rigid.data();
-    ////real3* ptB = data_manager->cd_data->cptb_rigid_rigid.data();
-    ////vec2* bids_rigid_rigid = data_manager->cd_data->bids_rigid_rigid.data();
-    ////real3* pos = data_manager->host_data.pos_rigid.data();
-    ////quaternion* rot = data_manager->host_data.rot_rigid.data();
-
-#pragma omp parallel for
-    for (int i = 0; i < (signed)num_rigid_contacts; i++) {
-        const real3& U = real3(norm[i]);
-        real3 V, W;
-        Orthogonalize(U, V, W);
-        real temp[3] = {0, 0, 0};
-
-        ////real3 pA = ptA[i];
-        ////int id_a = bids_rigid_rigid[i].x;
-        ////if (active_rigid[id_a] != 0)
-        {
-            const real3_int& sbar = rotated_point_a[i];
-            const quaternion& quaternion_conjugate = quat_a[i];
-
-            real3 XYZ(XYZUVW[sbar.i * 6 + 0], XYZUVW[sbar.i * 6 + 1], XYZUVW[sbar.i * 6 + 2]);
-            real3 UVW(XYZUVW[sbar.i * 6 + 3], XYZUVW[sbar.i * 6 + 4], XYZUVW[sbar.i * 6 + 5]);
-
-            real3 T1 = Cross(Rotate(U, quaternion_conjugate), sbar.v);
-            real3 T2 = Cross(Rotate(V, quaternion_conjugate), sbar.v);
-            real3 T3 = Cross(Rotate(W, quaternion_conjugate), sbar.v);
-
-            temp[0] = Dot(XYZ, -U) + Dot(UVW, T1);
-            temp[1] = Dot(XYZ, -V) + Dot(UVW, T2);
-            temp[2] = Dot(XYZ, -W) + Dot(UVW, T3);
-
-            ////Jacobian<false>(rot[id_a], U, V, W, ptA[i] - pos[id_a], &XYZUVW[id_a * 6 + 0], temp);
-        }
-
-        ////real3 pB = ptB[i];
-        ////int id_b = bids_rigid_rigid[i].y;
-        ////if (active_rigid[id_b] != 0)
-        {
-            const real3_int& sbar = rotated_point_b[i];
-            const quaternion& quaternion_conjugate = quat_b[i];
+void ChConstraintRigidRigid::D_Tx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode) {
+    const auto num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+    const int num_rows = NumContactRows(mode);
 
-            real3 XYZ(XYZUVW[sbar.i * 6 + 0], XYZUVW[sbar.i * 6 + 1], XYZUVW[sbar.i * 6 + 2]);
-            real3 UVW(XYZUVW[sbar.i * 6 + 3], XYZUVW[sbar.i * 6 + 4], XYZUVW[sbar.i * 6 + 5]);
+    if (num_rigid_contacts <= 0 || num_rows == 0)
+        return;
 
-            real3 T1 = Cross(Rotate(U, quaternion_conjugate), sbar.v);
-            real3 T2 = Cross(Rotate(V, quaternion_conjugate), sbar.v);
-            real3 T3 = Cross(Rotate(W, quaternion_conjugate), sbar.v);
+    const real3* norm = data_manager->cd_data->norm_rigid_rigid.data();
 
-            temp[0] += Dot(XYZ, U) + Dot(UVW, -T1);
-            temp[1] += Dot(XYZ, V) + Dot(UVW, -T2);
-            temp[2] += Dot(XYZ, W) + Dot(UVW, -T3);
+#pragma omp parallel for
+    for (int index = 0; index < (signed)num_rigid_contacts; index++) {
+        real3 dir[3];
+        dir[0] = norm[index];
+        Orthogonalize(dir[0], dir[1], dir[2]);
+
+        int id_a = rotated_point_a[index].i * 6;
+        int id_b = rotated_point_b[index].i * 6;
+
+        real3 v_rel(x[id_b + 0] - x[id_a + 0], x[id_b + 1] - x[id_a + 1], x[id_b + 2] - x[id_a + 2]);
+        real3 omega_a(x[id_a + 3], x[id_a + 4], x[id_a + 5]);
+        real3 omega_b(x[id_b + 3], x[id_b + 4], x[id_b + 5]);
+
+        for (int k = 0; k < num_rows; k++) {
+            real val = Dot(omega_a, jac_rot_a[index * offset + k]) + Dot(omega_b, jac_rot_b[index * offset + k]);
+            if (k < 3)
+                val += Dot(v_rel, dir[k]);
+            output[ContactRow(index, k, num_rigid_contacts)] += val;
         }
-
-        out_vector[i] = temp[0];
-        out_vector[num_rigid_contacts + i * 2 + 0] = temp[1];
-        out_vector[num_rigid_contacts + i * 2 + 1] = temp[2];
-
-        //            out_vector[CONTACT + 3] = temp[3];
-        //            out_vector[CONTACT + 4] = temp[4];
-        //            out_vector[CONTACT + 5] = temp[5];
     }
-
-    //    // data_manager->PrintMatrix(data_manager->host_data.D);
-
-    //    DynamicVector<real> compare =
-    //            data_manager->host_data.D_T * data_manager->host_data.D * data_manager->host_data.gamma;
-    //    std::cout << "nconstr " << compare.size() << std::endl;
-    //    for (int i = 0; i < compare.size(); i++) {
-    //        std::cout << compare[i] << " " << out_vector[i] << std::endl;
-    //    }
 }
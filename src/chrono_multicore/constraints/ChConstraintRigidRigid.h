@@ -39,8 +39,13 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     void func_Project_normal(int index, const vec2* ids, const real* cohesion, real* gam);
     void func_Project_sliding(int index, const vec2* ids, const real3* fric, const real* cohesion, real* gam);
     void func_Project_spinning(int index, const vec2* ids, const real3* fric, real* gam);
-    void Dx(const DynamicVector<real>& x, DynamicVector<real>& output);
-    void D_Tx(const DynamicVector<real>& x, DynamicVector<real>& output);
+
+    /// Accumulate the generalized forces D * x of the contact rows active in the given solver mode.
+    /// Only available if the Jacobian blocks were computed in matrix-free mode (see Build_D).
+    void Dx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode);
+    /// Accumulate the products D_T * x into the contact rows active in the given solver mode.
+    /// Only available if the Jacobian blocks were computed in matrix-free mode (see Build_D).
+    void D_Tx(const DynamicVector<real>& x, DynamicVector<real>& output, SolverMode mode);
 
     /// Compute the vector of corrections.
     void Build_b();
@@ -48,6 +53,7 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     void Build_E();
     /// Compute the jacobian matrix, no allocation is performed here,
     /// GenerateSparsity should take care of that.
+    /// In matrix-free mode, only the per-contact Jacobian blocks are computed.
     void Build_D();
     void Build_s();
     /// Fill-in the non zero entries in the bilateral jacobian with ones.
@@ -55,6 +61,7 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     void GenerateSparsity();
 
     int offset;
+    bool matrix_free;  ///< if true, the contact rows are not assembled in D_T (see solver_settings::matrix_free_schur)
 
   protected:
     custom_vector<bool2> contact_active_pairs;
@@ -66,6 +73,10 @@ class CH_MULTICORE_API ChConstraintRigidRigid {
     custom_vector<real3_int> rotated_point_a, rotated_point_b;
     custom_vector<quaternion> quat_a, quat_b;
 
+    /// Rotational Jacobian blocks of each contact (matrix-free mode), in body frames.
+    /// For each contact, 'offset' entries: normal, two tangential, then three spinning directions.
+    custom_vector<real3> jac_rot_a, jac_rot_b;
+
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager
 };
 
@@ -107,6 +107,14 @@ void ChSystemMulticoreNSC::CalculateContactForces() {
         return;
     }
 
+    if (data_manager->rigid_rigid->matrix_free) {
+        Fc.resize(num_rigid_dof);
+        Fc = 0;
+        data_manager->rigid_rigid->Dx(data_manager->host_data.gamma, Fc, data_manager->settings.solver.solver_mode);
+        Fc /= data_manager->settings.step_size;
+        return;
+    }
+
     const SubMatrixType& D_u = blaze::submatrix(data_manager->host_data.D, 0, 0, num_rigid_dof, num_unilaterals);
     DynamicVector<real> gamma_u = blaze::subvector(data_manager->host_data.gamma, 0, num_unilaterals);
     Fc = D_u * gamma_u / data_manager->settings.step_size;
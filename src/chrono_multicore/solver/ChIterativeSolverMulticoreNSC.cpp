@@ -46,6 +46,12 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
         data_manager->num_unilaterals = 6 * num_rigid_contacts;
     }
 
+    // Matrix-free contact rows are not supported by solvers which require the assembled Schur matrix
+    data_manager->rigid_rigid->matrix_free = data_manager->settings.solver.matrix_free_schur &&
+                                             !data_manager->settings.solver.compute_N &&
+                                             data_manager->settings.solver.solver_type != SolverType::JACOBI &&
+                                             data_manager->settings.solver.solver_type != SolverType::GAUSS_SEIDEL;
+
     uint num_3dof_3dof = data_manager->node_container->GetNumConstraints();
 
     // Get the number of 3dof constraints, from the 3dof container in use right now
@@ -95,6 +101,13 @@ void ChIterativeSolverMulticoreNSC::RunTimeStep() {
             -data_manager->host_data.b -
             data_manager->host_data.D_T *
                 (data_manager->host_data.v + data_manager->host_data.M_inv * data_manager->host_data.hf);
+
+        if (data_manager->rigid_rigid->matrix_free) {
+            DynamicVector<real> v_neg =
+                -(data_manager->host_data.v + data_manager->host_data.M_inv * data_manager->host_data.hf);
+            data_manager->rigid_rigid->D_Tx(v_neg, data_manager->host_data.R_full,
+                                            data_manager->settings.solver.solver_mode);
+        }
     }
     SchurProductFull.Setup(data_manager);
     SchurProductBilateral.Setup(data_manager);
@@ -196,9 +209,11 @@ void ChIterativeSolverMulticoreNSC::ComputeD() {
     uint num_bilaterals = data_manager->num_bilaterals;
     uint nnz_bilaterals = data_manager->nnz_bilaterals;
 
-    int nnz_normal = 6 * 2 * num_rigid_contacts;
-    int nnz_tangential = 6 * 4 * num_rigid_contacts;
-    int nnz_spinning = 6 * 3 * num_rigid_contacts;
+    // Contact rows are left empty in matrix-free mode
+    uint nnz_contacts = data_manager->rigid_rigid->matrix_free ? 0 : num_rigid_contacts;
+    int nnz_normal = 6 * 2 * nnz_contacts;
+    int nnz_tangential = 6 * 4 * nnz_contacts;
+    int nnz_spinning = 6 * 3 * nnz_contacts;
 
     int num_normal = 1 * num_rigid_contacts;
     int num_tangential = 2 * num_rigid_contacts;
@@ -376,6 +391,12 @@ void ChIterativeSolverMulticoreNSC::ComputeImpulses() {
     if (data_manager->num_constraints > 0) {
         // Compute new velocity based on the lagrange multipliers
         v = v + M_inv * hf + data_manager->host_data.M_invD * gamma;
+
+        if (data_manager->rigid_rigid->matrix_free) {
+            DynamicVector<real> Dgamma(data_manager->num_dof, 0);
+            data_manager->rigid_rigid->Dx(gamma, Dgamma, data_manager->settings.solver.solver_mode);
+            v += M_inv * Dgamma;
+        }
     } else {
         // When there are no constraints we need to still apply gravity and other
         // body forces!
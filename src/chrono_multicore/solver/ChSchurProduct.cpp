@@ -29,6 +29,12 @@ void ChSchurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real
     uint num_bilaterals = data_manager->num_bilaterals;
     output.reset();
 
+    if (data_manager->rigid_rigid->matrix_free) {
+        MatrixFreeProduct(x, output);
+        data_manager->system_timer.stop("SchurProduct");
+        return;
+    }
+
     const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
     const CompressedMatrix<real>& Nschur = data_manager->host_data.Nschur;
 
@@ -103,6 +109,61 @@ void ChSchurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real
     data_manager->system_timer.stop("SchurProduct");
 }
 
+// The rigid-rigid contact rows are not assembled in D_T and M_invD. Their contribution to the generalized
+// impulses is scattered from the per-contact Jacobian blocks, the combined impulses are multiplied by M_inv,
+// and the resulting velocities are gathered back to the contact rows.
+void ChSchurProduct::MatrixFreeProduct(const DynamicVector<real>& x, DynamicVector<real>& output) {
+    const DynamicVector<real>& E = data_manager->host_data.E;
+    const CompressedMatrix<real>& D_T = data_manager->host_data.D_T;
+    const CompressedMatrix<real>& M_inv = data_manager->host_data.M_inv;
+    ChConstraintRigidRigid* rigid_rigid = data_manager->rigid_rigid;
+
+    uint num_rigid_contacts = data_manager->cd_data ? data_manager->cd_data->num_rigid_contacts : 0;
+    uint num_unilaterals = data_manager->num_unilaterals;
+    uint num_bilaterals = data_manager->num_bilaterals;
+    SolverMode mode = data_manager->settings.solver.local_solver_mode;
+
+    tmp_dof.resize(data_manager->num_dof);
+    reset(tmp_dof);
+    rigid_rigid->Dx(x, tmp_dof, mode);
+
+    if (mode == data_manager->settings.solver.solver_mode) {
+        tmp_dof = data_manager->host_data.M_invD * x + M_inv * tmp_dof;
+        output = D_T * tmp_dof + E * x;
+    } else {
+        const SubMatrixType& D_b_T = _DBT_;
+        const SubMatrixType& M_invD_b = _MINVDB_;
+        uint num_dof_b = _num_rigid_dof_ + _num_shaft_dof_ + _num_motor_dof_;
+
+        SubVectorType o_b = subvector(output, num_unilaterals, num_bilaterals);
+        ConstSubVectorType x_b = subvector(x, num_unilaterals, num_bilaterals);
+        ConstSubVectorType E_b = subvector(E, num_unilaterals, num_bilaterals);
+
+        tmp_dof = M_inv * tmp_dof;
+        SubVectorType tmp_b = subvector(tmp_dof, 0, num_dof_b);
+        tmp_b += M_invD_b * x_b;
+        o_b = D_b_T * tmp_b + E_b * x_b;
+
+        uint num_rows = 0;
+        switch (mode) {
+            case SolverMode::NORMAL:
+                num_rows = num_rigid_contacts;
+                break;
+            case SolverMode::SLIDING:
+                num_rows = 3 * num_rigid_contacts;
+                break;
+            case SolverMode::SPINNING:
+                num_rows = 6 * num_rigid_contacts;
+                break;
+            default:
+                break;
+        }
+        subvector(output, 0, num_rows) = subvector(E, 0, num_rows) * subvector(x, 0, num_rows);
+    }
+
+    rigid_rigid->D_Tx(tmp_dof, output, mode);
+}
+
 void ChSchurProductBilateral::Setup(ChMulticoreDataManager* data_container_) {
     ChSchurProduct::Setup(data_container_);
     if (data_manager->num_bilaterals == 0) {
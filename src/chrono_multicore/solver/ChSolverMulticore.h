@@ -66,6 +66,12 @@ class CH_MULTICORE_API ChSchurProduct {
     virtual void operator()(const DynamicVector<real>& x, DynamicVector<real>& AX);
 
     ChMulticoreDataManager* data_manager;  ///< Pointer to the system's data manager
+
+  private:
+    /// Schur product with the rigid-rigid contact rows computed matrix-free.
+    void MatrixFreeProduct(const DynamicVector<real>& x, DynamicVector<real>& output);
+
+    DynamicVector<real> tmp_dof;  ///< generalized impulses (matrix-free product)
 };
 
 /// Functor class for performing the Schur product of the matrix of bilateral constraints.
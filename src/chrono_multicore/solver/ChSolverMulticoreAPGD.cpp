@@ -51,6 +51,13 @@ void ChSolverMulticoreAPGD::UpdateR() {
     SubVectorType R_n = blaze::subvector(R, 0, num_contacts);
     SubVectorType s_n = blaze::subvector(s, 0, num_contacts);
 
+    if (rigid_rigid->matrix_free) {
+        R_n = -b_n + s_n;
+        DynamicVector<real> M_invk_neg = -M_invk;
+        rigid_rigid->D_Tx(M_invk_neg, R, SolverMode::NORMAL);
+        return;
+    }
+
     R_n = -b_n - D_n_T * M_invk + s_n;
 }
 
@@ -21,8 +21,13 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(unsigned int num_threads) {
     mkl_set_num_threads(num_threads);
 }
 
+bool ChSolverPardisoMKL::AnalyzeMatrix() {
+    m_engine.analyzePattern(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
 bool ChSolverPardisoMKL::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -65,7 +65,13 @@ class ChApiPardisoMKL ChSolverPardisoMKL : public ChDirectSolverLS {
     Eigen::PardisoLU<ChSparseMatrix>& GetMklEngine() { return m_engine; }
 
   private:
-    /// Factorize the current sparse matrix and return true if successful.
+    /// Pardiso separates symbolic analysis (reordering) and numeric factorization.
+    virtual bool SupportsSymbolicReuse() const override { return true; }
+
+    /// Perform the symbolic analysis (reordering and symbolic factorization) of the current sparse matrix.
+    virtual bool AnalyzeMatrix() override;
+
+    /// Numerically factorize the current sparse matrix and return true if successful.
     virtual bool FactorizeMatrix() override;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
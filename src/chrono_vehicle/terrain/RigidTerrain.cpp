@@ -27,6 +27,7 @@
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
 #include "chrono/physics/ChContactMaterialNSC.h"
 #include "chrono/physics/ChContactMaterialSMC.h"
+#include "chrono/utils/ChUtils.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
@@ -50,6 +51,7 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_height_grid(false),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {}
@@ -61,6 +63,7 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_use_height_grid(false),
       m_contact_callback(nullptr),
       m_collision_family(14),
       m_initialized(false) {
@@ -177,6 +180,8 @@ void RigidTerrain::AddPatch(std::shared_ptr<Patch> patch,
 
 void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
     // Initialize the patch
+    if (auto mesh_patch = std::dynamic_pointer_cast<MeshPatch>(patch))
+        mesh_patch->m_use_grid = m_use_height_grid;
     patch->Initialize();
 
     // All patches are added to the same collision family and collision with other models in this family is disabled
@@ -967,6 +972,9 @@ void RigidTerrain::MeshPatch::Initialize() {
         trimesh_shape->SetMesh(m_trimesh, true);
         m_body->AddVisualShape(trimesh_shape);
     }
+
+    if (m_use_grid)
+        m_grid.Build(*m_trimesh, m_body->GetFrameRefToAbs());
 }
 
 // -----------------------------------------------------------------------------
@@ -1075,6 +1083,23 @@ void RigidTerrain::GetProperties(const ChVector3d& loc, double& height, ChVector
         friction = (*m_friction_fun)(loc);
 }
 
+void RigidTerrain::GetProperties(const std::vector<ChVector3d>& locs,
+                                 std::vector<double>& heights,
+                                 std::vector<ChVector3d>& normals,
+                                 std::vector<float>& frictions) const {
+    int num_locs = (int)locs.size();
+    heights.resize(num_locs);
+    normals.resize(num_locs);
+    frictions.resize(num_locs);
+
+    int nthreads = m_system->GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < num_locs; i++) {
+        GetProperties(locs[i], heights[i], normals[i], frictions[i]);
+    }
+}
+
 bool RigidTerrain::FindPoint(const ChVector3d loc, double& height, ChVector3d& normal, float& friction) const {
     bool hit = false;
     height = std::numeric_limits<double>::lowest();
@@ -1113,6 +1138,9 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    if (m_use_grid)
+        return m_grid.FindPoint(loc, height, normal);
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -1124,6 +1152,146 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Height grid for mesh patches.
+// Each triangle is inserted in all grid cells overlapped by the bounding box of its footprint. A query visits the
+// triangles in the cell containing the location, finds those whose footprint contains it, and keeps the highest
+// intersection below the location (the same point found by casting a ray vertically downward).
+// -----------------------------------------------------------------------------
+
+void RigidTerrain::HeightGrid::Build(const ChTriangleMeshConnected& trimesh, const ChFrame<>& frame) {
+    const auto& vertices = trimesh.GetCoordsVertices();
+    const auto& indices = trimesh.GetIndicesVertexes();
+
+    m_triangles.clear();
+    m_triangles.reserve(indices.size());
+
+    // Express the mesh triangles in the ISO world frame, discarding vertical triangles (never hit by vertical rays)
+    double xmin = std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymax = std::numeric_limits<double>::lowest();
+    double size = 0;
+    for (const auto& idx : indices) {
+        Triangle tri;
+        for (int k = 0; k < 3; k++)
+            tri.v[k] = ChWorldFrame::ToISO(frame.TransformPointLocalToParent(vertices[idx[k]]));
+        ChVector3d n = Vcross(tri.v[1] - tri.v[0], tri.v[2] - tri.v[0]);
+        double len = n.Length();
+        if (len == 0 || std::abs(n.z()) < 1e-10 * len)
+            continue;
+        tri.n = (n.z() > 0 ? 1 / len : -1 / len) * n;
+        tri.normal = ChWorldFrame::FromISO(tri.n);
+
+        double txmin = std::min({tri.v[0].x(), tri.v[1].x(), tri.v[2].x()});
+        double tymin = std::min({tri.v[0].y(), tri.v[1].y(), tri.v[2].y()});
+        double txmax = std::max({tri.v[0].x(), tri.v[1].x(), tri.v[2].x()});
+        double tymax = std::max({tri.v[0].y(), tri.v[1].y(), tri.v[2].y()});
+        xmin = std::min(xmin, txmin);
+        ymin = std::min(ymin, tymin);
+        xmax = std::max(xmax, txmax);
+        ymax = std::max(ymax, tymax);
+        size += std::max(txmax - txmin, tymax - tymin);
+
+        m_triangles.push_back(tri);
+    }
+
+    int num_triangles = (int)m_triangles.size();
+    if (num_triangles == 0) {
+        m_nx = 0;
+        m_ny = 0;
+        m_cell_start.assign(1, 0);
+        m_cell_triangles.clear();
+        return;
+    }
+
+    // Set the cell size to the average triangle footprint, but limit the number of cells to a multiple of the number
+    // of triangles
+    m_delta = std::max(size / num_triangles, 1e-6);
+    double area = (xmax - xmin) * (ymax - ymin);
+    if (area > 4.0 * num_triangles * m_delta * m_delta)
+        m_delta = std::sqrt(area / (4.0 * num_triangles));
+
+    m_xmin = xmin;
+    m_ymin = ymin;
+    m_nx = std::max(1, (int)std::ceil((xmax - xmin) / m_delta));
+    m_ny = std::max(1, (int)std::ceil((ymax - ymin) / m_delta));
+
+    auto cell_range = [this](const Triangle& tri, int& ix1, int& iy1, int& ix2, int& iy2) {
+        double txmin = std::min({tri.v[0].x(), tri.v[1].x(), tri.v[2].x()});
+        double tymin = std::min({tri.v[0].y(), tri.v[1].y(), tri.v[2].y()});
+        double txmax = std::max({tri.v[0].x(), tri.v[1].x(), tri.v[2].x()});
+        double tymax = std::max({tri.v[0].y(), tri.v[1].y(), tri.v[2].y()});
+        ix1 = ChClamp((int)std::floor((txmin - m_xmin) / m_delta), 0, m_nx - 1);
+        iy1 = ChClamp((int)std::floor((tymin - m_ymin) / m_delta), 0, m_ny - 1);
+        ix2 = ChClamp((int)std::floor((txmax - m_xmin) / m_delta), 0, m_nx - 1);
+        iy2 = ChClamp((int)std::floor((tymax - m_ymin) / m_delta), 0, m_ny - 1);
+    };
+
+    // Count the triangles in each cell, then fill the cell lists
+    m_cell_start.assign(m_nx * m_ny + 1, 0);
+    for (const auto& tri : m_triangles) {
+        int ix1, iy1, ix2, iy2;
+        cell_range(tri, ix1, iy1, ix2, iy2);
+        for (int iy = iy1; iy <= iy2; iy++)
+            for (int ix = ix1; ix <= ix2; ix++)
+                m_cell_start[iy * m_nx + ix + 1]++;
+    }
+    for (int c = 0; c < m_nx * m_ny; c++)
+        m_cell_start[c + 1] += m_cell_start[c];
+
+    m_cell_triangles.resize(m_cell_start.back());
+    std::vector<int> cell_fill(m_cell_start.begin(), m_cell_start.end() - 1);
+    for (int it = 0; it < num_triangles; it++) {
+        int ix1, iy1, ix2, iy2;
+        cell_range(m_triangles[it], ix1, iy1, ix2, iy2);
+        for (int iy = iy1; iy <= iy2; iy++)
+            for (int ix = ix1; ix <= ix2; ix++)
+                m_cell_triangles[cell_fill[iy * m_nx + ix]++] = it;
+    }
+}
+
+bool RigidTerrain::HeightGrid::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    bool hit = false;
+    height = std::numeric_limits<double>::lowest();
+    normal = ChWorldFrame::Vertical();
+
+    if (m_nx == 0)
+        return false;
+
+    ChVector3d p = ChWorldFrame::ToISO(loc);
+    int ix = (int)std::floor((p.x() - m_xmin) / m_delta);
+    int iy = (int)std::floor((p.y() - m_ymin) / m_delta);
+    if (ix < 0 || ix >= m_nx || iy < 0 || iy >= m_ny)
+        return false;
+
+    int c = iy * m_nx + ix;
+    for (int i = m_cell_start[c]; i < m_cell_start[c + 1]; i++) {
+        const auto& tri = m_triangles[m_cell_triangles[i]];
+
+        // Check if the footprint of the triangle contains the location (with a small tolerance to avoid gaps at the
+        // edges shared by adjacent triangles)
+        double d0 = (tri.v[1].x() - p.x()) * (tri.v[2].y() - p.y()) - (tri.v[2].x() - p.x()) * (tri.v[1].y() - p.y());
+        double d1 = (tri.v[2].x() - p.x()) * (tri.v[0].y() - p.y()) - (tri.v[0].x() - p.x()) * (tri.v[2].y() - p.y());
+        double d2 = (tri.v[0].x() - p.x()) * (tri.v[1].y() - p.y()) - (tri.v[1].x() - p.x()) * (tri.v[0].y() - p.y());
+        double tol = 1e-12 * std::abs(d0 + d1 + d2);
+        bool inside = (d0 >= -tol && d1 >= -tol && d2 >= -tol) || (d0 <= tol && d1 <= tol && d2 <= tol);
+        if (!inside)
+            continue;
+
+        // Intersect the vertical line through the location with the triangle plane
+        double z = tri.v[0].z() -
+                   (tri.n.x() * (p.x() - tri.v[0].x()) + tri.n.y() * (p.y() - tri.v[0].y())) / tri.n.z();
+        if (z <= p.z() && z > height) {
+            hit = true;
+            height = z;
+            normal = tri.normal;
+        }
+    }
+
+    return hit;
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
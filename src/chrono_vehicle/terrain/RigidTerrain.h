@@ -184,6 +184,14 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable use of a height grid for terrain queries on mesh and height-map patches.
+    /// If enabled, a regular grid of triangle bins (over the horizontal plane of the world frame) is built for each
+    /// such patch at initialization and used to find the terrain height and normal below a given location, without
+    /// casting rays into the collision system. This assumes that patches do not move after initialization (the grid is
+    /// not updated if a patch body is moved). By default, this option is disabled. This function must be called before
+    /// Initialize.
+    void UseHeightGrid(bool val) { m_use_height_grid = val; }
+
     /// Get the terrain height below the specified location.
     /// This function should return the height of the closest point *below* the specified location (in the direction of
     /// the current world vertical). If a user-provided functor object of type ChTerrain::HeightFunctor is provided,
@@ -217,6 +225,14 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector3d& normal,
                                float& friction) const override;
 
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// This is equivalent to calling GetProperties for each location, with the queries distributed over the number of
+    /// threads set for the Chrono system. Any user-provided functors must therefore be thread safe.
+    void GetProperties(const std::vector<ChVector3d>& locs,
+                       std::vector<double>& heights,
+                       std::vector<ChVector3d>& normals,
+                       std::vector<float>& frictions) const;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -234,6 +250,31 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     void SetCollisionFamily(int family) { m_collision_family = family; }
 
   private:
+    /// Regular grid of triangle bins, for height and normal queries on a triangle mesh.
+    /// Triangles are binned by their footprint in the horizontal plane of the ISO world frame.
+    class CH_VEHICLE_API HeightGrid {
+      public:
+        /// Build the grid for the given mesh, with vertices expressed in the specified frame.
+        void Build(const ChTriangleMeshConnected& trimesh, const ChFrame<>& frame);
+
+        /// Find the highest point of the mesh below the specified location.
+        bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const;
+
+      private:
+        struct Triangle {
+            ChVector3d v[3];    ///< vertices, in the ISO world frame
+            ChVector3d n;       ///< upward normal, in the ISO world frame
+            ChVector3d normal;  ///< upward normal, in the world frame
+        };
+
+        std::vector<Triangle> m_triangles;    ///< non-vertical triangles of the mesh
+        std::vector<int> m_cell_start;        ///< start of the triangle list of each cell (size nx*ny+1)
+        std::vector<int> m_cell_triangles;    ///< triangle indices, sorted by cell
+        double m_xmin, m_ymin;                ///< grid origin
+        double m_delta;                       ///< cell size
+        int m_nx, m_ny;                       ///< number of cells in each direction
+    };
+
     /// Patch represented as a box domain.
     struct CH_VEHICLE_API BoxPatch : public Patch {
         ChVector3d m_location;  ///< center of top surface
@@ -250,6 +291,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+        bool m_use_grid;                                     ///< use the height grid for terrain queries?
+        HeightGrid m_grid;                                   ///< height grid for terrain queries
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
@@ -260,6 +303,7 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    bool m_use_height_grid;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
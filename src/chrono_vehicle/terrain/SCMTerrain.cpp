@@ -17,6 +17,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <queue>
@@ -363,6 +364,134 @@ SCMContactableData::SCMContactableData(double area_ratio,
       Mohr_mu(std::tan(Mohr_friction * CH_DEG_TO_RAD)),
       Janosi_shear(Janosi_shear) {}
 
+// -----------------------------------------------------------------------------
+// Implementation of the sparse tiled grid of node records
+// -----------------------------------------------------------------------------
+
+SCMLoader::NodeGrid::Tile::Tile() {
+    std::fill(std::begin(recorded), std::end(recorded), false);
+}
+
+SCMLoader::NodeGrid::NodeGrid() : m_tile0_x(0), m_tile0_y(0), m_ntiles_x(0), m_ntiles_y(0) {}
+
+SCMLoader::NodeGrid::~NodeGrid() {
+    for (int k = 0; k < m_ntiles_x * m_ntiles_y; k++)
+        delete m_tiles[k].load();
+}
+
+void SCMLoader::NodeGrid::Reserve(const ChVector2i& ij_min, const ChVector2i& ij_max) {
+    // Range of tile coordinates (arithmetic shift rounds towards negative infinity)
+    int tx1 = ij_min.x() >> TILE_BITS;
+    int ty1 = ij_min.y() >> TILE_BITS;
+    int tx2 = ij_max.x() >> TILE_BITS;
+    int ty2 = ij_max.y() >> TILE_BITS;
+
+    if (m_ntiles_x > 0) {
+        if (tx1 >= m_tile0_x && ty1 >= m_tile0_y && tx2 < m_tile0_x + m_ntiles_x && ty2 < m_tile0_y + m_ntiles_y)
+            return;
+        tx1 = std::min(tx1, m_tile0_x);
+        ty1 = std::min(ty1, m_tile0_y);
+        tx2 = std::max(tx2, m_tile0_x + m_ntiles_x - 1);
+        ty2 = std::max(ty2, m_tile0_y + m_ntiles_y - 1);
+    }
+
+    // Allocate the new directory and move the existing tiles
+    int ntx = tx2 - tx1 + 1;
+    int nty = ty2 - ty1 + 1;
+    std::unique_ptr<std::atomic<Tile*>[]> tiles(new std::atomic<Tile*>[ntx * nty]);
+    for (int k = 0; k < ntx * nty; k++)
+        tiles[k].store(nullptr);
+    for (int ty = 0; ty < m_ntiles_y; ty++) {
+        for (int tx = 0; tx < m_ntiles_x; tx++) {
+            int k = (ty + m_tile0_y - ty1) * ntx + (tx + m_tile0_x - tx1);
+            tiles[k].store(m_tiles[ty * m_ntiles_x + tx].load());
+        }
+    }
+
+    m_tiles = std::move(tiles);
+    m_tile0_x = tx1;
+    m_tile0_y = ty1;
+    m_ntiles_x = ntx;
+    m_ntiles_y = nty;
+}
+
+std::atomic<SCMLoader::NodeGrid::Tile*>* SCMLoader::NodeGrid::GetSlot(int tx, int ty) const {
+    tx -= m_tile0_x;
+    ty -= m_tile0_y;
+    if (tx < 0 || tx >= m_ntiles_x || ty < 0 || ty >= m_ntiles_y)
+        return nullptr;
+    return &m_tiles[ty * m_ntiles_x + tx];
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::GetTile(const ChVector2i& ij) {
+    auto slot = GetSlot(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS);
+    assert(slot);
+
+    // Allocate the tile on first access. If another thread allocated it in the meantime, use that one instead.
+    Tile* tile = slot->load(std::memory_order_acquire);
+    if (!tile) {
+        Tile* new_tile = new Tile();
+        if (slot->compare_exchange_strong(tile, new_tile, std::memory_order_acq_rel))
+            tile = new_tile;
+        else
+            delete new_tile;
+    }
+
+    return tile;
+}
+
+SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) {
+    auto slot = GetSlot(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS);
+    if (!slot)
+        return nullptr;
+    Tile* tile = slot->load(std::memory_order_acquire);
+    if (!tile)
+        return nullptr;
+    int k = ((ij.y() & TILE_MASK) << TILE_BITS) + (ij.x() & TILE_MASK);
+    return tile->recorded[k] ? &tile->records[k] : nullptr;
+}
+
+const SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) const {
+    return const_cast<NodeGrid*>(this)->Find(ij);
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) {
+    auto nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+const SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) const {
+    auto nr = Find(ij);
+    assert(nr);
+    return *nr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::Insert(const ChVector2i& ij, const NodeRecord& nr) {
+    Reserve(ij, ij);
+    Tile* tile = GetTile(ij);
+    int k = ((ij.y() & TILE_MASK) << TILE_BITS) + (ij.x() & TILE_MASK);
+    if (!tile->recorded[k]) {
+        tile->records[k] = nr;
+        tile->recorded[k] = true;
+    }
+    return tile->records[k];
+}
+
+void SCMLoader::NodeGrid::Set(const ChVector2i& ij, const NodeRecord& nr) {
+    Reserve(ij, ij);
+    Tile* tile = GetTile(ij);
+    int k = ((ij.y() & TILE_MASK) << TILE_BITS) + (ij.x() & TILE_MASK);
+    tile->records[k] = nr;
+    tile->recorded[k] = true;
+}
+
+size_t SCMLoader::NodeGrid::GetNumNodes() const {
+    size_t num_nodes = 0;
+    ForEach([&num_nodes](const ChVector2i&, const NodeRecord&) { num_nodes++; });
+    return num_nodes;
+}
+
 // -----------------------------------------------------------------------------
 // Implementation of SCMLoader
 // -----------------------------------------------------------------------------
@@ -729,16 +858,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    if (auto p = m_grid.Find(ij)) {
+        ni.sinkage = p->sinkage;
+        ni.sinkage_plastic = p->sinkage_plastic;
+        ni.sinkage_elastic = p->sinkage_elastic;
+        ni.sigma = p->sigma;
+        ni.sigma_yield = p->sigma_yield;
+        ni.kshear = p->kshear;
+        ni.tau = p->tau;
         return ni;
     }
 
@@ -822,10 +950,9 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto p = m_grid.Find(loc))
+        return p->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -948,6 +1075,8 @@ void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector3d& Z) {
             p.m_range[j * n_x + i] = ChVector2i(i + x_min, j + y_min);
         }
     }
+    p.m_range_min = ChVector2i(x_min, y_min);
+    p.m_range_max = ChVector2i(x_max, y_max);
 
     // Calculate inverse of SCM normal expressed in body frame (for optimization of ray-OBB test)
     ChVector3d dir = p.m_body->TransformDirectionParentToLocal(Z);
@@ -996,6 +1125,8 @@ void SCMLoader::UpdateFixedPatch(MovingPatchInfo& p) {
             p.m_range[j * n_x + i] = ChVector2i(i + x_min, j + y_min);
         }
     }
+    p.m_range_min = ChVector2i(x_min, y_min);
+    p.m_range_max = ChVector2i(x_max, y_max);
 }
 
 // Ray-OBB intersection test
@@ -1053,7 +1184,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid.At(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1129,6 +1260,10 @@ void SCMLoader::ComputeInternalForces() {
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
+        // Make sure the grid of modified nodes covers the patch range
+        if (!p.m_range.empty())
+            m_grid.Reserve(p.m_range_min, p.m_range_max);
+
         // Loop through all vertices in the patch range
         int num_ray_casts = 0;
     #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
@@ -1161,9 +1296,7 @@ void SCMLoader::ComputeInternalForces() {
     #pragma omp critical(SCM_ray_casting)
                 {
                     // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
+                    m_grid.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
 
                     // Add to our map of hits to process
                     HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
@@ -1186,11 +1319,17 @@ void SCMLoader::ComputeInternalForces() {
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
+        // Make sure the grid of modified nodes covers the patch range, so that node records can be inserted
+        // concurrently
+        if (!p.m_range.empty())
+            m_grid.Reserve(p.m_range_min, p.m_range_max);
+
+        // Loop through all vertices in the patch range and find the nodes from which a ray must be cast
+        int num_nodes = (int)p.m_range.size();
+        std::vector<char> cast(num_nodes, 0);
+        std::vector<ChVector3d> origins(num_nodes);
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_nodes; k++) {
             ChVector2i ij = p.m_range[k];
 
             // Move from (i, j) to (x, y, z) representation in the world frame
@@ -1207,7 +1346,6 @@ void SCMLoader::ComputeInternalForces() {
             ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
 
             // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
             ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
             ChVector3d from = to - m_Z * m_test_offset_down;
 
@@ -1215,16 +1353,41 @@ void SCMLoader::ComputeInternalForces() {
             if (m_moving_patch && !RayOBBtest(p, from, m_Z))
                 continue;
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+            cast[k] = 1;
+            origins[k] = from;
+        }
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+        // Collect the rays to be cast
+        std::vector<ChVector2i> ray_nodes;
+        std::vector<ChVector3d> ray_from;
+        for (int k = 0; k < num_nodes; k++) {
+            if (cast[k]) {
+                ray_nodes.push_back(p.m_range[k]);
+                ray_from.push_back(origins[k]);
             }
         }
+        int num_ray_casts = (int)ray_from.size();
+
+        // Cast all rays (a packet of parallel rays along the SCM plane normal) into the collision system
+        GetSystem()->GetCollisionSystem()->RayHitBatch(ray_from, m_Z * m_test_offset_down, m_ray_results);
+
+        // Process ray hits
+    #pragma omp parallel for num_threads(nthreads)
+        for (int k = 0; k < num_ray_casts; k++) {
+            if (!m_ray_results.hit[k])
+                continue;
+
+            int t_num = ChOMP::GetThreadNum();
+            ChVector2i ij = ray_nodes[k];
+
+            // If this is the first hit from this node, initialize the node record
+            double z0 = GetInitHeight(ij);
+            m_grid.Insert(ij, NodeRecord(z0, z0, GetInitNormal(ij)));
+
+            // Add to our map of hits to process
+            HitRecord record = {m_ray_results.hitModel[k]->GetContactable(), m_ray_results.abs_hitPoint[k], -1};
+            t_hits[t_num].insert(std::make_pair(ij, record));
+        }
 
         m_timer_ray_testing.stop();
 
@@ -1232,15 +1395,6 @@ void SCMLoader::ComputeInternalForces() {
 
         // Sequential insertion in global hits
         for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
-            }
-
             hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
             t_hits[t_num].clear();
         }
@@ -1350,7 +1504,7 @@ void SCMLoader::ComputeInternalForces() {
     for (auto& h : hits) {
         ChVector2d ij = h.first;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid.At(ij);          // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
         ChContactable* contactable = h.second.contactable;
@@ -1540,7 +1694,7 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                 // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);          //   get node record
+                const auto& nr = m_grid.At(ij);              //   get node record
                 if (nr.sigma <= 0)                           //   if node not touched
                     continue;                                //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;       //   accumulate displaced material
@@ -1548,10 +1702,9 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    auto nbr_nr = m_grid.Find(nbr_ij);       //     neighbor node record
+                    if (!nbr_nr || nbr_nr->sigma <= 0)       //     if neighbor not recorded or not touched
+                        p_boundary.insert(nbr_ij);           //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1562,13 +1715,14 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                auto nr_ptr = m_grid.Find(ij);                                   //   node record
+                if (!nr_ptr) {                                                   //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    nr_ptr = &m_grid.Insert(ij, NodeRecord(z, z, n));            //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = *nr_ptr;                                              //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1592,16 +1746,17 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    auto nbr_nr = m_grid.Find(nbr_ij);                  //   neighbor node record
+                    if (!nbr_nr) {                                      //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid.Insert(nbr_ij, nr);                      //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = *nbr_nr;                       //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1622,13 +1777,13 @@ void SCMLoader::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2i nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1673,7 +1828,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid.At(ij);           // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1796,14 +1951,14 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid.ForEach([&nodes](const ChVector2i& ij, const NodeRecord& nr) {
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            auto rec = m_grid.Find(ij);
+            assert(rec);
+            nodes.push_back(std::make_pair(ij, rec->level));
         }
     }
     return nodes;
@@ -1814,8 +1969,8 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 //       As such, some plot types may be incorrect at these nodes.
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
-        // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        // Modify existing entry in grid or insert new one
+        m_grid.Set(n.first, SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first)));
     }
 
     // Update visualization
@@ -1824,7 +1979,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid.At(ij);              // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
@@ -20,6 +20,8 @@
 #ifndef SCM_TERRAIN_H
 #define SCM_TERRAIN_H
 
+#include <atomic>
+#include <memory>
 #include <string>
 #include <ostream>
 #include <unordered_map>
@@ -399,6 +401,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         ChVector3d m_center;              // OOBB center, relative to body
         ChVector3d m_hdims;               // OOBB half-dimensions
         std::vector<ChVector2i> m_range;  // current grid nodes covered by the patch
+        ChVector2i m_range_min;           // lower corner of the current patch range (grid coordinates)
+        ChVector2i m_range_max;           // upper corner of the current patch range (grid coordinates)
         ChVector3d m_ooN;                 // current inverse of SCM normal in body frame
     };
 
@@ -439,6 +443,80 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
               step_plastic_flow(0) {}
     };
 
+    // Sparse grid of node records.
+    // Records are stored in dense tiles of TILE_SIZE x TILE_SIZE nodes, allocated on first access. Tiles are addressed
+    // through a dense directory covering the current range of tile coordinates, so that accessing a node record
+    // requires no hashing and neighbor records are found by index arithmetic. Concurrent insertion of records at
+    // distinct nodes is thread safe, provided the directory already covers these nodes (see Reserve).
+    class NodeGrid {
+      public:
+        NodeGrid();
+        ~NodeGrid();
+
+        NodeGrid(const NodeGrid&) = delete;
+        NodeGrid& operator=(const NodeGrid&) = delete;
+
+        // Extend the directory to cover all nodes in the given range of grid coordinates (not thread safe).
+        void Reserve(const ChVector2i& ij_min, const ChVector2i& ij_max);
+
+        // Return the record at the specified node, or nullptr if the node was not yet recorded.
+        NodeRecord* Find(const ChVector2i& ij);
+        const NodeRecord* Find(const ChVector2i& ij) const;
+
+        // Return the record at the specified node (the node must be already recorded).
+        NodeRecord& At(const ChVector2i& ij);
+        const NodeRecord& At(const ChVector2i& ij) const;
+
+        // Insert a record at the specified node, if not yet recorded, and return the node record.
+        // This function extends the directory as needed, and is thread safe only if that is not the case.
+        NodeRecord& Insert(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Set the record at the specified node (overwriting any existing record).
+        void Set(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Return the number of recorded nodes.
+        size_t GetNumNodes() const;
+
+        // Invoke the given function for each recorded node, with arguments the node grid coordinates and record.
+        template <typename F>
+        void ForEach(F f) const {
+            for (int ty = 0; ty < m_ntiles_y; ty++) {
+                for (int tx = 0; tx < m_ntiles_x; tx++) {
+                    const Tile* tile = m_tiles[ty * m_ntiles_x + tx].load(std::memory_order_acquire);
+                    if (!tile)
+                        continue;
+                    for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+                        if (tile->recorded[k])
+                            f(ChVector2i(((tx + m_tile0_x) << TILE_BITS) + (k & TILE_MASK),
+                                         ((ty + m_tile0_y) << TILE_BITS) + (k >> TILE_BITS)),
+                              tile->records[k]);
+                    }
+                }
+            }
+        }
+
+      private:
+        static constexpr int TILE_BITS = 5;
+        static constexpr int TILE_SIZE = 1 << TILE_BITS;
+        static constexpr int TILE_MASK = TILE_SIZE - 1;
+
+        struct Tile {
+            Tile();
+            NodeRecord records[TILE_SIZE * TILE_SIZE];  // node records, in row-major order
+            bool recorded[TILE_SIZE * TILE_SIZE];       // flags for recorded nodes
+        };
+
+        // Return the directory slot for the tile with given tile coordinates (or nullptr if not covered).
+        std::atomic<Tile*>* GetSlot(int tx, int ty) const;
+
+        // Return the tile containing the specified node, allocating it if necessary (thread safe).
+        Tile* GetTile(const ChVector2i& ij);
+
+        std::unique_ptr<std::atomic<Tile*>[]> m_tiles;  // tile directory
+        int m_tile0_x, m_tile0_y;                       // tile coordinates of the first directory entry
+        int m_ntiles_x, m_ntiles_y;                     // directory dimensions
+    };
+
     // Hash function for a pair of integer grid coordinates
     struct CoordHash {
       public:
@@ -554,8 +632,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    NodeGrid m_grid;                           ///< modified grid nodes (persistent)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
 
     ChAABB m_aabb;    ///< user-specified SCM terrain boundary
     bool m_boundary;  ///< user-specified SCM terrain boundary?
@@ -566,6 +644,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     double m_test_offset_down;  ///< offset for ray start
     double m_test_offset_up;    ///< offset for ray end
 
+    ChCollisionSystem::ChRayhitResults m_ray_results;  ///< results of batched ray casting (reused across steps)
+
     std::shared_ptr<ChVisualShapeTriangleMesh> m_trimesh_shape;  ///< mesh visualization asset
 
     bool m_cosim_mode;  ///< co-simulation mode
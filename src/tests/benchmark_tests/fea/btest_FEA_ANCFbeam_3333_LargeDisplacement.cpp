@@ -63,7 +63,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFBeamTest {
   public:
-    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFBeamTest() { delete m_system; }
 
@@ -85,7 +85,7 @@ class ANCFBeamTest {
     int m_NumThreads;
 };
 
-ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = num_elements;
     m_NumThreads = NumThreads;
@@ -187,6 +187,9 @@ ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThre
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Evaluate the element internal forces in batches, vectorized across elements
+    mesh->EnableBatchedInternalForces(useBatched);
+
     // Setup visualization
     auto vis_surf = chrono_types::make_shared<ChVisualShapeFEA>();
     vis_surf->SetFEMdataType(ChVisualShapeFEA::DataType::SURFACE);
@@ -457,6 +460,10 @@ int main(int argc, char* argv[]) {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt");
                     }
+                    {
+                        ANCFBeamTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt_Batched");
+                    }
                     {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_PreInt");
@@ -62,7 +62,7 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFShellTest {
   public:
-    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt, bool useBatched = false);
 
     ~ANCFShellTest() { delete m_system; }
 
@@ -84,7 +84,11 @@ class ANCFShellTest {
     int m_NumThreads;
 };
 
-ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFShellTest::ANCFShellTest(int num_elements,
+                             SolverType solver_type,
+                             int NumThreads,
+                             bool useContInt,
+                             bool useBatched) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -179,6 +183,9 @@ ANCFShellTest::ANCFShellTest(int num_elements, SolverType solver_type, int NumTh
     auto mesh = chrono_types::make_shared<ChMesh>();
     m_system->Add(mesh);
 
+    // Evaluate the element internal forces in batches, vectorized across elements
+    mesh->EnableBatchedInternalForces(useBatched);
+
     // Setup visualization
     auto mvisualizemesh = chrono_types::make_shared<ChVisualShapeFEA>();
     mvisualizemesh->SetFEMdataType(ChVisualShapeFEA::DataType::SURFACE);
@@ -476,6 +483,10 @@ int main(int argc, char* argv[]) {
                         ANCFShellTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_ContInt");
                     }
+                    {
+                        ANCFShellTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_ContInt_Batched");
+                    }
                     {
                         ANCFShellTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementShellANCF_3833_PreInt");
@@ -14,7 +14,8 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and of reusing the symbolic factorization when the sparsity pattern
+// is locked.
 //
 // =============================================================================
 
@@ -103,6 +104,9 @@ class SystemFixture : public ::benchmark::Fixture {
         auto solver = std::static_pointer_cast<ChDirectSolverLS>(m_system->GetSolver());
         st.counters["LS_Setup_assembly"] = solver->GetTimeSetup_Assembly() * 1e3 / num_it;
         st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
+        st.counters["LS_Setup_analysis"] = solver->GetTimeSetup_SolverAnalysis() * 1e3 / num_it;
+        st.counters["LS_Setup_factorization"] = solver->GetTimeSetup_SolverFactorization() * 1e3 / num_it;
+        st.counters["LS_Num_analysis"] = solver->GetNumAnalysisCalls();
         st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
         st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
     }
@@ -156,6 +160,20 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+#define BM_SOLVER_LU(TEST_NAME, N, REUSE_SYMBOLIC)                                    \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<ChSolverSparseLU>();                  \
+        solver->LockSparsityPattern(true);                                            \
+        solver->EnableSymbolicFactorizationReuse(REUSE_SYMBOLIC);                     \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStaticLinear();                                               \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -193,6 +211,17 @@ BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
 
+BM_SOLVER_LU(LU_reuse_500, 500, true)
+BM_SOLVER_LU(LU_no_reuse_500, 500, false)
+BM_SOLVER_LU(LU_reuse_1000, 1000, true)
+BM_SOLVER_LU(LU_no_reuse_1000, 1000, false)
+BM_SOLVER_LU(LU_reuse_2000, 2000, true)
+BM_SOLVER_LU(LU_no_reuse_2000, 2000, false)
+BM_SOLVER_LU(LU_reuse_4000, 4000, true)
+BM_SOLVER_LU(LU_no_reuse_4000, 4000, false)
+BM_SOLVER_LU(LU_reuse_8000, 8000, true)
+BM_SOLVER_LU(LU_no_reuse_8000, 8000, false)
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
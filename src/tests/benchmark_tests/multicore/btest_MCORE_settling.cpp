@@ -12,7 +12,9 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// Chrono::Multicore benchmark program using SMC method for frictional contact.
+// Chrono::Multicore benchmark program using SMC and NSC methods for frictional
+// contact. The NSC tests compare the assembled and matrix-free Schur complement
+// products and report the memory held by the assembled constraint matrices.
 //
 // The global reference frame has Z up.
 // =============================================================================
@@ -39,6 +41,51 @@ using namespace chrono::vsg3d;
 
 using namespace chrono;
 
+// Create a bin consisting of five boxes attached to the ground and granular material in layers.
+// Return the number of particles.
+static unsigned int CreateScene(ChSystemMulticore* sys, std::shared_ptr<ChContactMaterial> mat) {
+    // Container half-dimensions
+    ChVector3d hdim(2, 2, 0.5);
+
+    // Create a bin consisting of five boxes attached to the ground.
+    auto bin = chrono_types::make_shared<ChBody>();
+    bin->SetMass(1);
+    bin->SetPos(ChVector3d(0, 0, 0));
+    bin->EnableCollision(true);
+    bin->SetFixed(true);
+
+    utils::AddBoxContainer(bin, mat,                                      //
+                           ChFrame<>(ChVector3d(0, 0, hdim.z()), QUNIT),  //
+                           hdim * 2, 0.2,                                 //
+                           ChVector3i(2, 2, -1));
+
+    sys->AddBody(bin);
+
+    // Create granular material in layers
+    double rho = 2000;
+    double radius = 0.02;
+    int num_layers = 8;
+
+    // Create a particle generator and a mixture entirely made out of spheres
+    double r = 1.01 * radius;
+    utils::ChPDSampler<double> sampler(2 * r);
+    utils::ChGenerator gen(sys);
+    std::shared_ptr<utils::ChMixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->SetDefaultMaterial(mat);
+    m1->SetDefaultDensity(rho);
+    m1->SetDefaultSize(radius);
+
+    // Create particles in layers until reaching the desired number of particles
+    ChVector3d range(hdim.x() - r, hdim.y() - r, 0);
+    ChVector3d center(0, 0, 2 * r);
+    for (int il = 0; il < num_layers; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+
+    return gen.GetTotalNumBodies();
+}
+
 class SettlingSMC : public utils::ChBenchmarkTest {
   public:
     SettlingSMC();
@@ -89,46 +136,7 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     mat->SetRestitution(cr);
     mat->SetAdhesion(0);
 
-    // Container half-dimensions
-    ChVector3d hdim(2, 2, 0.5);
-
-    // Create a bin consisting of five boxes attached to the ground.
-    auto bin = chrono_types::make_shared<ChBody>();
-    bin->SetMass(1);
-    bin->SetPos(ChVector3d(0, 0, 0));
-    bin->EnableCollision(true);
-    bin->SetFixed(true);
-
-    utils::AddBoxContainer(bin, mat,                                      //
-                           ChFrame<>(ChVector3d(0, 0, hdim.z()), QUNIT),  //
-                           hdim * 2, 0.2,                                 //
-                           ChVector3i(2, 2, -1));
-
-    m_system->AddBody(bin);
-
-    // Create granular material in layers
-    double rho = 2000;
-    double radius = 0.02;
-    int num_layers = 8;
-
-    // Create a particle generator and a mixture entirely made out of spheres
-    double r = 1.01 * radius;
-    utils::ChPDSampler<double> sampler(2 * r);
-    utils::ChGenerator gen(m_system);
-    std::shared_ptr<utils::ChMixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
-    m1->SetDefaultMaterial(mat);
-    m1->SetDefaultDensity(rho);
-    m1->SetDefaultSize(radius);
-
-    // Create particles in layers until reaching the desired number of particles
-    ChVector3d range(hdim.x() - r, hdim.y() - r, 0);
-    ChVector3d center(0, 0, 2 * r);
-    for (int il = 0; il < num_layers; il++) {
-        gen.CreateObjectsBox(sampler, center, range);
-        center.z() += 2 * r;
-    }
-
-    m_num_particles = gen.GetTotalNumBodies();
+    m_num_particles = CreateScene(m_system, mat);
 }
 
 // Run settling simulation with visualization
@@ -158,6 +166,60 @@ void SettlingSMC::SimulateVis() {
 
 // =============================================================================
 
+template <bool MATRIX_FREE>
+class SettlingNSC : public utils::ChBenchmarkTest {
+  public:
+    SettlingNSC();
+    ~SettlingNSC() { delete m_system; }
+
+    void SetNumthreads(int nthreads) { m_system->SetNumThreads(nthreads); }
+    unsigned int GetNumParticles() const { return m_num_particles; }
+
+    /// Memory allocated for the assembled constraint matrices (MB).
+    double GetMatrixMemory() const;
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemMulticoreNSC* m_system;
+    double m_step;
+    unsigned int m_num_particles;
+};
+
+template <bool MATRIX_FREE>
+SettlingNSC<MATRIX_FREE>::SettlingNSC() : m_system(new ChSystemMulticoreNSC), m_step(1e-3) {
+    m_system->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    // Set solver parameters
+    m_system->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    m_system->GetSettings()->solver.max_iteration_normal = 0;
+    m_system->GetSettings()->solver.max_iteration_sliding = 50;
+    m_system->GetSettings()->solver.max_iteration_spinning = 0;
+    m_system->GetSettings()->solver.max_iteration_bilateral = 0;
+    m_system->GetSettings()->solver.tolerance = 1e-3;
+    m_system->GetSettings()->solver.matrix_free_schur = MATRIX_FREE;
+    m_system->ChangeSolverType(SolverType::APGD);
+
+    m_system->GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    m_num_particles = CreateScene(m_system, mat);
+}
+
+template <bool MATRIX_FREE>
+double SettlingNSC<MATRIX_FREE>::GetMatrixMemory() const {
+    const auto& host_data = m_system->data_manager->host_data;
+    size_t nnz = host_data.D_T.capacity() + host_data.D.capacity() + host_data.M_invD.capacity() +
+                 host_data.Nschur.capacity();
+    return nnz * (sizeof(real) + sizeof(size_t)) / (1024.0 * 1024.0);
+}
+
+// =============================================================================
+
 #define NUM_SKIP_STEPS 500  // number of steps for hot start
 #define NUM_SIM_STEPS 500  // number of simulation steps for benchmarking
 
@@ -181,6 +243,40 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+template <bool MATRIX_FREE>
+using TEST_NSC = chrono::utils::ChBenchmarkFixture<SettlingNSC<MATRIX_FREE>, 0>;
+
+BENCHMARK_TEMPLATE_DEFINE_F(TEST_NSC, SettleAssembled, false)(benchmark::State& st) {
+    Reset(NUM_SKIP_STEPS);
+    m_test->SetNumthreads((int)st.range(0));
+    while (st.KeepRunning()) {
+        m_test->Simulate(NUM_SIM_STEPS);
+    }
+    Report(st);
+    st.counters["Matrix_MB"] = m_test->GetMatrixMemory();
+}
+BENCHMARK_TEMPLATE_DEFINE_F(TEST_NSC, SettleMatrixFree, true)(benchmark::State& st) {
+    Reset(NUM_SKIP_STEPS);
+    m_test->SetNumthreads((int)st.range(0));
+    while (st.KeepRunning()) {
+        m_test->Simulate(NUM_SIM_STEPS);
+    }
+    Report(st);
+    st.counters["Matrix_MB"] = m_test->GetMatrixMemory();
+}
+BENCHMARK_REGISTER_F(TEST_NSC, SettleAssembled)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(1)
+    ->UseRealTime()
+    ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+BENCHMARK_REGISTER_F(TEST_NSC, SettleMatrixFree)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(1)
+    ->UseRealTime()
+    ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
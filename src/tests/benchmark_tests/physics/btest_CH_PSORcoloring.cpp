@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the scaling of the graph-colored parallel PSOR sweep.
+// A pile of spheres settles in a box; the same model is solved with the
+// sequential PSOR sweep and with the colored sweep on increasing numbers of
+// OpenMP threads.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+// Number of spheres along each direction (N*N*N spheres in total)
+static const int N = 20;
+
+// NT: number of threads for the colored sweep (0: sequential PSOR sweep)
+template <int NT>
+class PSORColoringTest : public utils::ChBenchmarkTest {
+  public:
+    PSORColoringTest();
+    ~PSORColoringTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+template <int NT>
+PSORColoringTest<NT>::PSORColoringTest() : m_system(new ChSystemNSC()), m_step(1e-3) {
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(100);
+    solver->EnableWarmStart(true);
+    if (NT > 0) {
+        solver->EnableParallelColoring(true);
+        solver->SetNumThreads(NT);
+    }
+    m_system->SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    double radius = 0.1;
+    double spacing = 2.02 * radius;
+    double half = 0.5 * N * spacing;
+
+    for (int ix = 0; ix < N; ix++) {
+        for (int iy = 0; iy < N; iy++) {
+            for (int iz = 0; iz < N; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, true, true, mat);
+                double offset = (iy % 2) * 0.25 * radius;
+                ball->SetPos(ChVector3d(-half + (ix + 0.5) * spacing + offset, (iy + 0.5) * spacing,
+                                        -half + (iz + 0.5) * spacing + offset));
+                m_system->Add(ball);
+            }
+        }
+    }
+
+    double height = N * spacing;
+    double width = 2 * half + 0.4;
+
+    auto floorBody = chrono_types::make_shared<ChBodyEasyBox>(width, 0.2, width, 1000, false, true, mat);
+    floorBody->SetPos(ChVector3d(0, -0.1, 0));
+    floorBody->SetFixed(true);
+    m_system->Add(floorBody);
+
+    auto wallBody1 = chrono_types::make_shared<ChBodyEasyBox>(0.2, 2 * height, width, 1000, false, true, mat);
+    wallBody1->SetPos(ChVector3d(-half - 0.1, height, 0));
+    wallBody1->SetFixed(true);
+    m_system->Add(wallBody1);
+
+    auto wallBody2 = chrono_types::make_shared<ChBodyEasyBox>(0.2, 2 * height, width, 1000, false, true, mat);
+    wallBody2->SetPos(ChVector3d(half + 0.1, height, 0));
+    wallBody2->SetFixed(true);
+    m_system->Add(wallBody2);
+
+    auto wallBody3 = chrono_types::make_shared<ChBodyEasyBox>(width, 2 * height, 0.2, 1000, false, true, mat);
+    wallBody3->SetPos(ChVector3d(0, height, -half - 0.1));
+    wallBody3->SetFixed(true);
+    m_system->Add(wallBody3);
+
+    auto wallBody4 = chrono_types::make_shared<ChBodyEasyBox>(width, 2 * height, 0.2, 1000, false, true, mat);
+    wallBody4->SetPos(ChVector3d(0, height, half + 0.1));
+    wallBody4->SetFixed(true);
+    m_system->Add(wallBody4);
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 500  // number of steps for hot start
+#define NUM_SIM_STEPS 100   // number of simulation steps for each benchmark
+
+CH_BM_SIMULATION_LOOP(PSOR_seq, PSORColoringTest<0>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(PSOR_t01, PSORColoringTest<1>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(PSOR_t02, PSORColoringTest<2>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(PSOR_t04, PSORColoringTest<4>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(PSOR_t08, PSORColoringTest<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(PSOR_t16, PSORColoringTest<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(PSOR_t32, PSORColoringTest<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
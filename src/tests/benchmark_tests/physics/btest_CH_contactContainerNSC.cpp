@@ -0,0 +1,207 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the NSC contact container.
+// A pile of spheres settles in a box (as in the mixerNSC benchmark). The
+// collision information of the last step is recorded and then replayed, to
+// time the container operations on their own: adding (and recycling) the
+// contacts, injecting their constraints in the system descriptor, loading
+// their contribution to the residual, and reporting them.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerNSC.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace chrono;
+
+// =============================================================================
+
+// Number of spheres along each direction (N*N*N spheres in total)
+static const int N = 16;
+
+// Record the collision information for all contacts added to the container.
+class RecordContacts : public ChContactContainer::AddContactCallback {
+  public:
+    virtual void OnAddContact(const ChCollisionInfo& cinfo, ChContactMaterialComposite* const material) override {
+        contacts.push_back(cinfo);
+    }
+    std::vector<ChCollisionInfo> contacts;
+};
+
+// Report callback which touches all contact data.
+class CountContacts : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        force += react_forces.x();
+        return true;
+    }
+    double force = 0;
+};
+
+class ContainerNSC : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        sys = new ChSystemNSC();
+        sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        mat->SetFriction(0.4f);
+
+        double radius = 0.1;
+        double spacing = 2.02 * radius;
+        double half = 0.5 * N * spacing;
+        double height = N * spacing;
+        double width = 2 * half + 0.4;
+
+        for (int ix = 0; ix < N; ix++) {
+            for (int iy = 0; iy < N; iy++) {
+                for (int iz = 0; iz < N; iz++) {
+                    auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, true, true, mat);
+                    double offset = (iy % 2) * 0.25 * radius;
+                    ball->SetPos(ChVector3d(-half + (ix + 0.5) * spacing + offset, (iy + 0.5) * spacing,
+                                            -half + (iz + 0.5) * spacing + offset));
+                    sys->Add(ball);
+                }
+            }
+        }
+
+        auto floorBody = chrono_types::make_shared<ChBodyEasyBox>(width, 0.2, width, 1000, false, true, mat);
+        floorBody->SetPos(ChVector3d(0, -0.1, 0));
+        floorBody->SetFixed(true);
+        sys->Add(floorBody);
+
+        auto wallBody1 = chrono_types::make_shared<ChBodyEasyBox>(0.2, 2 * height, width, 1000, false, true, mat);
+        wallBody1->SetPos(ChVector3d(-half - 0.1, height, 0));
+        wallBody1->SetFixed(true);
+        sys->Add(wallBody1);
+
+        auto wallBody2 = chrono_types::make_shared<ChBodyEasyBox>(0.2, 2 * height, width, 1000, false, true, mat);
+        wallBody2->SetPos(ChVector3d(half + 0.1, height, 0));
+        wallBody2->SetFixed(true);
+        sys->Add(wallBody2);
+
+        auto wallBody3 = chrono_types::make_shared<ChBodyEasyBox>(width, 2 * height, 0.2, 1000, false, true, mat);
+        wallBody3->SetPos(ChVector3d(0, height, -half - 0.1));
+        wallBody3->SetFixed(true);
+        sys->Add(wallBody3);
+
+        auto wallBody4 = chrono_types::make_shared<ChBodyEasyBox>(width, 2 * height, 0.2, 1000, false, true, mat);
+        wallBody4->SetPos(ChVector3d(0, height, half + 0.1));
+        wallBody4->SetFixed(true);
+        sys->Add(wallBody4);
+
+        // Let the pile settle, then record the contacts of one more step
+        for (int i = 0; i < 300; i++)
+            sys->DoStepDynamics(1e-3);
+
+        container = sys->GetContactContainer();
+        auto recorder = chrono_types::make_shared<RecordContacts>();
+        container->RegisterAddContactCallback(recorder);
+        sys->DoStepDynamics(1e-3);
+        container->RegisterAddContactCallback(nullptr);
+        contacts = recorder->contacts;
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        container.reset();
+        delete sys;
+    }
+
+    void AddContacts() {
+        container->BeginAddContact();
+        for (const auto& cinfo : contacts)
+            container->AddContact(cinfo);
+        container->EndAddContact();
+    }
+
+    ChSystemNSC* sys;
+    std::shared_ptr<ChContactContainer> container;
+    std::vector<ChCollisionInfo> contacts;
+};
+
+// Add all contacts, recycling the contact objects from the previous pass.
+BENCHMARK_DEFINE_F(ContainerNSC, AddContacts)(benchmark::State& st) {
+    for (auto _ : st) {
+        AddContacts();
+    }
+    st.SetItemsProcessed(st.iterations() * contacts.size());
+}
+
+// Add all contacts after the container was emptied (all contact objects constructed anew).
+BENCHMARK_DEFINE_F(ContainerNSC, AddContactsCold)(benchmark::State& st) {
+    for (auto _ : st) {
+        st.PauseTiming();
+        container->RemoveAllContacts();
+        st.ResumeTiming();
+        AddContacts();
+    }
+    st.SetItemsProcessed(st.iterations() * contacts.size());
+}
+
+// Inject the contact constraints in the system descriptor.
+BENCHMARK_DEFINE_F(ContainerNSC, InjectConstraints)(benchmark::State& st) {
+    AddContacts();
+    auto descriptor = sys->GetSystemDescriptor();
+    for (auto _ : st) {
+        descriptor->BeginInsertion();
+        container->InjectConstraints(*descriptor);
+        descriptor->EndInsertion();
+    }
+    st.SetItemsProcessed(st.iterations() * contacts.size());
+}
+
+// Load the contact contribution R += c * Cq' * L.
+BENCHMARK_DEFINE_F(ContainerNSC, LoadResidual_CqL)(benchmark::State& st) {
+    AddContacts();
+    unsigned int num_coords = sys->GetNumCoordsVelLevel();
+    unsigned int num_constr = container->GetNumConstraints();
+    ChVectorDynamic<> R(num_coords);
+    ChVectorDynamic<> L(num_constr);
+    L.setConstant(1e-3);
+    for (auto _ : st) {
+        R.setZero();
+        container->IntLoadResidual_CqL(0, R, L, 1.0);
+    }
+    st.SetItemsProcessed(st.iterations() * contacts.size());
+}
+
+// Traverse all contacts through a report callback.
+BENCHMARK_DEFINE_F(ContainerNSC, ReportContacts)(benchmark::State& st) {
+    AddContacts();
+    auto reporter = chrono_types::make_shared<CountContacts>();
+    for (auto _ : st) {
+        container->ReportAllContacts(reporter);
+    }
+    st.SetItemsProcessed(st.iterations() * contacts.size());
+}
+
+BENCHMARK_REGISTER_F(ContainerNSC, AddContacts)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ContainerNSC, AddContactsCold)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ContainerNSC, InjectConstraints)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ContainerNSC, LoadResidual_CqL)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(ContainerNSC, ReportContacts)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
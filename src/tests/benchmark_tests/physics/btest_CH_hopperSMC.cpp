@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the scaling of SMC contact force evaluation.
+// Spheres discharge from a hopper onto a floor. The same model is simulated
+// with increasing numbers of Chrono threads, which are used to evaluate the
+// contact forces and to load them in the system residual.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+// Number of spheres along each direction (N*N*N spheres in total)
+static const int N = 20;
+
+// NT: number of Chrono threads
+template <int NT>
+class HopperTestSMC : public utils::ChBenchmarkTest {
+  public:
+    HopperTestSMC();
+    ~HopperTestSMC() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemSMC* m_system;
+    double m_step;
+};
+
+template <int NT>
+HopperTestSMC<NT>::HopperTestSMC() : m_system(new ChSystemSMC()), m_step(1e-4) {
+    m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    m_system->SetNumThreads(NT, 1, 1);
+    m_system->SetContactForceModel(ChSystemSMC::Hertz);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(1e7f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.1f);
+
+    double radius = 0.05;
+    double spacing = 2.02 * radius;
+    double half = 0.5 * N * spacing;
+
+    // Spheres, initially stacked above the hopper outlet
+    for (int ix = 0; ix < N; ix++) {
+        for (int iy = 0; iy < N; iy++) {
+            for (int iz = 0; iz < N; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 2000, true, true, mat);
+                double offset = (iy % 2) * 0.25 * radius;
+                ball->SetPos(ChVector3d(-half + (ix + 0.5) * spacing + offset, 1 + (iy + 0.5) * spacing,
+                                        -half + (iz + 0.5) * spacing + offset));
+                m_system->Add(ball);
+            }
+        }
+    }
+
+    // Hopper: four inclined plates leaving a square outlet
+    double height = N * spacing;
+    double outlet = 8 * radius;
+    double length = 2 * half + 0.2;
+    double angle = CH_PI / 6;
+
+    for (int i = 0; i < 4; i++) {
+        auto plate = chrono_types::make_shared<ChBodyEasyBox>(length, 0.02, length, 1000, false, true, mat);
+        ChQuaterniond rot = QuatFromAngleY(i * CH_PI_2) * QuatFromAngleZ(-angle);
+        ChVector3d pos = QuatFromAngleY(i * CH_PI_2).Rotate(ChVector3d(-0.5 * outlet - 0.5 * length, 0.8, 0));
+        plate->SetPos(pos);
+        plate->SetRot(rot);
+        plate->SetFixed(true);
+        m_system->Add(plate);
+    }
+
+    // Floor with walls, to collect the discharged material
+    double width = 2 * length + outlet;
+
+    auto floorBody = chrono_types::make_shared<ChBodyEasyBox>(width, 0.2, width, 1000, false, true, mat);
+    floorBody->SetPos(ChVector3d(0, -0.1, 0));
+    floorBody->SetFixed(true);
+    m_system->Add(floorBody);
+
+    for (int i = 0; i < 4; i++) {
+        auto wall = chrono_types::make_shared<ChBodyEasyBox>(0.2, 2 * height, width, 1000, false, true, mat);
+        wall->SetPos(QuatFromAngleY(i * CH_PI_2).Rotate(ChVector3d(0.5 * width + 0.1, height, 0)));
+        wall->SetRot(QuatFromAngleY(i * CH_PI_2));
+        wall->SetFixed(true);
+        m_system->Add(wall);
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 2000  // number of steps for hot start
+#define NUM_SIM_STEPS 500    // number of simulation steps for each benchmark
+
+CH_BM_SIMULATION_LOOP(HopperSMC_t01, HopperTestSMC<1>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(HopperSMC_t02, HopperTestSMC<2>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(HopperSMC_t04, HopperTestSMC<4>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(HopperSMC_t08, HopperTestSMC<8>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(HopperSMC_t16, HopperTestSMC<16>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -0,0 +1,116 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the narrowphase of the multicore collision system.
+// Collision detection is run on a block of overlapping spheres, boxes,
+// ellipsoids, and cylinders, using either the default narrowphase (worst-case
+// contact storage, compacted after dispatch) or the deterministic narrowphase
+// (per-thread contact buffers merged in canonical pair order), with 1, 8, and
+// 32 threads.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace chrono;
+
+// =============================================================================
+
+// Number of bodies along each direction (N*N*N bodies in total)
+static const int N = 30;
+
+template <bool DETERMINISTIC>
+class NarrowphaseMC : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        sys = new ChSystemSMC();
+        sys->SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+        sys->SetNumThreads(1, (int)st.range(0), 1);
+
+        auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys->GetCollisionSystem());
+        coll_sys->SetDeterministicNarrowphase(DETERMINISTIC);
+        coll_sys->SetBroadphaseGridDensity(5);
+        coll_sys->SetEnvelope(0.01);
+
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+
+        double spacing = 0.9;
+        for (int ix = 0; ix < N; ix++) {
+            for (int iy = 0; iy < N; iy++) {
+                for (int iz = 0; iz < N; iz++) {
+                    std::shared_ptr<ChBody> body;
+                    switch ((ix + iy + iz) % 4) {
+                        case 0:
+                            body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                            break;
+                        case 1:
+                            body = chrono_types::make_shared<ChBodyEasyBox>(0.9, 0.8, 0.7, 1000, false, true, mat);
+                            break;
+                        case 2:
+                            body = chrono_types::make_shared<ChBodyEasyEllipsoid>(ChVector3d(0.8, 1.0, 1.2), 1000,
+                                                                                  false, true, mat);
+                            break;
+                        case 3:
+                            body = chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Y, 0.4, 0.8, 1000, false,
+                                                                                 true, mat);
+                            break;
+                    }
+                    double angle = std::sin(1.0 + ix * 7 + iy * 13 + iz * 29) * CH_PI;
+                    body->SetPos(ChVector3d(ix * spacing, iy * spacing, iz * spacing));
+                    body->SetRot(QuatFromAngleAxis(angle, ChVector3d(1, 2, 3).GetNormalized()));
+                    sys->AddBody(body);
+                }
+            }
+        }
+
+        // Initialize the system (and its collision system)
+        sys->DoStepDynamics(1e-6);
+    }
+
+    void TearDown(const ::benchmark::State& st) override { delete sys; }
+
+    ChSystemSMC* sys;
+};
+
+// -----------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE_DEFINE_F(NarrowphaseMC, Default, false)(benchmark::State& st) {
+    for (auto _ : st)
+        sys->ComputeCollisions();
+    st.counters["contacts"] = sys->GetNumContacts();
+}
+BENCHMARK_TEMPLATE_DEFINE_F(NarrowphaseMC, Deterministic, true)(benchmark::State& st) {
+    for (auto _ : st)
+        sys->ComputeCollisions();
+    st.counters["contacts"] = sys->GetNumContacts();
+}
+
+BENCHMARK_REGISTER_F(NarrowphaseMC, Default)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->UseRealTime();
+BENCHMARK_REGISTER_F(NarrowphaseMC, Deterministic)
+    ->Unit(benchmark::kMillisecond)
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(32)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
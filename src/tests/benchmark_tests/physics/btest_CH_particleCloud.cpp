@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for particle clouds.
+// A cloud of 1M spheres is created either as a ChParticleCloud (one object per
+// particle) or as a ChParticleCloudSoA (structure-of-arrays state). The state
+// and residual functions of the ChIntegrableIIorder interface are timed on
+// their own, as well as a complete (collision-free) simulation step.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChParticleCloudSoA.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace chrono;
+
+// =============================================================================
+
+// Number of spheres along each direction (N*N*N spheres in total)
+static const int N = 100;
+
+template <typename C>
+class ParticleCloud : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        sys = new ChSystemSMC();
+        sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+        double radius = 0.01;
+        double mass = 1000 * (4.0 / 3.0) * CH_PI * radius * radius * radius;
+
+        cloud = chrono_types::make_shared<C>();
+        cloud->SetMass(mass);
+        cloud->SetInertiaXX(ChVector3d(0.4 * mass * radius * radius));
+        for (int ix = 0; ix < N; ix++) {
+            for (int iy = 0; iy < N; iy++) {
+                for (int iz = 0; iz < N; iz++) {
+                    ChVector3d pos(2.1 * radius * ix, 2.1 * radius * iy, 2.1 * radius * iz);
+                    cloud->AddParticle(ChCoordsys<>(pos, QUNIT));
+                }
+            }
+        }
+        sys->Add(cloud);
+        sys->Setup();
+
+        unsigned int nx = cloud->GetNumCoordsPosLevel();
+        unsigned int nv = cloud->GetNumCoordsVelLevel();
+        x.setZero(nx, nullptr);
+        x_new.setZero(nx, nullptr);
+        v.setZero(nv, nullptr);
+        R.setZero(nv);
+
+        double T;
+        cloud->IntStateGather(0, x, 0, v, T);
+        v.setConstant(0.1);
+    }
+
+    void TearDown(const ::benchmark::State& st) override {
+        cloud = nullptr;
+        delete sys;
+    }
+
+    ChSystemSMC* sys;
+    std::shared_ptr<C> cloud;
+    ChState x;
+    ChState x_new;
+    ChStateDelta v;
+    ChVectorDynamic<> R;
+};
+
+// -----------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, AoS_StateGather, ChParticleCloud)(benchmark::State& st) {
+    double T;
+    for (auto _ : st)
+        cloud->IntStateGather(0, x, 0, v, T);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, AoS_StateScatter, ChParticleCloud)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntStateScatter(0, x, 0, v, 0.0, false);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, AoS_StateIncrement, ChParticleCloud)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntStateIncrement(0, x_new, x, 0, v);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, AoS_LoadResidual_F, ChParticleCloud)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntLoadResidual_F(0, R, 1.0);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, AoS_LoadResidual_Mv, ChParticleCloud)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntLoadResidual_Mv(0, R, v, 1.0);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, AoS_Step, ChParticleCloud)(benchmark::State& st) {
+    for (auto _ : st)
+        sys->DoStepDynamics(1e-4);
+}
+
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, SoA_StateGather, ChParticleCloudSoA)(benchmark::State& st) {
+    double T;
+    for (auto _ : st)
+        cloud->IntStateGather(0, x, 0, v, T);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, SoA_StateScatter, ChParticleCloudSoA)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntStateScatter(0, x, 0, v, 0.0, false);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, SoA_StateIncrement, ChParticleCloudSoA)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntStateIncrement(0, x_new, x, 0, v);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, SoA_LoadResidual_F, ChParticleCloudSoA)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntLoadResidual_F(0, R, 1.0);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, SoA_LoadResidual_Mv, ChParticleCloudSoA)(benchmark::State& st) {
+    for (auto _ : st)
+        cloud->IntLoadResidual_Mv(0, R, v, 1.0);
+}
+BENCHMARK_TEMPLATE_DEFINE_F(ParticleCloud, SoA_Step, ChParticleCloudSoA)(benchmark::State& st) {
+    for (auto _ : st)
+        sys->DoStepDynamics(1e-4);
+}
+
+BENCHMARK_REGISTER_F(ParticleCloud, AoS_StateGather)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, AoS_StateScatter)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, AoS_StateIncrement)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, AoS_LoadResidual_F)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, AoS_LoadResidual_Mv)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, AoS_Step)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, SoA_StateGather)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, SoA_StateScatter)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, SoA_StateIncrement)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, SoA_LoadResidual_F)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, SoA_LoadResidual_Mv)->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ParticleCloud, SoA_Step)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
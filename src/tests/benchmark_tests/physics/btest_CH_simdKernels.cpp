@@ -0,0 +1,171 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmark test for the multicore math and collision kernels compiled for
+// runtime SIMD dispatch (CH_USE_SIMD_DISPATCH). Each benchmark is labeled with
+// the instruction set selected at run time; the speedup of each kernel is
+// obtained by comparing against the output of a build with runtime dispatch
+// disabled (e.g., with --benchmark_out and Google Benchmark's compare.py).
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/multicore_math/types.h"
+#include "chrono/multicore_math/matrix.h"
+#include "chrono/collision/multicore/ChNarrowphase.h"
+#include "chrono/collision/multicore/ChConvexShape.h"
+
+#include <benchmark/benchmark.h>
+
+using namespace chrono;
+
+// =============================================================================
+
+static const int N = 4096;
+
+static real3 TestVector(int i) {
+    return real3(std::sin(0.1 * i), std::cos(0.3 * i), std::sin(0.7 * i + 1));
+}
+
+static quaternion TestQuaternion(int i) {
+    return Normalize(quaternion(std::cos(0.2 * i), std::sin(0.5 * i), std::cos(0.9 * i), std::sin(1.1 * i)));
+}
+
+static Mat33 TestMatrix(int i) {
+    real3 col1 = TestVector(i) + real3(2, 0, 0);
+    real3 col2 = TestVector(i + 1) + real3(0, 2, 0);
+    real3 col3 = TestVector(i + 2) + real3(0, 0, 2);
+    return Mat33(col1, col2, col3);
+}
+
+// -----------------------------------------------------------------------------
+
+static void SIMD_real3(benchmark::State& st) {
+    std::vector<real3> a(N), b(N), c(N);
+    for (int i = 0; i < N; i++) {
+        a[i] = TestVector(i);
+        b[i] = TestVector(N - i);
+    }
+
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++)
+            c[i] = Normalize(Cross(a[i], b[i]) + Dot(a[i], b[i]) * a[i]);
+        benchmark::DoNotOptimize(c.data());
+    }
+
+    st.SetItemsProcessed(st.iterations() * N);
+    st.SetLabel(GetSimdDispatchTarget());
+}
+
+static void SIMD_quaternion(benchmark::State& st) {
+    std::vector<quaternion> q(N);
+    std::vector<real3> v(N), r(N);
+    for (int i = 0; i < N; i++) {
+        q[i] = TestQuaternion(i);
+        v[i] = TestVector(i);
+    }
+
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++)
+            r[i] = RotateT(Rotate(v[i], Mult(q[i], q[N - 1 - i])), q[i]);
+        benchmark::DoNotOptimize(r.data());
+    }
+
+    st.SetItemsProcessed(st.iterations() * N);
+    st.SetLabel(GetSimdDispatchTarget());
+}
+
+static void SIMD_Mat33(benchmark::State& st) {
+    std::vector<Mat33> A(N), B(N), C(N);
+    std::vector<real3> v(N);
+    for (int i = 0; i < N; i++) {
+        A[i] = TestMatrix(i);
+        B[i] = TestMatrix(N - i);
+        v[i] = TestVector(i);
+    }
+
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++) {
+            C[i] = Inverse(A[i] * B[i]);
+            v[i] = C[i] * v[i];
+        }
+        benchmark::DoNotOptimize(C.data());
+        benchmark::DoNotOptimize(v.data());
+    }
+
+    st.SetItemsProcessed(st.iterations() * N);
+    st.SetLabel(GetSimdDispatchTarget());
+}
+
+// -----------------------------------------------------------------------------
+
+// Pairs of overlapping shapes with varying relative positions and orientations.
+static void CreatePairs(int type1,
+                        int type2,
+                        std::vector<ConvexShapeCustom>& shapesA,
+                        std::vector<ConvexShapeCustom>& shapesB) {
+    shapesA.resize(N);
+    shapesB.resize(N);
+    for (int i = 0; i < N; i++) {
+        shapesA[i] = ConvexShapeCustom(type1, real3(0, 0, 0), TestQuaternion(i), real3(0.5, 0.4, 0.3));
+        shapesB[i] = ConvexShapeCustom(type2, 0.6 * TestVector(i), TestQuaternion(N - i), real3(0.4, 0.5, 0.3));
+    }
+}
+
+static void SIMD_MPR(benchmark::State& st) {
+    std::vector<ConvexShapeCustom> shapesA;
+    std::vector<ConvexShapeCustom> shapesB;
+    CreatePairs(ChCollisionShape::Type::ELLIPSOID, ChCollisionShape::Type::BOX, shapesA, shapesB);
+
+    real3 norm, ptA, ptB;
+    real depth;
+    int num_contacts = 0;
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++)
+            num_contacts += ChNarrowphase::MPRCollision(&shapesA[i], &shapesB[i], 0, norm, ptA, ptB, depth);
+        benchmark::DoNotOptimize(num_contacts);
+    }
+
+    st.SetItemsProcessed(st.iterations() * N);
+    st.SetLabel(GetSimdDispatchTarget());
+}
+
+static void SIMD_PRIMS(benchmark::State& st) {
+    std::vector<ConvexShapeCustom> shapesA;
+    std::vector<ConvexShapeCustom> shapesB;
+    CreatePairs(ChCollisionShape::Type::BOX, ChCollisionShape::Type::BOX, shapesA, shapesB);
+
+    real3 norm[8], ptA[8], ptB[8];
+    real depth[8], eff_radius[8];
+    int num_contacts = 0;
+    for (auto _ : st) {
+        for (int i = 0; i < N; i++) {
+            int nC;
+            ChNarrowphase::PRIMSCollision(&shapesA[i], &shapesB[i], 0, norm, ptA, ptB, depth, eff_radius, nC);
+            num_contacts += nC;
+        }
+        benchmark::DoNotOptimize(num_contacts);
+    }
+
+    st.SetItemsProcessed(st.iterations() * N);
+    st.SetLabel(GetSimdDispatchTarget());
+}
+
+// -----------------------------------------------------------------------------
+
+BENCHMARK(SIMD_real3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SIMD_quaternion)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SIMD_Mat33)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SIMD_MPR)->Unit(benchmark::kMicrosecond);
+BENCHMARK(SIMD_PRIMS)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the Bullet collision system with different broadphase types and
+// numbers of collision threads. A pile of boxes and spheres is settled for a few
+// steps; all configurations must report the same set of contacts.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ContactRecord {
+    ChVector3d pA;
+    ChVector3d pB;
+    double distance;
+
+    bool operator<(const ContactRecord& other) const {
+        if (pA.x() != other.pA.x())
+            return pA.x() < other.pA.x();
+        if (pA.y() != other.pA.y())
+            return pA.y() < other.pA.y();
+        return pA.z() < other.pA.z();
+    }
+};
+
+class ContactRecorder : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, distance});
+        return true;
+    }
+
+    std::vector<ContactRecord> contacts;
+};
+
+static std::vector<ContactRecord> Collide(ChCollisionSystemBullet::BroadphaseType type, int num_threads) {
+    ChSystemNSC sys;
+    auto coll_sys = chrono_types::make_shared<ChCollisionSystemBullet>();
+    coll_sys->SetBroadphaseType(type, ChAABB(ChVector3d(-10, -10, -10), ChVector3d(10, 10, 20)));
+    sys.SetCollisionSystem(coll_sys);
+    sys.SetNumThreads(1, num_threads, 1);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Pile of overlapping shapes with varying orientations
+    int n = 8;
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                std::shared_ptr<ChBody> body;
+                if ((ix + iy + iz) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.5, 0.4, 1000, false, true, mat);
+                double angle = std::sin(1.0 + ix * 7 + iy * 13 + iz * 29) * CH_PI;
+                body->SetPos(ChVector3d(-2.8 + ix * 0.55, -2.8 + iy * 0.55, 0.3 + iz * 0.5));
+                body->SetRot(QuatFromAngleAxis(angle, ChVector3d(1, 2, 3).GetNormalized()));
+                sys.AddBody(body);
+            }
+        }
+    }
+
+    // Contacts are detected at the beginning of the step, for the initial configuration
+    sys.DoStepDynamics(1e-6);
+
+    auto recorder = chrono_types::make_shared<ContactRecorder>();
+    sys.GetContactContainer()->ReportAllContacts(recorder);
+
+    std::sort(recorder->contacts.begin(), recorder->contacts.end());
+    return recorder->contacts;
+}
+
+TEST(ChCollisionSystemBullet, broadphase_threads) {
+    auto contacts_ref = Collide(ChCollisionSystemBullet::BroadphaseType::DBVT, 1);
+    ASSERT_GT(contacts_ref.size(), 100u);
+
+    for (auto type : {ChCollisionSystemBullet::BroadphaseType::DBVT, ChCollisionSystemBullet::BroadphaseType::SAP}) {
+        for (int num_threads : {1, 4}) {
+            auto contacts = Collide(type, num_threads);
+            ASSERT_EQ(contacts.size(), contacts_ref.size());
+            for (size_t i = 0; i < contacts.size(); i++) {
+                ASSERT_NEAR((contacts[i].pA - contacts_ref[i].pA).Length(), 0.0, 1e-6);
+                ASSERT_NEAR((contacts[i].pB - contacts_ref[i].pB).Length(), 0.0, 1e-6);
+                ASSERT_NEAR(contacts[i].distance, contacts_ref[i].distance, 1e-6);
+            }
+        }
+    }
+}
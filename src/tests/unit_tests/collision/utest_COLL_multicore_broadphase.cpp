@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the broadphase options of the multicore collision system.
+// A pile of shapes falls on a large ground box while a projectile is launched
+// upwards (forcing the collision domain to grow). At each step, the body states
+// of the simulated system are copied to systems using the incremental broadphase
+// and/or the adaptive grid; all systems must report the same set of contacts.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ContactRecord {
+    ChVector3d pA;
+    ChVector3d pB;
+    double distance;
+
+    bool operator<(const ContactRecord& other) const {
+        if (pA.x() != other.pA.x())
+            return pA.x() < other.pA.x();
+        if (pA.y() != other.pA.y())
+            return pA.y() < other.pA.y();
+        return pA.z() < other.pA.z();
+    }
+};
+
+class ContactRecorder : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, distance});
+        return true;
+    }
+
+    std::vector<ContactRecord> contacts;
+};
+
+static void CreateScene(ChSystem& sys, bool incremental, bool adaptive) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    if (adaptive)
+        coll_sys->SetBroadphaseGridAdaptive(2);
+    else
+        coll_sys->SetBroadphaseGridDensity(2);
+    coll_sys->EnableIncrementalBroadphase(incremental, 0.05);
+    coll_sys->SetEnvelope(0.01);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(40, 40, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    // Dense pile of shapes in a small region of the domain
+    int n = 6;
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                std::shared_ptr<ChBody> body;
+                if ((ix + iy + iz) % 2 == 0)
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+                else
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.3, 0.3, 1000, false, true, mat);
+                double angle = std::sin(1.0 + ix * 7 + iy * 13 + iz * 29) * CH_PI;
+                body->SetPos(ChVector3d(ix * 0.41, iy * 0.41, 0.3 + iz * 0.45));
+                body->SetRot(QuatFromAngleAxis(angle, ChVector3d(1, 2, 3).GetNormalized()));
+                sys.AddBody(body);
+            }
+        }
+    }
+
+    // Projectile leaving the initial collision domain
+    auto projectile = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+    projectile->SetPos(ChVector3d(10, 10, 1));
+    projectile->SetPosDt(ChVector3d(0, 0, 30));
+    sys.AddBody(projectile);
+
+    sys.DoStepDynamics(1e-6);
+}
+
+static std::vector<ContactRecord> Collide(ChSystem& sys) {
+    sys.ComputeCollisions();
+
+    auto recorder = chrono_types::make_shared<ContactRecorder>();
+    sys.GetContactContainer()->ReportAllContacts(recorder);
+
+    std::sort(recorder->contacts.begin(), recorder->contacts.end());
+    return recorder->contacts;
+}
+
+TEST(ChBroadphase, incremental_adaptive) {
+    ChSystemNSC sys_ref;
+    CreateScene(sys_ref, false, false);
+
+    std::vector<std::unique_ptr<ChSystemNSC>> systems;
+    for (auto incremental : {false, true}) {
+        for (auto adaptive : {false, true}) {
+            if (!incremental && !adaptive)
+                continue;
+            systems.push_back(chrono_types::make_unique<ChSystemNSC>());
+            CreateScene(*systems.back(), incremental, adaptive);
+        }
+    }
+
+    const auto& bodies_ref = sys_ref.GetBodies();
+
+    size_t max_contacts = 0;
+    for (int frame = 0; frame < 200; frame++) {
+        sys_ref.DoStepDynamics(2e-3);
+        auto contacts_ref = Collide(sys_ref);
+        max_contacts = std::max(max_contacts, contacts_ref.size());
+
+        for (auto& sys : systems) {
+            const auto& bodies = sys->GetBodies();
+            for (size_t i = 0; i < bodies.size(); i++) {
+                bodies[i]->SetPos(bodies_ref[i]->GetPos());
+                bodies[i]->SetRot(bodies_ref[i]->GetRot());
+            }
+
+            auto contacts = Collide(*sys);
+            ASSERT_EQ(contacts.size(), contacts_ref.size()) << "frame " << frame;
+            for (size_t i = 0; i < contacts.size(); i++) {
+                ASSERT_NEAR((contacts[i].pA - contacts_ref[i].pA).Length(), 0.0, 1e-10);
+                ASSERT_NEAR((contacts[i].pB - contacts_ref[i].pB).Length(), 0.0, 1e-10);
+                ASSERT_NEAR(contacts[i].distance, contacts_ref[i].distance, 1e-10);
+            }
+        }
+    }
+
+    ASSERT_GT(max_contacts, 100u);
+}
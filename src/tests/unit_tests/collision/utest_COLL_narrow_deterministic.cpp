@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the deterministic narrowphase of the multicore collision system.
+// A block of overlapping spheres, boxes, ellipsoids, and cylinders is processed
+// with different numbers of threads. With the deterministic narrowphase, the
+// lists of contacts reported to the contact container must be bitwise identical.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ContactRecord {
+    ChVector3d pA;
+    ChVector3d pB;
+    ChVector3d normal;
+    double distance;
+    double eff_radius;
+};
+
+class ContactRecorder : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, plane_coord.GetAxisX(), distance, eff_radius});
+        return true;
+    }
+
+    std::vector<ContactRecord> contacts;
+};
+
+static std::vector<ContactRecord> Collide(ChNarrowphase::Algorithm algorithm, int num_threads) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys.SetNumThreads(1, num_threads, 1);
+
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemMulticore>(sys.GetCollisionSystem());
+    coll_sys->SetNarrowphaseAlgorithm(algorithm);
+    coll_sys->SetDeterministicNarrowphase(true);
+    coll_sys->SetBroadphaseGridResolution(ChVector3i(5, 5, 5));
+    coll_sys->SetEnvelope(0.01);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+
+    // Block of shapes, placed closer than their size and with varying orientations
+    int n = 12;
+    double spacing = 0.9;
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            for (int iz = 0; iz < n; iz++) {
+                std::shared_ptr<ChBody> body;
+                switch ((ix + iy + iz) % 4) {
+                    case 0:
+                        body = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+                        break;
+                    case 1:
+                        body = chrono_types::make_shared<ChBodyEasyBox>(0.9, 0.8, 0.7, 1000, false, true, mat);
+                        break;
+                    case 2:
+                        body = chrono_types::make_shared<ChBodyEasyEllipsoid>(ChVector3d(0.8, 1.0, 1.2), 1000, false,
+                                                                              true, mat);
+                        break;
+                    case 3:
+                        body = chrono_types::make_shared<ChBodyEasyCylinder>(ChAxis::Y, 0.4, 0.8, 1000, false, true,
+                                                                             mat);
+                        break;
+                }
+                double angle = std::sin(1.0 + ix * 7 + iy * 13 + iz * 29) * CH_PI;
+                body->SetPos(ChVector3d(ix * spacing, iy * spacing, iz * spacing));
+                body->SetRot(QuatFromAngleAxis(angle, ChVector3d(1, 2, 3).GetNormalized()));
+                sys.AddBody(body);
+            }
+        }
+    }
+
+    // Contacts are detected at the beginning of the step, for the initial configuration
+    sys.DoStepDynamics(1e-6);
+
+    auto recorder = chrono_types::make_shared<ContactRecorder>();
+    sys.GetContactContainer()->ReportAllContacts(recorder);
+
+    return recorder->contacts;
+}
+
+static void Compare(ChNarrowphase::Algorithm algorithm) {
+    auto contacts_1 = Collide(algorithm, 1);
+    ASSERT_GT(contacts_1.size(), 1000u);
+
+    for (int num_threads : {2, 3, 8}) {
+        auto contacts_n = Collide(algorithm, num_threads);
+        ASSERT_EQ(contacts_n.size(), contacts_1.size());
+
+        // Contact data must be bitwise identical, in the same order
+        for (size_t i = 0; i < contacts_1.size(); i++) {
+            ASSERT_EQ(contacts_n[i].pA, contacts_1[i].pA);
+            ASSERT_EQ(contacts_n[i].pB, contacts_1[i].pB);
+            ASSERT_EQ(contacts_n[i].normal, contacts_1[i].normal);
+            ASSERT_EQ(contacts_n[i].distance, contacts_1[i].distance);
+            ASSERT_EQ(contacts_n[i].eff_radius, contacts_1[i].eff_radius);
+        }
+    }
+}
+
+TEST(ChNarrowphase, deterministic_hybrid) {
+    Compare(ChNarrowphase::Algorithm::HYBRID);
+}
+
+TEST(ChNarrowphase, deterministic_mpr) {
+    Compare(ChNarrowphase::Algorithm::MPR);
+}
@@ -0,0 +1,134 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for batched ray casting (ChCollisionSystem::RayHitBatch).
+// A set of shapes resting on a ground box is probed with a packet of parallel
+// vertical rays and with a batch of rays in arbitrary directions. The batched
+// results must match those of individual RayHit calls, for the Bullet and (if
+// available) the multicore collision systems.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static void CreateScene(ChSystem& sys) {
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(12, 12, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    int n = 6;
+    for (int ix = 0; ix < n; ix++) {
+        for (int iy = 0; iy < n; iy++) {
+            std::shared_ptr<ChBody> body;
+            if ((ix + iy) % 2 == 0)
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.4, 1000, false, true, mat);
+            else
+                body = chrono_types::make_shared<ChBodyEasyBox>(0.8, 0.6, 0.5, 1000, false, true, mat);
+            double angle = std::sin(1.0 + ix * 7 + iy * 13) * CH_PI;
+            body->SetPos(ChVector3d(-4.5 + ix * 1.8, -4.5 + iy * 1.8, 0.5 + 0.2 * ((ix * iy) % 3)));
+            body->SetRot(QuatFromAngleAxis(angle, ChVector3d(1, 2, 3).GetNormalized()));
+            body->SetFixed(true);
+            sys.AddBody(body);
+        }
+    }
+
+    // Collision detection is performed at the beginning of the step, which also updates all bounding boxes
+    sys.DoStepDynamics(1e-6);
+}
+
+static void CheckResults(const ChCollisionSystem& coll_sys,
+                         const std::vector<ChVector3d>& from,
+                         const std::vector<ChVector3d>& to,
+                         const ChCollisionSystem::ChRayhitResults& results,
+                         int num_hits) {
+    ASSERT_EQ(results.hit.size(), from.size());
+
+    int expected_hits = 0;
+    for (size_t i = 0; i < from.size(); i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        coll_sys.RayHit(from[i], to[i], result);
+        ASSERT_EQ(results.hit[i] != 0, result.hit) << "ray " << i;
+        if (!result.hit)
+            continue;
+        expected_hits++;
+        ASSERT_EQ(results.hitModel[i], result.hitModel) << "ray " << i;
+        ASSERT_NEAR(results.dist_factor[i], result.dist_factor, 1e-9) << "ray " << i;
+        ASSERT_NEAR((results.abs_hitPoint[i] - result.abs_hitPoint).Length(), 0.0, 1e-9) << "ray " << i;
+        ASSERT_NEAR((results.abs_hitNormal[i] - result.abs_hitNormal).Length(), 0.0, 1e-9) << "ray " << i;
+    }
+
+    ASSERT_EQ(num_hits, expected_hits);
+}
+
+static void Compare(ChCollisionSystem::Type type, int num_threads) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(type);
+    sys.SetNumThreads(1, num_threads, 1);
+    CreateScene(sys);
+
+    const auto& coll_sys = *sys.GetCollisionSystem();
+    ChCollisionSystem::ChRayhitResults results;
+
+    // Packet of parallel vertical rays over a regular grid (some of them miss the ground)
+    ChVector3d ray(0, 0, -4);
+    std::vector<ChVector3d> from;
+    std::vector<ChVector3d> to;
+    for (int i = 0; i < 70; i++) {
+        for (int j = 0; j < 70; j++) {
+            from.push_back(ChVector3d(-7 + i * 0.2, -7 + j * 0.2, 2));
+            to.push_back(from.back() + ray);
+        }
+    }
+
+    int num_hits = coll_sys.RayHitBatch(from, ray, results);
+    ASSERT_GT(num_hits, 0);
+    ASSERT_LT(num_hits, (int)from.size());
+    CheckResults(coll_sys, from, to, results, num_hits);
+
+    // Batch of rays in arbitrary directions
+    from.clear();
+    to.clear();
+    for (int i = 0; i < 2000; i++) {
+        double a = 0.37 * i;
+        double b = 0.11 * i;
+        from.push_back(ChVector3d(6 * std::sin(a), 6 * std::cos(1.3 * a), 1.5 + std::sin(b)));
+        to.push_back(ChVector3d(5 * std::cos(0.7 * b), 5 * std::sin(1.1 * b), -1.0 + 0.5 * std::cos(a)));
+    }
+
+    num_hits = coll_sys.RayHitBatch(from, to, results);
+    ASSERT_GT(num_hits, 0);
+    CheckResults(coll_sys, from, to, results, num_hits);
+}
+
+TEST(ChCollisionSystemBullet, raycast_batch) {
+    Compare(ChCollisionSystem::Type::BULLET, 1);
+    Compare(ChCollisionSystem::Type::BULLET, 4);
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChCollisionSystemMulticore, raycast_batch) {
+    Compare(ChCollisionSystem::Type::MULTICORE, 1);
+    Compare(ChCollisionSystem::Type::MULTICORE, 4);
+}
+#endif
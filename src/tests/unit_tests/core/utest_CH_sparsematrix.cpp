@@ -17,11 +17,13 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
+#include "chrono/solver/ChDirectSolverLS.h"
 
 #include "gtest/gtest.h"
 
@@ -75,3 +77,52 @@ TEST(SparseMatrix, pattern_learner) {
     ASSERT_NEAR(spmat_mirror.valuePtr()[2], 2.2, precision);
     ASSERT_NEAR(spmat_mirror.valuePtr()[3], 3.3, precision);
 }
+
+// ------------------------------------------------------------------
+
+// Load a nonsymmetric banded matrix with the given pattern (bandwidth) and values depending on k.
+static void LoadBandedMatrix(ChSparseMatrix& A, int n, int band, double k) {
+    A.resize(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = std::max(0, i - band); j <= std::min(n - 1, i + band); j++)
+            A.SetElement(i, j, (i == j) ? 4.0 * band + k : 1.0 / (3 + band + k + i - j));
+    }
+    A.makeCompressed();
+}
+
+template <typename Solver>
+static void CheckSymbolicReuse() {
+    int n = 50;
+    Solver solver;
+    solver.LockSparsityPattern(true);
+
+    // Same pattern, different values: the symbolic analysis is performed only once
+    for (int k = 0; k < 5; k++) {
+        LoadBandedMatrix(solver.A(), n, 2, k);
+        solver.b() = ChVectorDynamic<>::LinSpaced(n, 1.0, 2.0);
+        ASSERT_TRUE(solver.SetupCurrent());
+        solver.SolveCurrent();
+        ASSERT_NEAR((solver.A() * solver.x() - solver.b()).norm(), 0, precision);
+    }
+    ASSERT_EQ(solver.GetNumAnalysisCalls(), 1);
+
+    // Different pattern: a new symbolic analysis is performed
+    LoadBandedMatrix(solver.A(), n, 3, 0);
+    ASSERT_TRUE(solver.SetupCurrent());
+    solver.SolveCurrent();
+    ASSERT_NEAR((solver.A() * solver.x() - solver.b()).norm(), 0, precision);
+    ASSERT_EQ(solver.GetNumAnalysisCalls(), 2);
+
+    // No reuse: the symbolic analysis is performed at each call
+    solver.EnableSymbolicFactorizationReuse(false);
+    ASSERT_TRUE(solver.SetupCurrent());
+    ASSERT_EQ(solver.GetNumAnalysisCalls(), 3);
+}
+
+TEST(SparseMatrix, symbolic_reuse_LU) {
+    CheckSymbolicReuse<ChSolverSparseLU>();
+}
+
+TEST(SparseMatrix, symbolic_reuse_QR) {
+    CheckSymbolicReuse<ChSolverSparseQR>();
+}
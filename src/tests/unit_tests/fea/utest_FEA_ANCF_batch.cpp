@@ -0,0 +1,247 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the batched evaluation of ANCF element internal forces.
+// Meshes of hexahedral (3843), shell (3833, two layers), and beam (3333)
+// elements are deformed and set in motion. Internal forces evaluated in batch
+// (with and without damping, including elements that fall back to individual
+// evaluation) must match those evaluated element by element.
+//
+// =============================================================================
+
+#include <cmath>
+#include <map>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/fea/ChElementANCFBatch.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Number of elements of each type (not a multiple of the lane width, to exercise partially filled groups)
+static const int num_elements = 7;
+
+static void AddHexaElements(std::shared_ptr<ChMesh> mesh) {
+    auto material = chrono_types::make_shared<ChMaterialHexaANCF>(7850, 2e9, 0.3);
+
+    double dx = 0.1;
+    double dy = 0.05;
+    double dz = 0.02;
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> bottom, top;
+    for (int i = 0; i <= num_elements; i++) {
+        for (int j = 0; j <= 1; j++) {
+            bottom.push_back(chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(i * dx, j * dy, 0), VECT_X,
+                                                                          VECT_Y, VECT_Z));
+            top.push_back(chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(i * dx, j * dy, dz), VECT_X, VECT_Y,
+                                                                       VECT_Z));
+            mesh->AddNode(bottom.back());
+            mesh->AddNode(top.back());
+        }
+    }
+
+    for (int i = 0; i < num_elements; i++) {
+        auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+        element->SetNodes(bottom[2 * i], bottom[2 * i + 2], bottom[2 * i + 3], bottom[2 * i + 1], top[2 * i],
+                          top[2 * i + 2], top[2 * i + 3], top[2 * i + 1]);
+        element->SetDimensions(dx, dy, dz);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(i % 2 == 0 ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+}
+
+static void AddShellElements(std::shared_ptr<ChMesh> mesh) {
+    auto material_iso = chrono_types::make_shared<ChMaterialShellANCF>(7850, 2e9, 0.3);
+    auto material_ort = chrono_types::make_shared<ChMaterialShellANCF>(1000, ChVector3d(2e8, 1e8, 1e8),
+                                                                       ChVector3d(0.3, 0.2, 0.2),
+                                                                       ChVector3d(5e7, 4e7, 4e7));
+
+    // Corner and mid-side nodes on a grid of half-element spacing
+    double dx = 0.1;
+    double dy = 0.1;
+    std::map<std::pair<int, int>, std::shared_ptr<ChNodeFEAxyzDD>> nodes;
+    auto node = [&](int i, int j) {
+        auto& n = nodes[{i, j}];
+        if (!n) {
+            n = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(i * dx / 2, j * dy / 2, 0.5), VECT_Z, VNULL);
+            mesh->AddNode(n);
+        }
+        return n;
+    };
+
+    for (int i = 0; i < num_elements; i++) {
+        auto element = chrono_types::make_shared<ChElementShellANCF_3833>();
+        element->SetNodes(node(2 * i, 0), node(2 * i + 2, 0), node(2 * i + 2, 2), node(2 * i, 2),  //
+                          node(2 * i + 1, 0), node(2 * i + 2, 1), node(2 * i + 1, 2), node(2 * i, 1));
+        element->SetDimensions(dx, dy);
+        element->AddLayer(0.005, 0, material_iso);
+        element->AddLayer(0.005, 30 * CH_DEG_TO_RAD, material_ort);
+        element->SetAlphaDamp(i % 2 == 0 ? 0.01 : 0.0);
+        mesh->AddElement(element);
+    }
+}
+
+static void AddBeamElements(std::shared_ptr<ChMesh> mesh) {
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2e9, 0.3, 0.85, 0.85);
+
+    double dx = 0.1;
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(0, 0, 1), VECT_Y, VECT_Z);
+    mesh->AddNode(nodeA);
+    for (int i = 0; i < num_elements; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d((i + 0.5) * dx, 0, 1), VECT_Y, VECT_Z);
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d((i + 1) * dx, 0, 1), VECT_Y, VECT_Z);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3333>();
+        element->SetNodes(nodeA, nodeB, nodeC);
+        element->SetDimensions(dx, 0.01, 0.02);
+        element->SetMaterial(material);
+        element->SetAlphaDamp(i % 2 == 0 ? 0.01 : 0.0);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+    }
+}
+
+// Perturb the nodal coordinates and set nodal velocities
+static void Deform(std::shared_ptr<ChMesh> mesh) {
+    for (unsigned int in = 0; in < mesh->GetNumNodes(); in++) {
+        double s = std::sin(1.0 + 7.0 * in);
+        double t = std::cos(2.0 + 3.0 * in);
+        ChVector3d dp(0.002 * s, 0.003 * t, -0.001 * s * t);
+        ChVector3d dv(0.1 * t, -0.2 * s, 0.3 * s * t);
+
+        auto node = std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(in));
+        node->SetPos(node->GetPos() + dp);
+        node->SetPosDt(dv);
+        node->SetSlope1(node->GetSlope1() + 0.5 * dp);
+        node->SetSlope1Dt(0.5 * dv);
+        if (auto node2 = std::dynamic_pointer_cast<ChNodeFEAxyzDD>(node)) {
+            node2->SetSlope2(node2->GetSlope2() - 0.3 * dp);
+            node2->SetSlope2Dt(-0.3 * dv);
+        }
+        if (auto node3 = std::dynamic_pointer_cast<ChNodeFEAxyzDDD>(node)) {
+            node3->SetSlope3(node3->GetSlope3() + 0.2 * dp);
+            node3->SetSlope3Dt(0.2 * dv);
+        }
+    }
+}
+
+// Compare batched and individual evaluation of the internal forces for all elements in the given mesh
+static void CheckBatch(std::shared_ptr<ChMesh> mesh) {
+    ChElementANCFBatch batch;
+    for (auto& element : mesh->GetElements())
+        ASSERT_TRUE(batch.AddElement(element));
+    ASSERT_EQ(batch.GetNumElements(), (unsigned int)num_elements);
+
+    batch.ComputeInternalForces(2);
+
+    for (unsigned int i = 0; i < batch.GetNumElements(); i++) {
+        auto element = batch.GetElement(i);
+        ChVectorDynamic<> Fi(element->GetNumCoordsPosLevel());
+        element->ComputeInternalForces(Fi);
+
+        const auto& Fi_batch = batch.GetInternalForces(i);
+        ASSERT_EQ(Fi_batch.size(), Fi.size());
+        ASSERT_GT(Fi.norm(), 0.0);
+        ASSERT_LT((Fi_batch - Fi).norm(), 1e-10 * Fi.norm()) << "element " << i;
+    }
+}
+
+TEST(ChElementANCFBatch, internal_forces) {
+    ChSystemSMC sys;
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    auto mesh_hexa = chrono_types::make_shared<ChMesh>();
+    auto mesh_shell = chrono_types::make_shared<ChMesh>();
+    auto mesh_beam = chrono_types::make_shared<ChMesh>();
+    AddHexaElements(mesh_hexa);
+    AddShellElements(mesh_shell);
+    AddBeamElements(mesh_beam);
+    sys.Add(mesh_hexa);
+    sys.Add(mesh_shell);
+    sys.Add(mesh_beam);
+
+    // Initialize the system (precompute the element integration data), then deform the meshes
+    sys.DoStepDynamics(1e-6);
+    Deform(mesh_hexa);
+    Deform(mesh_shell);
+    Deform(mesh_beam);
+
+    CheckBatch(mesh_hexa);
+    CheckBatch(mesh_shell);
+    CheckBatch(mesh_beam);
+
+    // Elements of different types are not batched together
+    ChElementANCFBatch batch;
+    ASSERT_TRUE(batch.AddElement(mesh_hexa->GetElements()[0]));
+    ASSERT_FALSE(batch.AddElement(mesh_beam->GetElements()[0]));
+
+    // Elements switched to the "Pre-Integration" method are evaluated individually
+    auto element = std::dynamic_pointer_cast<ChElementShellANCF_3833>(mesh_shell->GetElements()[3]);
+    ChElementANCFBatch batch_shell;
+    for (auto& e : mesh_shell->GetElements())
+        ASSERT_TRUE(batch_shell.AddElement(e));
+    element->SetIntFrcCalcMethod(ChElementShellANCF_3833::IntFrcMethod::PreInt);
+    batch_shell.ComputeInternalForces(1);
+
+    ChVectorDynamic<> Fi(element->GetNumCoordsPosLevel());
+    element->ComputeInternalForces(Fi);
+    ASSERT_LT((batch_shell.GetInternalForces(3) - Fi).norm(), 1e-12 * Fi.norm());
+}
+
+TEST(ChMesh, batched_internal_forces) {
+    ChSystemSMC sys;
+    sys.SetNumThreads(4);
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    AddHexaElements(mesh);
+    AddShellElements(mesh);
+    AddBeamElements(mesh);
+    sys.Add(mesh);
+
+    sys.DoStepDynamics(1e-6);
+    Deform(mesh);
+    sys.Update(false);
+
+    unsigned int nv = sys.GetNumCoordsVelLevel();
+
+    // Individual evaluation
+    ChVectorDynamic<> R = ChVectorDynamic<>::Zero(nv);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R, 0.5);
+    ASSERT_EQ(mesh->GetNumElementBatches(), 0);
+
+    // Batched evaluation, with the default (atomic) and colored assembly
+    mesh->EnableBatchedInternalForces(true);
+    ChVectorDynamic<> R_batched = ChVectorDynamic<>::Zero(nv);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_batched, 0.5);
+
+    mesh->EnableColoredAssembly(true);
+    ChVectorDynamic<> R_batched_colored = ChVectorDynamic<>::Zero(nv);
+    mesh->IntLoadResidual_F(mesh->GetOffset_w(), R_batched_colored, 0.5);
+
+    // One batch per element type (none if the library was built without SIMD support)
+    ASSERT_EQ(mesh->GetNumElementBatches(), ChElementANCFBatch::GetLaneWidth() > 1 ? 3 : 0);
+
+    ASSERT_GT(R.norm(), 1.0);
+    ASSERT_LT((R_batched - R).norm(), 1e-10 * R.norm());
+    ASSERT_LT((R_batched_colored - R).norm(), 1e-10 * R.norm());
+}
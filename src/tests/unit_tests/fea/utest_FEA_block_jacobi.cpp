@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the block-Jacobi preconditioner of the matrix-free iterative
+// linear solvers. An ANCF cantilever beam bends under gravity. Results obtained
+// with GMRES and the block-Jacobi preconditioner must match those obtained with
+// a direct sparse solver, using fewer iterations than with the diagonal
+// preconditioner.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+struct Result {
+    ChVector3d tip_pos;
+    int max_iterations;
+};
+
+static Result Simulate(std::shared_ptr<ChSolver> solver) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    sys.SetSolver(solver);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto material = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2e8, 0.3, 0.85, 0.85);
+
+    ChBuilderBeamANCF_3333 builder;
+    builder.BuildBeam(mesh, material, 10, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), 0.02, 0.02, VECT_Y, VECT_Z, true);
+    builder.GetLastBeamNodes().front()->SetFixed(true);
+    auto tip = builder.GetLastBeamNodes().back();
+
+    int max_iterations = 0;
+    auto iterative = std::dynamic_pointer_cast<ChIterativeSolverLS>(solver);
+    for (int i = 0; i < 20; i++) {
+        sys.DoStepDynamics(1e-3);
+        if (iterative)
+            max_iterations = std::max(max_iterations, iterative->GetIterations());
+    }
+
+    return {tip->GetPos(), max_iterations};
+}
+
+static std::shared_ptr<ChSolverGMRES> CreateGMRES(bool block_jacobi) {
+    auto solver = chrono_types::make_shared<ChSolverGMRES>();
+    solver->SetMaxIterations(2000);
+    solver->SetTolerance(1e-12);
+    solver->EnableDiagonalPreconditioner(true);
+    solver->EnableBlockJacobiPreconditioner(block_jacobi);
+    return solver;
+}
+
+TEST(ChIterativeSolverLS, block_jacobi) {
+    auto direct = Simulate(chrono_types::make_shared<ChSolverSparseLU>());
+    auto diagonal = Simulate(CreateGMRES(false));
+    auto block = Simulate(CreateGMRES(true));
+
+    // The beam tip moved under gravity
+    ASSERT_LT(direct.tip_pos.z(), -1e-4);
+
+    // The block-Jacobi preconditioner reduces the number of iterations
+    ASSERT_GT(block.max_iterations, 0);
+    ASSERT_LT(block.max_iterations, diagonal.max_iterations);
+
+    // Same results as with the direct solver
+    ASSERT_NEAR((block.tip_pos - direct.tip_pos).Length(), 0.0, 1e-8);
+}
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the Newton matrix reuse policy of the implicit integrators.
+// A flexible cantilever beam swings under gravity. For each implicit integrator,
+// the results obtained when reusing the Newton matrix across iterations and
+// steps must match those of a full Newton iteration, with fewer Setup calls.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+using JacobianUpdate = ChImplicitIterativeTimestepper::JacobianUpdate;
+
+struct Result {
+    ChVector3d tip_pos;
+    unsigned long num_iters;
+    unsigned long num_setups;
+};
+
+static Result Simulate(ChTimestepper::Type type, JacobianUpdate update) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->UseSparsityPatternLearner(true);
+    solver->LockSparsityPattern(true);
+    sys.SetSolver(solver);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto section = chrono_types::make_shared<ChBeamSectionEulerEasyRectangular>(0.01, 0.01, 1e7, 1e7 * 0.38, 1000);
+
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, 10, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), VECT_Y);
+    builder.GetLastBeamNodes().front()->SetFixed(true);
+    auto tip = builder.GetLastBeamNodes().back();
+
+    sys.SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    integrator->SetMaxIters(50);
+    integrator->SetAbsTolerances(1e-10);
+    integrator->SetJacobianUpdateMethod(update);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper())) {
+        hht->SetStepControl(false);
+        hht->SetRelTolerance(1e-8);
+    }
+
+    for (int i = 0; i < 200; i++)
+        sys.DoStepDynamics(1e-3);
+
+    return {tip->GetPos(), integrator->GetTotalNumIterations(), integrator->GetTotalNumSetupCalls()};
+}
+
+static void Compare(ChTimestepper::Type type) {
+    auto full = Simulate(type, JacobianUpdate::EVERY_ITERATION);
+    auto modified = Simulate(type, JacobianUpdate::EVERY_STEP);
+    auto automatic = Simulate(type, JacobianUpdate::AUTOMATIC);
+
+    // The beam tip moved under gravity
+    ASSERT_LT(full.tip_pos.y(), -0.01);
+
+    ASSERT_NEAR((modified.tip_pos - full.tip_pos).Length(), 0, 1e-6);
+    ASSERT_NEAR((automatic.tip_pos - full.tip_pos).Length(), 0, 1e-6);
+
+    // Full Newton updates the matrix at every iteration, modified Newton at most once per step
+    ASSERT_EQ(full.num_setups, full.num_iters);
+    ASSERT_LE(modified.num_setups, 200u);
+    ASSERT_LT(automatic.num_setups, modified.num_setups);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_euler) {
+    Compare(ChTimestepper::Type::EULER_IMPLICIT);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_trapezoidal) {
+    Compare(ChTimestepper::Type::TRAPEZOIDAL);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_newmark) {
+    Compare(ChTimestepper::Type::NEWMARK);
+}
+
+TEST(ChImplicitIterativeTimestepper, jacobian_reuse_hht) {
+    Compare(ChTimestepper::Type::HHT);
+}
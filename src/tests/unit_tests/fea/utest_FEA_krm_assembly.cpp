@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the direct assembly of KRM blocks in a locked sparsity pattern.
+// A flexible cantilever beam, connected at its tip to a rigid body, swings under
+// gravity. The system matrices assembled through the cached KRM positions (with
+// multiple threads) and the simulation results must match those obtained with
+// the regular assembly.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+
+#include "chrono/fea/ChBuilderBeam.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+struct Result {
+    ChVector3d tip_pos;
+    ChSparseMatrix matrix;
+    bool used_direct;
+};
+
+static Result Simulate(bool direct) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT);
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    solver->LockSparsityPattern(true);
+    solver->EnableDirectKRMAssembly(direct, 4);
+    sys.SetSolver(solver);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    auto section = chrono_types::make_shared<ChBeamSectionEulerEasyRectangular>(0.01, 0.01, 1e7, 1e7 * 0.38, 1000);
+
+    ChBuilderBeamEuler builder;
+    builder.BuildBeam(mesh, section, 20, ChVector3d(0, 0, 0), ChVector3d(1, 0, 0), VECT_Y);
+    builder.GetLastBeamNodes().front()->SetFixed(true);
+    auto tip = builder.GetLastBeamNodes().back();
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(0.1);
+    body->SetInertiaXX(ChVector3d(1e-4, 1e-4, 1e-4));
+    body->SetPos(ChVector3d(1, 0, 0));
+    sys.AddBody(body);
+
+    auto link = chrono_types::make_shared<ChLinkMateFix>();
+    link->Initialize(tip, body, ChFrame<>(ChVector3d(1, 0, 0)));
+    sys.Add(link);
+
+    bool used_direct = true;
+    for (int i = 0; i < 100; i++) {
+        sys.DoStepDynamics(1e-3);
+        if (i > 0)
+            used_direct = used_direct && solver->UsedDirectKRMAssembly();
+    }
+
+    return {tip->GetPos(), solver->GetMatrix(), used_direct};
+}
+
+TEST(ChDirectSolverLS, krm_assembly) {
+    auto regular = Simulate(false);
+    auto direct = Simulate(true);
+
+    // The regular assembly never uses the cached positions; the direct assembly does after the first call
+    ASSERT_FALSE(regular.used_direct);
+    ASSERT_TRUE(direct.used_direct);
+
+    // The beam tip moved under gravity
+    ASSERT_LT(regular.tip_pos.y(), -1e-3);
+
+    // Same matrix pattern and values (up to the order of summation of KRM contributions)
+    ASSERT_EQ(direct.matrix.rows(), regular.matrix.rows());
+    ASSERT_EQ(direct.matrix.nonZeros(), regular.matrix.nonZeros());
+    ASSERT_LT((ChSparseMatrix(direct.matrix - regular.matrix)).norm(), 1e-12 * regular.matrix.norm());
+
+    // Same results
+    ASSERT_NEAR((direct.tip_pos - regular.tip_pos).Length(), 0.0, 1e-10);
+}
@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the matrix-free Schur complement product of Chrono::Multicore.
+// The same NSC system (a pile of spheres and boxes in a container, plus a
+// pendulum hitting the pile) is simulated with the assembled constraint
+// matrices and with the matrix-free contact Jacobian. The body states and the
+// contact forces must match for all solver modes.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "../ut_utils.h"
+
+using namespace chrono;
+
+static ChSystemMulticoreNSC* CreateSystem(SolverMode mode, bool matrix_free) {
+    auto sys = new ChSystemMulticoreNSC;
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::MULTICORE);
+    sys->SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys->SetNumThreads(1);
+
+    sys->GetSettings()->solver.solver_mode = mode;
+    sys->GetSettings()->solver.max_iteration_normal = 20;
+    sys->GetSettings()->solver.max_iteration_sliding = (mode == SolverMode::NORMAL) ? 0 : 20;
+    sys->GetSettings()->solver.max_iteration_spinning = (mode == SolverMode::SPINNING) ? 20 : 0;
+    sys->GetSettings()->solver.max_iteration_bilateral = 20;
+    sys->GetSettings()->solver.tolerance = 0;
+    sys->GetSettings()->solver.matrix_free_schur = matrix_free;
+    sys->ChangeSolverType(SolverType::APGD);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+    mat->SetRollingFriction(0.01f);
+    mat->SetSpinningFriction(0.01f);
+
+    auto container = utils::CreateBoxContainer(sys, mat, ChVector3d(2, 2, 1), 0.1);
+
+    int id = 0;
+    for (int ix = -2; ix <= 2; ix++) {
+        for (int iy = -2; iy <= 2; iy++) {
+            for (int iz = 0; iz < 3; iz++) {
+                auto body = chrono_types::make_shared<ChBody>();
+                body->SetMass(1);
+                body->SetPos(ChVector3d(0.3 * ix + 0.01 * iz, 0.3 * iy, 0.15 + 0.3 * iz));
+                body->SetRot(QuatFromAngleX(0.1 * id));
+                body->EnableCollision(true);
+                if (id++ % 2 == 0) {
+                    body->SetInertiaXX(ChVector3d(0.004, 0.004, 0.004));
+                    utils::AddSphereGeometry(body.get(), mat, 0.1);
+                } else {
+                    body->SetInertiaXX(ChVector3d(0.006, 0.006, 0.006));
+                    utils::AddBoxGeometry(body.get(), mat, ChVector3d(0.2, 0.2, 0.2));
+                }
+                sys->AddBody(body);
+            }
+        }
+    }
+
+    auto pendulum = chrono_types::make_shared<ChBody>();
+    pendulum->SetMass(5);
+    pendulum->SetInertiaXX(ChVector3d(0.05, 0.05, 0.05));
+    pendulum->SetPos(ChVector3d(0.4, 0, 1.6));
+    pendulum->EnableCollision(true);
+    utils::AddSphereGeometry(pendulum.get(), mat, 0.2);
+    sys->AddBody(pendulum);
+
+    auto revolute = chrono_types::make_shared<ChLinkLockRevolute>();
+    revolute->Initialize(container, pendulum, ChFrame<>(ChVector3d(-0.4, 0, 1.6), QuatFromAngleX(CH_PI_2)));
+    sys->AddLink(revolute);
+
+    return sys;
+}
+
+class MatrixFreeTest : public ::testing::TestWithParam<SolverMode> {};
+
+TEST_P(MatrixFreeTest, compare) {
+    auto sys_ref = CreateSystem(GetParam(), false);
+    auto sys = CreateSystem(GetParam(), true);
+
+    double time_step = 1e-3;
+    unsigned int num_contacts = 0;
+    for (int i = 0; i < 100; i++) {
+        sys_ref->DoStepDynamics(time_step);
+        sys->DoStepDynamics(time_step);
+        num_contacts = std::max(num_contacts, sys->GetNumContacts());
+
+        ASSERT_EQ(sys->GetNumContacts(), sys_ref->GetNumContacts());
+
+        sys_ref->CalculateContactForces();
+        sys->CalculateContactForces();
+
+        const auto& bodies_ref = sys_ref->GetBodies();
+        const auto& bodies = sys->GetBodies();
+        for (size_t ib = 0; ib < bodies.size(); ib++) {
+            ASSERT_NEAR((bodies[ib]->GetPos() - bodies_ref[ib]->GetPos()).Length(), 0, 1e-6);
+            ASSERT_NEAR((bodies[ib]->GetPosDt() - bodies_ref[ib]->GetPosDt()).Length(), 0, 1e-4);
+            ASSERT_NEAR((bodies[ib]->GetAngVelLocal() - bodies_ref[ib]->GetAngVelLocal()).Length(), 0, 1e-4);
+
+            real3 frc = sys->GetBodyContactForce(bodies[ib]);
+            real3 frc_ref = sys_ref->GetBodyContactForce(bodies_ref[ib]);
+            ASSERT_NEAR(Length(frc - frc_ref), 0, 1e-3 * (1 + Length(frc_ref)));
+        }
+    }
+    ASSERT_GT(num_contacts, 20u);
+
+    delete sys;
+    delete sys_ref;
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoMulticore,
+                         MatrixFreeTest,
+                         ::testing::Values(SolverMode::NORMAL, SolverMode::SLIDING, SolverMode::SPINNING));
@@ -0,0 +1,109 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for adaptive step size control of the implicit integrators.
+// A damped mass-spring oscillator is integrated with large macro steps; the
+// integrator takes internal steps based on its local error estimate. Results
+// are compared against the analytical solution, and the number of internal
+// steps must decrease as the oscillation decays.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double mass = 1;
+static const double k = 100;
+static const double c = 2;
+static const double disp0 = 0.1;
+
+// Analytical solution for the displacement of the underdamped oscillator released from rest at displacement disp0
+static double Displacement(double t) {
+    double w0 = std::sqrt(k / mass);
+    double zeta = c / (2 * std::sqrt(k * mass));
+    double wd = w0 * std::sqrt(1 - zeta * zeta);
+    return disp0 * std::exp(-zeta * w0 * t) * (std::cos(wd * t) + zeta * w0 / wd * std::sin(wd * t));
+}
+
+static void Simulate(ChTimestepper::Type type, double tol) {
+    ChSystemSMC sys;
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, 0));
+    sys.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(mass);
+    body->SetPos(ChVector3d(0, disp0, 0));
+    sys.AddBody(body);
+
+    auto spring = chrono_types::make_shared<ChLinkTSDA>();
+    spring->Initialize(ground, body, false, ChVector3d(0, -1, 0), ChVector3d(0, disp0, 0));
+    spring->SetRestLength(1);
+    spring->SetSpringCoefficient(k);
+    spring->SetDampingCoefficient(c);
+    sys.AddLink(spring);
+
+    sys.SetTimestepperType(type);
+    auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(sys.GetTimestepper());
+    integrator->SetMaxIters(20);
+    integrator->SetAbsTolerances(1e-10);
+    integrator->SetErrorControl(true);
+    integrator->SetErrorTolerances(tol, tol * 1e-2);
+    if (auto hht = std::dynamic_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper())) {
+        hht->SetAlpha(0);
+        hht->SetRelTolerance(1e-8);
+    }
+
+    // Macro steps, with internal adaptive substeps
+    double macro_step = 0.1;
+    unsigned int steps_early = 0;
+    unsigned int steps_late = 0;
+    double max_err = 0;
+    for (int i = 0; i < 100; i++) {
+        sys.DoStepDynamics(macro_step);
+
+        ASSERT_NEAR(sys.GetChTime(), (i + 1) * macro_step, 1e-12);
+        ASSERT_GE(integrator->GetNumAcceptedSteps(), 1u);
+
+        if (i < 10)
+            steps_early += integrator->GetNumAcceptedSteps();
+        if (i >= 90)
+            steps_late += integrator->GetNumAcceptedSteps();
+
+        max_err = std::max(max_err, std::abs(body->GetPos().y() - Displacement(sys.GetChTime())));
+    }
+
+    // Fewer internal steps are needed once the oscillation has decayed
+    ASSERT_LT(steps_late, steps_early);
+
+    // The solution tracks the analytical solution
+    ASSERT_LT(max_err, 0.1 * disp0);
+}
+
+TEST(ChTimestepper, adaptive_euler) {
+    Simulate(ChTimestepper::Type::EULER_IMPLICIT, 1e-4);
+}
+
+TEST(ChTimestepper, adaptive_hht) {
+    Simulate(ChTimestepper::Type::HHT, 1e-4);
+}
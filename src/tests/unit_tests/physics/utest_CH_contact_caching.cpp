@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for contact caching in the Bullet collision system.
+// A stack of boxes settles on the ground while a sphere falls next to it. With
+// contact caching enabled, the resting stack must behave as without caching and
+// the falling sphere must still be stopped by the ground.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate(bool caching, int& num_contacts) {
+    ChSystemNSC sys;
+    auto coll_sys = chrono_types::make_shared<ChCollisionSystemBullet>();
+    coll_sys->EnableContactCaching(caching, 1e-4, 1e-3);
+    sys.SetCollisionSystem(coll_sys);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.5));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 5; i++) {
+        auto box = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.2, 1000, false, true, mat);
+        box->SetPos(ChVector3d(0, 0, 0.1 + 0.2 * i));
+        sys.AddBody(box);
+        bodies.push_back(box);
+    }
+
+    auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+    sphere->SetPos(ChVector3d(2, 0, 1.5));
+    sys.AddBody(sphere);
+    bodies.push_back(sphere);
+
+    double step = 1e-3;
+    while (sys.GetChTime() < 1.5)
+        sys.DoStepDynamics(step);
+
+    num_contacts = sys.GetNumContacts();
+
+    std::vector<ChVector3d> pos;
+    for (const auto& body : bodies)
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+TEST(ChCollisionSystemBullet, contact_caching) {
+    int num_contacts_ref;
+    int num_contacts;
+    auto pos_ref = Simulate(false, num_contacts_ref);
+    auto pos = Simulate(true, num_contacts);
+
+    ASSERT_EQ(num_contacts, num_contacts_ref);
+
+    // Resting stack
+    for (size_t i = 0; i < pos.size() - 1; i++) {
+        ASSERT_NEAR((pos[i] - pos_ref[i]).Length(), 0.0, 1e-3);
+        ASSERT_NEAR(pos[i].z(), 0.1 + 0.2 * i, 5e-3);
+    }
+
+    // Sphere at rest on the ground
+    ASSERT_NEAR(pos.back().z(), 0.2, 5e-3);
+}
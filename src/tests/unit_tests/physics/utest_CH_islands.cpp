@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for island decomposition.
+// - solving independent islands concurrently must give the same results as a
+//   global solve (with a fixed number of solver iterations)
+// - a pile of bodies at rest is put to sleep as a whole, while an island with
+//   a moving body is kept awake
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a system with a fixed ground and several stacks of spheres, far apart from each other.
+static ChSystemNSC* CreateSystem(int num_stacks, int stack_height, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    auto sys = new ChSystemNSC;
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(50);
+    solver->SetTolerance(0);
+    sys->SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(40, 1, 40, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys->Add(ground);
+
+    for (int i = 0; i < num_stacks; i++) {
+        for (int j = 0; j < stack_height; j++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+            ball->SetPos(ChVector3d(-15 + 5.0 * i, 0.5 + 1.0 * j, 0));
+            sys->Add(ball);
+            bodies.push_back(ball);
+        }
+    }
+
+    return sys;
+}
+
+TEST(ChSystem, island_solving) {
+    int num_stacks = 4;
+
+    std::vector<std::shared_ptr<ChBody>> bodies_global;
+    std::vector<std::shared_ptr<ChBody>> bodies_islands;
+    auto sys_global = CreateSystem(num_stacks, 3, bodies_global);
+    auto sys_islands = CreateSystem(num_stacks, 3, bodies_islands);
+
+    sys_islands->EnableIslandSolving(true);
+    sys_islands->SetNumThreads(2);
+
+    for (int i = 0; i < 200; i++) {
+        sys_global->DoStepDynamics(1e-3);
+        sys_islands->DoStepDynamics(1e-3);
+    }
+
+    EXPECT_EQ(sys_global->GetNumIslands(), 1);
+    EXPECT_EQ(sys_islands->GetNumIslands(), num_stacks);
+
+    for (size_t i = 0; i < bodies_global.size(); i++) {
+        auto pos_global = bodies_global[i]->GetPos();
+        auto pos_islands = bodies_islands[i]->GetPos();
+        ASSERT_NEAR(pos_global.x(), pos_islands.x(), 1e-10);
+        ASSERT_NEAR(pos_global.y(), pos_islands.y(), 1e-10);
+        ASSERT_NEAR(pos_global.z(), pos_islands.z(), 1e-10);
+    }
+
+    delete sys_global;
+    delete sys_islands;
+}
+
+TEST(ChSystem, island_sleeping) {
+    int stack_height = 3;
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    auto sys = CreateSystem(2, stack_height, bodies);
+    sys->SetSleepingAllowed(true);
+
+    // Keep the bottom sphere of the second stack moving
+    auto moving = bodies[stack_height];
+    moving->SetSleepingAllowed(false);
+
+    for (int i = 0; i < 2000; i++) {
+        moving->SetAngVelParent(ChVector3d(0, 1, 0));
+        sys->DoStepDynamics(1e-3);
+    }
+
+    // The first stack sleeps as a whole, the second stack is kept awake by the moving sphere
+    for (int j = 0; j < stack_height; j++) {
+        ASSERT_TRUE(bodies[j]->IsSleeping());
+        ASSERT_FALSE(bodies[stack_height + j]->IsSleeping());
+    }
+
+    delete sys;
+}
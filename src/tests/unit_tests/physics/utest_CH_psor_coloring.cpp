@@ -0,0 +1,112 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit tests for the graph-colored parallel sweep of the PSOR solver, using
+// several stacks of boxes resting on a fixed ground.
+// - the colored sweep gives bitwise identical results for any number of threads
+// - the colored sweep converges to the results of the sequential sweep
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a system with a fixed ground and several stacks of boxes.
+// If num_threads > 0, the PSOR solver uses the colored sweep with the given number of threads.
+static ChSystemNSC* CreateSystem(int num_threads, int max_iterations, std::vector<std::shared_ptr<ChBody>>& boxes) {
+    auto sys = new ChSystemNSC;
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(max_iterations);
+    solver->SetTolerance(0);
+    if (num_threads > 0) {
+        solver->EnableParallelColoring(true);
+        solver->SetNumThreads(num_threads);
+    }
+    sys->SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.5f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.5, 0));
+    ground->SetFixed(true);
+    sys->Add(ground);
+
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 5; j++) {
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(1, 0.5, 1, 1000, false, true, mat);
+            box->SetPos(ChVector3d(-3 + 2.0 * i + 0.02 * j, 0.25 + 0.5 * j, 0));
+            sys->Add(box);
+            boxes.push_back(box);
+        }
+    }
+
+    return sys;
+}
+
+TEST(ChSolverPSOR, coloring_deterministic) {
+    std::vector<std::shared_ptr<ChBody>> boxes_1;
+    auto sys_1 = CreateSystem(1, 30, boxes_1);
+
+    std::vector<std::vector<std::shared_ptr<ChBody>>> boxes_n(2);
+    std::vector<ChSystemNSC*> sys_n = {CreateSystem(2, 30, boxes_n[0]), CreateSystem(4, 30, boxes_n[1])};
+
+    for (int i = 0; i < 100; i++) {
+        sys_1->DoStepDynamics(1e-3);
+        for (auto sys : sys_n)
+            sys->DoStepDynamics(1e-3);
+    }
+
+    auto solver = std::static_pointer_cast<ChSolverPSOR>(sys_1->GetSolver());
+    EXPECT_GT(solver->GetNumColors(), 1);
+
+    for (size_t k = 0; k < sys_n.size(); k++) {
+        for (size_t i = 0; i < boxes_1.size(); i++) {
+            EXPECT_EQ(boxes_n[k][i]->GetPos(), boxes_1[i]->GetPos());
+            EXPECT_EQ(boxes_n[k][i]->GetRot(), boxes_1[i]->GetRot());
+            EXPECT_EQ(boxes_n[k][i]->GetPosDt(), boxes_1[i]->GetPosDt());
+        }
+        delete sys_n[k];
+    }
+
+    delete sys_1;
+}
+
+TEST(ChSolverPSOR, coloring_convergence) {
+    std::vector<std::shared_ptr<ChBody>> boxes_seq;
+    std::vector<std::shared_ptr<ChBody>> boxes_col;
+    auto sys_seq = CreateSystem(0, 200, boxes_seq);
+    auto sys_col = CreateSystem(2, 200, boxes_col);
+
+    for (int i = 0; i < 100; i++) {
+        sys_seq->DoStepDynamics(1e-3);
+        sys_col->DoStepDynamics(1e-3);
+    }
+
+    for (size_t i = 0; i < boxes_seq.size(); i++) {
+        EXPECT_NEAR((boxes_col[i]->GetPos() - boxes_seq[i]->GetPos()).Length(), 0, 1e-4);
+        EXPECT_NEAR(boxes_col[i]->GetPosDt().Length(), 0, 1e-2);
+    }
+
+    delete sys_seq;
+    delete sys_col;
+}
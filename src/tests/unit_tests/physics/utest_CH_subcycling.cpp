@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for multirate integration with ChSubcycledAssembly.
+// A wheel body, on a revolute joint, is driven by a stiff shaft driveline (a
+// torque applied to an input shaft, a torsional spring, and an output shaft
+// connected to the wheel). The driveline is subcycled inside a large system
+// step; the wheel motion must match that of a monolithic simulation with a
+// small step.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono/physics/ChShaftsTorsionSpring.h"
+#include "chrono/physics/ChShaftBodyConstraint.h"
+#include "chrono/physics/ChSubcycledAssembly.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double torque = 1.0;
+
+// Create the wheel on its revolute joint; return the wheel body
+static std::shared_ptr<ChBody> CreateWheel(ChSystem& sys) {
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto wheel = chrono_types::make_shared<ChBody>();
+    wheel->SetMass(10);
+    wheel->SetInertiaXX(ChVector3d(1, 1, 1));
+    sys.AddBody(wheel);
+
+    auto revolute = chrono_types::make_shared<ChLinkLockRevolute>();
+    revolute->Initialize(ground, wheel, ChFrame<>());
+    sys.AddLink(revolute);
+
+    return wheel;
+}
+
+// Create the driveline items connected to the wheel and return them as a list of physics items
+static std::vector<std::shared_ptr<ChPhysicsItem>> CreateDriveline(std::shared_ptr<ChBody> wheel) {
+    auto shaft_in = chrono_types::make_shared<ChShaft>();
+    shaft_in->SetInertia(0.01);
+    shaft_in->SetAppliedLoad(torque);
+
+    auto shaft_out = chrono_types::make_shared<ChShaft>();
+    shaft_out->SetInertia(0.01);
+
+    auto spring = chrono_types::make_shared<ChShaftsTorsionSpring>();
+    spring->Initialize(shaft_in, shaft_out);
+    spring->SetTorsionalStiffness(1e3);
+    spring->SetTorsionalDamping(1);
+
+    auto connection = chrono_types::make_shared<ChShaftBodyRotation>();
+    connection->Initialize(shaft_out, wheel, ChVector3d(0, 0, 1));
+
+    return {shaft_in, shaft_out, spring, connection};
+}
+
+TEST(ChSubcycledAssembly, driveline) {
+    // Monolithic reference, with a small step
+    ChSystemNSC sys_ref;
+    auto wheel_ref = CreateWheel(sys_ref);
+    for (auto& item : CreateDriveline(wheel_ref))
+        sys_ref.Add(item);
+
+    // Multirate system, with the driveline subcycled
+    ChSystemNSC sys;
+    auto wheel = CreateWheel(sys);
+    auto driveline = chrono_types::make_shared<ChSubcycledAssembly>();
+    driveline->SetNumSubsteps(10);
+    driveline->AddInterfaceBody(wheel);
+    for (auto& item : CreateDriveline(wheel))
+        driveline->Add(item);
+    sys.Add(driveline);
+
+    double step = 1e-2;
+    for (int i = 0; i < 100; i++) {
+        sys.DoStepDynamics(step);
+        for (int k = 0; k < 10; k++)
+            sys_ref.DoStepDynamics(step / 10);
+    }
+
+    ASSERT_NEAR(sys.GetChTime(), 1.0, 1e-10);
+    ASSERT_NEAR(driveline->GetSubsystem().GetChTime(), 1.0, 1e-10);
+
+    // The wheel spins up under the driveline torque (J_total = 1.01)
+    double w_ref = wheel_ref->GetAngVelLocal().z();
+    double w = wheel->GetAngVelLocal().z();
+    ASSERT_NEAR(w_ref, torque / 1.01, 0.05);
+    ASSERT_NEAR(w, w_ref, 0.02 * std::abs(w_ref));
+
+    // The averaged interface torque is close to the applied torque, scaled by the wheel inertia ratio
+    ASSERT_NEAR(driveline->GetInterfaceTorque(0).z(), torque / 1.01, 0.1);
+}
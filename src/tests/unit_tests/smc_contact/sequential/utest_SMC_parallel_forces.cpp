@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test the multithreaded evaluation of SMC contact forces.
+// - the generalized contact forces loaded by the contact container (and the
+//   resulting body states) do not depend on the number of Chrono threads
+// - a user-provided contact force algorithm which is not thread safe is never
+//   called concurrently
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+
+#include "gtest/gtest.h"
+
+#define SMC_SEQUENTIAL
+#include "../utest_SMC.h"
+
+#include "chrono/physics/ChContactSMC.h"
+
+// Custom force algorithm (wrapping the default one) which records the maximum number of concurrent calls.
+class CountingForceTorqueSMC : public ChDefaultContactForceTorqueSMC {
+  public:
+    CountingForceTorqueSMC() : m_active(0), m_max_active(0) {}
+
+    virtual ChWrenchd CalculateForceTorque(const ChSystemSMC& sys,
+                                           const ChVector3d& normal_dir,
+                                           const ChVector3d& p1,
+                                           const ChVector3d& p2,
+                                           const ChVector3d& vel1,
+                                           const ChVector3d& vel2,
+                                           const ChContactMaterialCompositeSMC& mat,
+                                           double delta,
+                                           double eff_radius,
+                                           double mass1,
+                                           double mass2,
+                                           ChContactable* objA,
+                                           ChContactable* objB) const override {
+        int active = ++m_active;
+        int max_active = m_max_active.load();
+        while (active > max_active && !m_max_active.compare_exchange_weak(max_active, active)) {
+        }
+        auto wrench = ChDefaultContactForceTorqueSMC::CalculateForceTorque(
+            sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2, objA, objB);
+        --m_active;
+        return wrench;
+    }
+
+    virtual bool IsThreadSafe() const override { return false; }
+
+    mutable std::atomic<int> m_active;
+    mutable std::atomic<int> m_max_active;
+};
+
+// Create a system with a pile of spheres in contact with a fixed wall.
+static ChSystemSMC* CreateSystem(int num_threads) {
+    auto sys = new ChSystemSMC();
+    SetSimParameters(sys, ChVector3d(0, -9.81, 0), ChSystemSMC::ContactForceModel::Hertz);
+    sys->SetNumThreads(num_threads);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(2e5f);
+    mat->SetFriction(0.3f);
+    mat->SetRestitution(0.3f);
+
+    AddWall(sys, mat, ChVector3d(8, 1, 8), 10.0, ChVector3d(0, -0.5, 0), ChVector3d(0, 0, 0), true);
+
+    for (int ix = 0; ix < 5; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 5; iz++) {
+                ChVector3d pos(-1 + 0.39 * ix + 0.01 * iy, 0.2 + 0.39 * iy, -1 + 0.39 * iz);
+                AddSphere(sys, mat, 0.2, 1.0, pos, ChVector3d(0, -0.5, 0));
+            }
+        }
+    }
+
+    return sys;
+}
+
+static ChVectorDynamic<> LoadContactForces(ChSystemSMC* sys) {
+    ChVectorDynamic<> R(sys->GetNumCoordsVelLevel());
+    R.setZero();
+    sys->GetContactContainer()->IntLoadResidual_F(0, R, 1.0);
+    return R;
+}
+
+TEST(SMCContact, parallel_forces) {
+    ChSystemSMC* sys_1 = CreateSystem(1);
+    ChSystemSMC* sys_n = CreateSystem(4);
+
+    unsigned int num_contacts = 0;
+    for (int i = 0; i < 200; i++) {
+        sys_1->DoStepDynamics(1e-4);
+        sys_n->DoStepDynamics(1e-4);
+
+        ASSERT_EQ(sys_n->GetNumContacts(), sys_1->GetNumContacts());
+        num_contacts = std::max(num_contacts, sys_1->GetNumContacts());
+
+        auto R_1 = LoadContactForces(sys_1);
+        auto R_n = LoadContactForces(sys_n);
+        ASSERT_EQ(R_n.size(), R_1.size());
+        for (int k = 0; k < R_1.size(); k++)
+            ASSERT_EQ(R_n(k), R_1(k));
+    }
+    ASSERT_GT(num_contacts, 50u);
+
+    const auto& bodies_1 = sys_1->GetBodies();
+    const auto& bodies_n = sys_n->GetBodies();
+    for (size_t i = 0; i < bodies_1.size(); i++) {
+        ASSERT_EQ(bodies_n[i]->GetPos(), bodies_1[i]->GetPos());
+        ASSERT_EQ(bodies_n[i]->GetPosDt(), bodies_1[i]->GetPosDt());
+    }
+
+    delete sys_1;
+    delete sys_n;
+}
+
+TEST(SMCContact, custom_force_algorithm) {
+    ChSystemSMC* sys = CreateSystem(4);
+
+    auto algorithm = chrono_types::make_unique<CountingForceTorqueSMC>();
+    auto counter = algorithm.get();
+    sys->SetContactForceTorqueAlgorithm(std::move(algorithm));
+
+    for (int i = 0; i < 100; i++)
+        sys->DoStepDynamics(1e-4);
+
+    ASSERT_GT(sys->GetNumContacts(), 0u);
+    ASSERT_EQ(counter->m_max_active.load(), 1);
+
+    delete sys;
+}
@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the height grid used in RigidTerrain queries on mesh and
+// height-map patches. Terrain height, normal, and friction obtained from the
+// height grid (single and batched queries) must match those of the highest
+// triangle below the query location, found by a brute-force search over the
+// patch meshes. Rays cast into the collision system are not used as reference,
+// since they report hits offset by the collision margin of the mesh triangles.
+//
+// =============================================================================
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/collision/ChCollisionShapeTriangleMesh.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Triangles of a terrain patch, expressed in the absolute frame
+struct PatchTriangles {
+    std::vector<ChVector3d> vertices;
+    float friction;
+};
+
+static PatchTriangles GetTriangles(std::shared_ptr<RigidTerrain::Patch> patch, float friction) {
+    auto body = patch->GetGroundBody();
+    auto shape = std::static_pointer_cast<ChCollisionShapeTriangleMesh>(
+        body->GetCollisionModel()->GetShapeInstance(0).first);
+    auto mesh = shape->GetMesh();
+
+    PatchTriangles triangles;
+    triangles.friction = friction;
+    for (unsigned int k = 0; k < mesh->GetNumTriangles(); k++) {
+        auto tri = mesh->GetTriangle(k);
+        triangles.vertices.push_back(body->TransformPointLocalToParent(tri.p1));
+        triangles.vertices.push_back(body->TransformPointLocalToParent(tri.p2));
+        triangles.vertices.push_back(body->TransformPointLocalToParent(tri.p3));
+    }
+    return triangles;
+}
+
+static void CreateTerrain(ChSystem& sys, RigidTerrain& terrain, std::vector<PatchTriangles>& triangles) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+
+    auto material = chrono_types::make_shared<ChContactMaterialNSC>();
+    material->SetFriction(0.6f);
+    auto patch = terrain.AddPatch(material, ChCoordsys<>(ChVector3d(0, 0, 0), QuatFromAngleZ(0.3)),
+                                  GetDataFile("terrain/meshes/bump.obj"));
+
+    auto material_hmap = chrono_types::make_shared<ChContactMaterialNSC>();
+    material_hmap->SetFriction(0.9f);
+    auto patch_hmap = terrain.AddPatch(material_hmap, ChCoordsys<>(ChVector3d(50, 0, 0), QUNIT),
+                                       GetDataFile("terrain/height_maps/bump64.bmp"), 64, 64, 0, 3);
+
+    terrain.Initialize();
+
+    triangles.push_back(GetTriangles(patch, 0.6f));
+    triangles.push_back(GetTriangles(patch_hmap, 0.9f));
+}
+
+// Find the highest triangle below the specified location (brute-force search)
+static bool FindPoint(const std::vector<PatchTriangles>& triangles,
+                      const ChVector3d& loc,
+                      double& height,
+                      ChVector3d& normal,
+                      float& friction) {
+    bool hit = false;
+    height = std::numeric_limits<double>::lowest();
+    for (const auto& patch : triangles) {
+        for (size_t k = 0; k < patch.vertices.size(); k += 3) {
+            const auto& a = patch.vertices[k];
+            const auto& b = patch.vertices[k + 1];
+            const auto& c = patch.vertices[k + 2];
+            ChVector3d n = Vcross(b - a, c - a);
+            if (std::abs(n.z()) < 1e-10 * n.Length())
+                continue;
+
+            double d0 = (b.x() - loc.x()) * (c.y() - loc.y()) - (c.x() - loc.x()) * (b.y() - loc.y());
+            double d1 = (c.x() - loc.x()) * (a.y() - loc.y()) - (a.x() - loc.x()) * (c.y() - loc.y());
+            double d2 = (a.x() - loc.x()) * (b.y() - loc.y()) - (b.x() - loc.x()) * (a.y() - loc.y());
+            if (!(d0 >= 0 && d1 >= 0 && d2 >= 0) && !(d0 <= 0 && d1 <= 0 && d2 <= 0))
+                continue;
+
+            double z = a.z() - (n.x() * (loc.x() - a.x()) + n.y() * (loc.y() - a.y())) / n.z();
+            if (z <= loc.z() && z > height) {
+                hit = true;
+                height = z;
+                normal = (n.z() > 0 ? 1.0 : -1.0) * n.GetNormalized();
+                friction = patch.friction;
+            }
+        }
+    }
+    return hit;
+}
+
+TEST(RigidTerrain, height_grid) {
+    ChSystemNSC sys;
+    sys.SetNumThreads(4);
+    RigidTerrain terrain(&sys);
+    terrain.UseHeightGrid(true);
+    std::vector<PatchTriangles> triangles;
+    CreateTerrain(sys, terrain, triangles);
+
+    // Query locations over both patches and beyond their boundaries
+    std::vector<ChVector3d> locs;
+    for (int i = 0; i < 2000; i++) {
+        double x = -40 + 130 * (0.5 + 0.5 * std::sin(12.9898 * i));
+        double y = -40 + 80 * (0.5 + 0.5 * std::sin(78.233 * i));
+        locs.push_back(ChVector3d(x, y, 10));
+    }
+
+    std::vector<double> heights;
+    std::vector<ChVector3d> normals;
+    std::vector<float> frictions;
+    terrain.GetProperties(locs, heights, normals, frictions);
+    ASSERT_EQ(heights.size(), locs.size());
+
+    int num_hits = 0;
+    for (size_t i = 0; i < locs.size(); i++) {
+        double height_ref, height_grid;
+        ChVector3d normal_ref, normal_grid;
+        float friction_ref, friction_grid;
+        bool hit_ref = FindPoint(triangles, locs[i], height_ref, normal_ref, friction_ref);
+        bool hit_grid = terrain.FindPoint(locs[i], height_grid, normal_grid, friction_grid);
+
+        ASSERT_EQ(hit_grid, hit_ref) << "location " << locs[i];
+        if (!hit_ref)
+            continue;
+        num_hits++;
+
+        ASSERT_NEAR(height_grid, height_ref, 1e-9) << "location " << locs[i];
+        ASSERT_NEAR((normal_grid - normal_ref).Length(), 0.0, 1e-9) << "location " << locs[i];
+        ASSERT_EQ(friction_grid, friction_ref);
+
+        // Batched queries
+        ASSERT_EQ(heights[i], height_grid);
+        ASSERT_EQ(normals[i], normal_grid);
+        ASSERT_EQ(frictions[i], friction_grid);
+    }
+
+    // Locations over the patches
+    ASSERT_GT(num_hits, 500);
+
+    // Locations below the terrain surface
+    double height;
+    ChVector3d normal;
+    float friction;
+    ASSERT_FALSE(terrain.FindPoint(ChVector3d(0, 0, -10), height, normal, friction));
+}
@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2025 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the sparse grid of modified nodes used by SCMTerrain.
+// Node levels are set at grid locations with negative coordinates and spread
+// over several tiles (forcing the grid to grow in all directions), then read
+// back with SCMTerrain::GetModifiedNodes.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+typedef std::map<std::pair<int, int>, double> LevelMap;
+
+static LevelMap GetLevels(const SCMTerrain& terrain) {
+    LevelMap levels;
+    for (const auto& n : terrain.GetModifiedNodes(true)) {
+        auto key = std::make_pair(n.first.x(), n.first.y());
+        EXPECT_EQ(levels.count(key), 0u) << "node (" << key.first << "," << key.second << ") reported twice";
+        levels[key] = n.second;
+    }
+    return levels;
+}
+
+TEST(SCMTerrain, node_grid) {
+    ChSystemSMC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    SCMTerrain terrain(&sys, false);
+    terrain.Initialize(4, 4, 0.1);
+
+    ASSERT_TRUE(terrain.GetModifiedNodes(true).empty());
+
+    LevelMap expected;
+
+    // First batch: nodes around the origin (including negative coordinates)
+    std::vector<SCMTerrain::NodeLevel> nodes;
+    for (int i = -20; i <= 20; i += 3) {
+        for (int j = -20; j <= 20; j += 4) {
+            double level = -0.001 * (i + 2 * j);
+            nodes.push_back(std::make_pair(ChVector2i(i, j), level));
+            expected[std::make_pair(i, j)] = level;
+        }
+    }
+    terrain.SetModifiedNodes(nodes);
+    ASSERT_EQ(GetLevels(terrain), expected);
+
+    // Second batch: nodes far away in all directions (grid growth across tiles), plus overwritten nodes
+    nodes.clear();
+    std::vector<ChVector2i> locations = {ChVector2i(-1000, -3),  ChVector2i(1000, 5),   ChVector2i(7, -700),
+                                         ChVector2i(-2, 650),    ChVector2i(-33, -33),  ChVector2i(-32, -32),
+                                         ChVector2i(-31, 31),    ChVector2i(32, 31),    ChVector2i(-20, -20),
+                                         ChVector2i(1, 0)};
+    for (size_t k = 0; k < locations.size(); k++) {
+        double level = 0.01 * (k + 1);
+        nodes.push_back(std::make_pair(locations[k], level));
+        expected[std::make_pair(locations[k].x(), locations[k].y())] = level;
+    }
+    terrain.SetModifiedNodes(nodes);
+    auto levels = GetLevels(terrain);
+    ASSERT_EQ(levels.size(), expected.size());
+    ASSERT_EQ(levels, expected);
+
+    // Round-trip: the modified nodes of one terrain, set on a second terrain, are reported identically
+    SCMTerrain terrain2(&sys, false);
+    terrain2.Initialize(4, 4, 0.1);
+    terrain2.SetModifiedNodes(terrain.GetModifiedNodes(true));
+    ASSERT_EQ(GetLevels(terrain2), expected);
+}